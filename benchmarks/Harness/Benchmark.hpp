@@ -0,0 +1,109 @@
+#pragma once
+
+#ifndef RAZ_BENCHMARK_HPP
+#define RAZ_BENCHMARK_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Bench {
+
+/// Context of a benchmark case being run for a given size, in which the measured code is executed.
+class Context {
+public:
+  Context(std::size_t size, std::size_t warmupCount, std::size_t repetitionCount)
+    : m_size{ size }, m_warmupCount{ warmupCount }, m_repetitionCount{ repetitionCount } {}
+
+  /// Gets the size the case is run for, usually an amount of entities or of elements to be processed.
+  /// \return Size of the current run.
+  std::size_t getSize() const noexcept { return m_size; }
+  const std::vector<double>& getTimes() const noexcept { return m_times; }
+
+  /// Runs the given function a few times to warm the caches up, then measures it as many times as there are repetitions.
+  /// \tparam SetupFunc Type of the setup function.
+  /// \tparam Func Type of the function to be measured.
+  /// \param setup Function called before each execution to prepare the state to be worked on, which isn't measured.
+  /// \param func Function to be measured.
+  template <typename SetupFunc, typename Func>
+  void measure(SetupFunc&& setup, Func&& func) {
+    for (std::size_t warmupIndex = 0; warmupIndex < m_warmupCount; ++warmupIndex) {
+      setup();
+      func();
+    }
+
+    m_times.reserve(m_times.size() + m_repetitionCount);
+
+    for (std::size_t repetitionIndex = 0; repetitionIndex < m_repetitionCount; ++repetitionIndex) {
+      setup();
+
+      const auto startTime = std::chrono::steady_clock::now();
+      func();
+      const auto endTime = std::chrono::steady_clock::now();
+
+      m_times.emplace_back(std::chrono::duration<double, std::nano>(endTime - startTime).count());
+    }
+  }
+
+  /// Runs the given function a few times to warm the caches up, then measures it as many times as there are repetitions.
+  /// \tparam Func Type of the function to be measured.
+  /// \param func Function to be measured.
+  template <typename Func>
+  void measure(Func&& func) { measure([] () noexcept {}, std::forward<Func>(func)); }
+
+private:
+  std::size_t m_size {};
+  std::size_t m_warmupCount {};
+  std::size_t m_repetitionCount {};
+  std::vector<double> m_times {}; ///< Measured durations, in nanoseconds.
+};
+
+using BenchmarkFunc = void(*)(Context&);
+
+struct BenchmarkCase {
+  std::string name;
+  std::vector<std::size_t> sizes;
+  BenchmarkFunc func;
+};
+
+/// Gets all the benchmark cases registered by the BENCHMARK_CASE macro.
+/// \return Reference to the registered cases.
+inline std::vector<BenchmarkCase>& getBenchmarkCases() {
+  static std::vector<BenchmarkCase> benchmarkCases;
+  return benchmarkCases;
+}
+
+struct Registrar {
+  Registrar(std::string name, std::vector<std::size_t> sizes, BenchmarkFunc func) {
+    getBenchmarkCases().push_back(BenchmarkCase{ std::move(name), std::move(sizes), func });
+  }
+};
+
+/// Prevents the compiler from optimizing out the computation of the given value.
+/// \tparam T Type of the value.
+/// \param value Value to be kept.
+template <typename T>
+void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const T* sink = nullptr;
+  sink = &value;
+#endif
+}
+
+} // namespace Bench
+
+#define BENCH_CONCAT_IMPL(A, B) A##B
+#define BENCH_CONCAT(A, B) BENCH_CONCAT_IMPL(A, B)
+
+/// Declares & registers a benchmark case, run once for each of the given sizes.
+/// The case's body receives a Bench::Context named 'context', from which the measures must be made.
+#define BENCHMARK_CASE(NAME, ...)                                                                                                        \
+  static void BENCH_CONCAT(benchmarkFunc, __LINE__)(Bench::Context&);                                                                    \
+  static const Bench::Registrar BENCH_CONCAT(benchmarkRegistrar, __LINE__)(NAME, { __VA_ARGS__ }, &BENCH_CONCAT(benchmarkFunc, __LINE__)); \
+  static void BENCH_CONCAT(benchmarkFunc, __LINE__)([[maybe_unused]] Bench::Context& context)
+
+#endif // RAZ_BENCHMARK_HPP
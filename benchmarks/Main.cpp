@@ -0,0 +1,323 @@
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct Options {
+  std::size_t warmupCount     = 2;
+  std::size_t repetitionCount = 10;
+  std::size_t maxSize         = std::numeric_limits<std::size_t>::max();
+  std::string filter {};
+  std::string jsonPath {};
+  std::string comparedPaths[2] {};
+  double threshold = 5.0; ///< Relative median increase, in percent, from which a case is considered as having regressed.
+  bool isComparing = false;
+};
+
+struct Result {
+  std::string name;
+  std::size_t size;
+  std::size_t repetitionCount;
+  double minTime;
+  double medianTime;
+  double p99Time;
+  double meanTime;
+};
+
+void printUsage() {
+  std::cout << "Usage: RaZ_Benchmarks [options]\n"
+            << "  --filter <text>         Only runs the cases whose name contains the given text\n"
+            << "  --warmup <count>        Amount of unmeasured executions before the measures (default: 2)\n"
+            << "  --repetitions <count>   Amount of measured executions (default: 10)\n"
+            << "  --max-size <size>       Skips the runs with a greater size\n"
+            << "  --json <file>           Writes the results into the given JSON file\n"
+            << "  --compare <base> <new>  Compares the results of two JSON files instead of running the benchmarks\n"
+            << "  --threshold <percent>   Median increase from which a case is reported as a regression (default: 5)\n";
+}
+
+Options parseOptions(int argc, char* argv[]) {
+  Options options;
+
+  const auto getValue = [argc, argv] (int& argIndex) -> std::string {
+    if (argIndex + 1 >= argc)
+      throw std::invalid_argument("Error: Missing value after '" + std::string(argv[argIndex]) + "'.");
+
+    return argv[++argIndex];
+  };
+
+  for (int argIndex = 1; argIndex < argc; ++argIndex) {
+    const std::string arg = argv[argIndex];
+
+    if (arg == "--filter") {
+      options.filter = getValue(argIndex);
+    } else if (arg == "--warmup") {
+      options.warmupCount = std::stoul(getValue(argIndex));
+    } else if (arg == "--repetitions") {
+      options.repetitionCount = std::max<std::size_t>(std::stoul(getValue(argIndex)), 1);
+    } else if (arg == "--max-size") {
+      options.maxSize = std::stoul(getValue(argIndex));
+    } else if (arg == "--json") {
+      options.jsonPath = getValue(argIndex);
+    } else if (arg == "--compare") {
+      options.comparedPaths[0] = getValue(argIndex);
+      options.comparedPaths[1] = getValue(argIndex);
+      options.isComparing      = true;
+    } else if (arg == "--threshold") {
+      options.threshold = std::stod(getValue(argIndex));
+    } else {
+      throw std::invalid_argument("Error: Unknown option '" + arg + "'.");
+    }
+  }
+
+  return options;
+}
+
+Result computeResult(std::string name, std::size_t size, std::vector<double> times) {
+  std::sort(times.begin(), times.end());
+
+  const std::size_t timeCount = times.size();
+  const double medianTime     = (timeCount % 2 == 0 ? (times[timeCount / 2 - 1] + times[timeCount / 2]) * 0.5 : times[timeCount / 2]);
+  // Nearest-rank percentile: the smallest time which is greater than or equal to 99% of all the times
+  const auto p99Rank = static_cast<std::size_t>(std::ceil(0.99 * static_cast<double>(timeCount)));
+
+  return Result{ std::move(name), size, timeCount,
+                 times.front(), medianTime, times[std::max<std::size_t>(p99Rank, 1) - 1],
+                 std::accumulate(times.cbegin(), times.cend(), 0.0) / static_cast<double>(timeCount) };
+}
+
+std::string formatTime(double nanoseconds) {
+  std::ostringstream stream;
+  stream << std::fixed << std::setprecision(2);
+
+  if (nanoseconds >= 1'000'000'000.0)
+    stream << nanoseconds / 1'000'000'000.0 << " s";
+  else if (nanoseconds >= 1'000'000.0)
+    stream << nanoseconds / 1'000'000.0 << " ms";
+  else if (nanoseconds >= 1'000.0)
+    stream << nanoseconds / 1'000.0 << " us";
+  else
+    stream << nanoseconds << " ns";
+
+  return stream.str();
+}
+
+void printResult(const Result& result) {
+  std::cout << std::left << std::setw(40) << result.name
+            << std::right << std::setw(10) << result.size
+            << std::setw(14) << formatTime(result.minTime)
+            << std::setw(14) << formatTime(result.medianTime)
+            << std::setw(14) << formatTime(result.p99Time) << std::endl;
+}
+
+std::string escapeJson(const std::string& text) {
+  std::string escapedText;
+  escapedText.reserve(text.size());
+
+  for (const char character : text) {
+    if (character == '"' || character == '\\')
+      escapedText += '\\';
+
+    escapedText += character;
+  }
+
+  return escapedText;
+}
+
+void writeJson(const std::string& filePath, const std::vector<Result>& results, const Options& options) {
+  std::ofstream file(filePath);
+
+  if (!file)
+    throw std::runtime_error("Error: Couldn't open the file '" + filePath + "' for writing.");
+
+  file << std::setprecision(std::numeric_limits<double>::max_digits10);
+  file << "{\n  \"warmup\": " << options.warmupCount << ",\n  \"repetitions\": " << options.repetitionCount << ",\n  \"results\": [";
+
+  for (std::size_t resultIndex = 0; resultIndex < results.size(); ++resultIndex) {
+    const Result& result = results[resultIndex];
+
+    file << (resultIndex == 0 ? "\n" : ",\n")
+         << "    { \"name\": \"" << escapeJson(result.name) << "\", \"size\": " << result.size
+         << ", \"repetitions\": " << result.repetitionCount
+         << ", \"min_ns\": " << result.minTime << ", \"median_ns\": " << result.medianTime
+         << ", \"p99_ns\": " << result.p99Time << ", \"mean_ns\": " << result.meanTime << " }";
+  }
+
+  file << "\n  ]\n}\n";
+}
+
+/// Reads the results from a JSON file written by writeJson().
+/// This is not a general JSON parser: only the flat objects of the "results" array are read, from which the known keys are extracted.
+/// \param filePath Path to the file to be read.
+/// \return Results, indexed by their name & size.
+std::map<std::pair<std::string, std::size_t>, Result> readJson(const std::string& filePath) {
+  std::ifstream file(filePath);
+
+  if (!file)
+    throw std::runtime_error("Error: Couldn't open the file '" + filePath + "' for reading.");
+
+  std::stringstream fileStream;
+  fileStream << file.rdbuf();
+
+  const std::string content = fileStream.str();
+  std::size_t cursor = content.find("\"results\"");
+
+  if (cursor == std::string::npos)
+    throw std::runtime_error("Error: The file '" + filePath + "' doesn't contain any benchmark result.");
+
+  std::map<std::pair<std::string, std::size_t>, Result> results;
+
+  while ((cursor = content.find('{', cursor)) != std::string::npos) {
+    const std::size_t endPos = content.find('}', cursor);
+
+    if (endPos == std::string::npos)
+      throw std::runtime_error("Error: Unterminated benchmark result in the file '" + filePath + "'.");
+
+    const std::string object = content.substr(cursor + 1, endPos - cursor - 1);
+    cursor = endPos + 1;
+
+    const auto findValue = [&object, &filePath] (const std::string& key) {
+      const std::size_t keyPos = object.find("\"" + key + "\"");
+
+      if (keyPos == std::string::npos)
+        throw std::runtime_error("Error: Missing key '" + key + "' in a benchmark result of the file '" + filePath + "'.");
+
+      return object.find_first_not_of(" \t\n:", keyPos + key.size() + 2);
+    };
+
+    Result result {};
+
+    const std::size_t nameBeginPos = findValue("name") + 1;
+    std::size_t nameEndPos         = nameBeginPos;
+
+    for (; nameEndPos < object.size() && object[nameEndPos] != '"'; ++nameEndPos) {
+      if (object[nameEndPos] == '\\')
+        ++nameEndPos;
+
+      result.name += object[nameEndPos];
+    }
+
+    result.size            = std::stoul(object.substr(findValue("size")));
+    result.repetitionCount = std::stoul(object.substr(findValue("repetitions")));
+    result.minTime         = std::stod(object.substr(findValue("min_ns")));
+    result.medianTime      = std::stod(object.substr(findValue("median_ns")));
+    result.p99Time         = std::stod(object.substr(findValue("p99_ns")));
+    result.meanTime        = std::stod(object.substr(findValue("mean_ns")));
+
+    results.emplace(std::make_pair(result.name, result.size), std::move(result));
+  }
+
+  return results;
+}
+
+/// Compares the medians of the results of two runs.
+/// \return True if no case has regressed beyond the threshold, false otherwise.
+bool compareRuns(const Options& options) {
+  const auto baseResults = readJson(options.comparedPaths[0]);
+  const auto newResults  = readJson(options.comparedPaths[1]);
+
+  std::cout << std::left << std::setw(40) << "Case" << std::right << std::setw(10) << "Size"
+            << std::setw(14) << "Base median" << std::setw(14) << "New median" << std::setw(10) << "Change" << '\n';
+
+  std::size_t regressionCount = 0;
+
+  for (const auto& [key, newResult] : newResults) {
+    const auto baseResultIter = baseResults.find(key);
+
+    std::cout << std::left << std::setw(40) << key.first << std::right << std::setw(10) << key.second;
+
+    if (baseResultIter == baseResults.cend()) {
+      std::cout << std::setw(14) << "-" << std::setw(14) << formatTime(newResult.medianTime) << std::setw(10) << "new" << '\n';
+      continue;
+    }
+
+    const double baseTime = baseResultIter->second.medianTime;
+    const double change   = (baseTime > 0.0 ? (newResult.medianTime - baseTime) / baseTime * 100.0 : 0.0);
+
+    std::ostringstream changeStream;
+    changeStream << std::showpos << std::fixed << std::setprecision(1) << change << '%';
+
+    std::cout << std::setw(14) << formatTime(baseTime) << std::setw(14) << formatTime(newResult.medianTime)
+              << std::setw(10) << changeStream.str();
+
+    if (change > options.threshold) {
+      std::cout << "  REGRESSION";
+      ++regressionCount;
+    } else if (change < -options.threshold) {
+      std::cout << "  improvement";
+    }
+
+    std::cout << '\n';
+  }
+
+  for (const auto& [key, baseResult] : baseResults) {
+    if (newResults.find(key) == newResults.cend())
+      std::cout << std::left << std::setw(40) << key.first << std::right << std::setw(10) << key.second << "  missing\n";
+  }
+
+  std::cout << '\n' << regressionCount << " regression(s) beyond " << options.threshold << "%" << std::endl;
+
+  return (regressionCount == 0);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  try {
+    if (argc > 1 && (std::string(argv[1]) == "--help" || std::string(argv[1]) == "-h")) {
+      printUsage();
+      return EXIT_SUCCESS;
+    }
+
+    const Options options = parseOptions(argc, argv);
+
+    if (options.isComparing)
+      return (compareRuns(options) ? EXIT_SUCCESS : EXIT_FAILURE);
+
+    std::cout << std::left << std::setw(40) << "Case" << std::right << std::setw(10) << "Size"
+              << std::setw(14) << "Min" << std::setw(14) << "Median" << std::setw(14) << "P99" << '\n';
+
+    std::vector<Result> results;
+
+    for (const Bench::BenchmarkCase& benchmarkCase : Bench::getBenchmarkCases()) {
+      if (benchmarkCase.name.find(options.filter) == std::string::npos)
+        continue;
+
+      for (const std::size_t size : benchmarkCase.sizes) {
+        if (size > options.maxSize)
+          continue;
+
+        Bench::Context context(size, options.warmupCount, options.repetitionCount);
+        benchmarkCase.func(context);
+
+        if (context.getTimes().empty())
+          continue;
+
+        results.emplace_back(computeResult(benchmarkCase.name, size, context.getTimes()));
+        printResult(results.back());
+      }
+    }
+
+    if (!options.jsonPath.empty())
+      writeJson(options.jsonPath, results, options);
+  } catch (const std::exception& exception) {
+    std::cerr << exception.what() << '\n';
+    printUsage();
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
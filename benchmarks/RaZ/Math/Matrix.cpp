@@ -0,0 +1,110 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Math/Vector.hpp"
+
+#include <random>
+#include <vector>
+
+namespace {
+
+/// Creates the given amount of matrices filled with random values.
+/// \param matrixCount Amount of matrices to be created.
+/// \return Created matrices.
+std::vector<Raz::Mat4f> createMatrices(std::size_t matrixCount) {
+  std::mt19937 randomEngine(42);
+  std::uniform_real_distribution<float> distribution(-10.f, 10.f);
+
+  std::vector<Raz::Mat4f> matrices(matrixCount);
+
+  for (Raz::Mat4f& mat : matrices) {
+    for (std::size_t elementIndex = 0; elementIndex < 16; ++elementIndex)
+      mat[elementIndex] = distribution(randomEngine);
+  }
+
+  return matrices;
+}
+
+/// Multiplies two matrices element by element, as does the generic implementation; kept as a reference point.
+/// \param lhs Left-hand side matrix.
+/// \param rhs Right-hand side matrix.
+/// \return Product of both matrices.
+Raz::Mat4f multiplyGeneric(const Raz::Mat4f& lhs, const Raz::Mat4f& rhs) {
+  Raz::Mat4f res;
+
+  for (std::size_t heightIndex = 0; heightIndex < 4; ++heightIndex) {
+    for (std::size_t widthIndex = 0; widthIndex < 4; ++widthIndex) {
+      float& val = res[heightIndex * 4 + widthIndex];
+
+      for (std::size_t stride = 0; stride < 4; ++stride)
+        val += lhs[heightIndex * 4 + stride] * rhs[stride * 4 + widthIndex];
+    }
+  }
+
+  return res;
+}
+
+} // namespace
+
+// Chaining transformations, as is done for each node of a scene graph
+BENCHMARK_CASE("Mat4f multiplication (generic)", 1'000, 100'000) {
+  const std::vector<Raz::Mat4f> matrices = createMatrices(context.getSize());
+
+  context.measure([&matrices] () {
+    Raz::Mat4f res = Raz::Mat4f::identity();
+
+    for (const Raz::Mat4f& mat : matrices)
+      res = multiplyGeneric(res, mat);
+
+    Bench::doNotOptimize(res);
+  });
+}
+
+BENCHMARK_CASE("Mat4f multiplication", 1'000, 100'000) {
+  const std::vector<Raz::Mat4f> matrices = createMatrices(context.getSize());
+
+  context.measure([&matrices] () {
+    Raz::Mat4f res = Raz::Mat4f::identity();
+
+    for (const Raz::Mat4f& mat : matrices)
+      res = res * mat;
+
+    Bench::doNotOptimize(res);
+  });
+}
+
+BENCHMARK_CASE("Mat4f-Vec4f multiplication", 1'000, 100'000) {
+  const std::vector<Raz::Mat4f> matrices = createMatrices(context.getSize());
+
+  context.measure([&matrices] () {
+    Raz::Vec4f res(1.f);
+
+    for (const Raz::Mat4f& mat : matrices)
+      res = mat * res;
+
+    Bench::doNotOptimize(res);
+  });
+}
+
+BENCHMARK_CASE("Mat4f transposition", 1'000, 100'000) {
+  std::vector<Raz::Mat4f> matrices = createMatrices(context.getSize());
+
+  context.measure([&matrices] () {
+    for (Raz::Mat4f& mat : matrices)
+      mat = mat.transpose();
+
+    Bench::doNotOptimize(matrices.front());
+  });
+}
+
+BENCHMARK_CASE("Mat4f inversion", 1'000, 100'000) {
+  const std::vector<Raz::Mat4f> matrices = createMatrices(context.getSize());
+  std::vector<Raz::Mat4f> inverses(matrices.size());
+
+  context.measure([&matrices, &inverses] () {
+    for (std::size_t matIndex = 0; matIndex < matrices.size(); ++matIndex)
+      inverses[matIndex] = matrices[matIndex].inverse();
+
+    Bench::doNotOptimize(inverses.front());
+  });
+}
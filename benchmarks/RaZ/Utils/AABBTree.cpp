@@ -0,0 +1,104 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Utils/AABBTree.hpp"
+
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t queryCount = 1'000;
+
+/// Creates the given amount of unit boxes, randomly scattered in a cube whose volume grows with their amount.
+/// \param boxCount Amount of boxes to be created.
+/// \return Created boxes.
+std::vector<Raz::AABB> createBoxes(std::size_t boxCount) {
+  std::mt19937 randGen(42); // Fixed seed, so that all runs process the same data
+  std::uniform_real_distribution<float> posDist(0.f, std::cbrt(static_cast<float>(boxCount)) * 4.f);
+
+  std::vector<Raz::AABB> boxes;
+  boxes.reserve(boxCount);
+
+  for (std::size_t boxIndex = 0; boxIndex < boxCount; ++boxIndex) {
+    const Raz::Vec3f minPos(posDist(randGen), posDist(randGen), posDist(randGen));
+    boxes.emplace_back(minPos, minPos + Raz::Vec3f(1.f));
+  }
+
+  return boxes;
+}
+
+bool overlaps(const Raz::AABB& box1, const Raz::AABB& box2) {
+  for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+    if (box1.getRightTopFrontPos()[axisIndex] < box2.getLeftBottomBackPos()[axisIndex]
+     || box2.getRightTopFrontPos()[axisIndex] < box1.getLeftBottomBackPos()[axisIndex])
+      return false;
+  }
+
+  return true;
+}
+
+} // namespace
+
+// Finding the entities in the vicinity of others, as done for culling or gameplay queries
+BENCHMARK_CASE("AABBTree box queries", 1'000, 10'000, 100'000) {
+  const std::vector<Raz::AABB> boxes = createBoxes(context.getSize());
+
+  Raz::AABBTree<std::size_t> tree;
+
+  for (std::size_t boxIndex = 0; boxIndex < boxes.size(); ++boxIndex)
+    tree.insert(boxes[boxIndex], boxIndex);
+
+  context.measure([&boxes, &tree] () {
+    std::size_t foundCount = 0;
+
+    for (std::size_t queryIndex = 0; queryIndex < queryCount; ++queryIndex) {
+      const Raz::AABB& box = boxes[queryIndex % boxes.size()];
+      tree.query(Raz::AABB(box.getLeftBottomBackPos() - Raz::Vec3f(2.f), box.getRightTopFrontPos() + Raz::Vec3f(2.f)),
+                 [&foundCount] (std::size_t) { ++foundCount; });
+    }
+
+    Bench::doNotOptimize(foundCount);
+  });
+}
+
+BENCHMARK_CASE("AABBTree box queries (linear scan)", 1'000, 10'000, 100'000) {
+  const std::vector<Raz::AABB> boxes = createBoxes(context.getSize());
+
+  context.measure([&boxes] () {
+    std::size_t foundCount = 0;
+
+    for (std::size_t queryIndex = 0; queryIndex < queryCount; ++queryIndex) {
+      const Raz::AABB& box = boxes[queryIndex % boxes.size()];
+      const Raz::AABB queryBox(box.getLeftBottomBackPos() - Raz::Vec3f(2.f), box.getRightTopFrontPos() + Raz::Vec3f(2.f));
+
+      for (const Raz::AABB& otherBox : boxes)
+        foundCount += static_cast<std::size_t>(overlaps(queryBox, otherBox));
+    }
+
+    Bench::doNotOptimize(foundCount);
+  });
+}
+
+// Moving all the proxies slightly each frame, most of them staying in their enlarged box
+BENCHMARK_CASE("AABBTree update", 1'000, 10'000, 100'000) {
+  std::vector<Raz::AABB> boxes = createBoxes(context.getSize());
+
+  Raz::AABBTree<std::size_t> tree;
+  std::vector<std::size_t> proxyIds;
+  proxyIds.reserve(boxes.size());
+
+  for (std::size_t boxIndex = 0; boxIndex < boxes.size(); ++boxIndex)
+    proxyIds.emplace_back(tree.insert(boxes[boxIndex], boxIndex));
+
+  context.measure([&boxes, &tree, &proxyIds] () {
+    std::size_t reinsertedCount = 0;
+
+    for (std::size_t boxIndex = 0; boxIndex < boxes.size(); ++boxIndex) {
+      Raz::AABB& box = boxes[boxIndex];
+      box = Raz::AABB(box.getLeftBottomBackPos() + Raz::Vec3f(0.01f), box.getRightTopFrontPos() + Raz::Vec3f(0.01f));
+      reinsertedCount += static_cast<std::size_t>(tree.update(proxyIds[boxIndex], box));
+    }
+
+    Bench::doNotOptimize(reinsertedCount);
+  });
+}
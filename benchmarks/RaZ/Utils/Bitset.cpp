@@ -0,0 +1,157 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Utils/Bitset.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace {
+
+/// Previous implementation of the Bitset, backed by a std::vector<bool>, kept as a reference point.
+class LegacyBitset {
+public:
+  explicit LegacyBitset(std::size_t bitCount) : m_bits(bitCount) {}
+
+  std::size_t getSize() const { return m_bits.size(); }
+
+  bool isEmpty() const { return std::find(m_bits.cbegin(), m_bits.cend(), true) == m_bits.cend(); }
+  void setBit(std::size_t position) { m_bits[position] = true; }
+
+  LegacyBitset operator&(const LegacyBitset& bitset) const {
+    LegacyBitset res(std::min(m_bits.size(), bitset.getSize()));
+
+    for (std::size_t bitIndex = 0; bitIndex < res.getSize(); ++bitIndex)
+      res.m_bits[bitIndex] = m_bits[bitIndex] && bitset.m_bits[bitIndex];
+
+    return res;
+  }
+
+  bool operator[](std::size_t index) const { return m_bits[index]; }
+
+private:
+  std::vector<bool> m_bits {};
+};
+
+constexpr std::size_t signatureBitCount = 128;
+
+/// Creates the given amount of sparsely filled bitsets, as entities' signatures usually are.
+/// \tparam BitsetT Type of the bitsets to be created.
+/// \param bitsetCount Amount of bitsets to be created.
+/// \return Created bitsets.
+template <typename BitsetT>
+std::vector<BitsetT> createSignatures(std::size_t bitsetCount) {
+  std::mt19937 randGen(42); // Fixed seed, so that all runs process the same data
+  std::uniform_int_distribution<std::size_t> bitDist(0, signatureBitCount - 1);
+
+  std::vector<BitsetT> bitsets(bitsetCount, BitsetT(signatureBitCount));
+
+  for (BitsetT& bitset : bitsets) {
+    for (std::size_t i = 0; i < 3; ++i)
+      bitset.setBit(bitDist(randGen));
+  }
+
+  return bitsets;
+}
+
+/// Creates a bitset representing a system's accepted components.
+/// \tparam BitsetT Type of the bitset to be created.
+/// \return Created bitset.
+template <typename BitsetT>
+BitsetT createSystemSignature() {
+  BitsetT bitset(signatureBitCount);
+  bitset.setBit(3);
+  bitset.setBit(42);
+  return bitset;
+}
+
+} // namespace
+
+// Matching a system's accepted components against entities' signatures, as done when linking entities
+BENCHMARK_CASE("Bitset intersection", 1'000, 100'000, 1'000'000) {
+  const std::vector<Raz::Bitset> signatures = createSignatures<Raz::Bitset>(context.getSize());
+  const Raz::Bitset systemSignature         = createSystemSignature<Raz::Bitset>();
+
+  context.measure([&signatures, &systemSignature] () {
+    std::size_t matchCount = 0;
+
+    for (const Raz::Bitset& signature : signatures)
+      matchCount += static_cast<std::size_t>(signature.intersects(systemSignature));
+
+    Bench::doNotOptimize(matchCount);
+  });
+}
+
+BENCHMARK_CASE("Bitset intersection (legacy)", 1'000, 100'000, 1'000'000) {
+  const std::vector<LegacyBitset> signatures = createSignatures<LegacyBitset>(context.getSize());
+  const LegacyBitset systemSignature         = createSystemSignature<LegacyBitset>();
+
+  context.measure([&signatures, &systemSignature] () {
+    std::size_t matchCount = 0;
+
+    for (const LegacyBitset& signature : signatures) {
+      for (std::size_t bitIndex = 0; bitIndex < signature.getSize(); ++bitIndex) {
+        if (signature[bitIndex] && systemSignature[bitIndex]) {
+          ++matchCount;
+          break;
+        }
+      }
+    }
+
+    Bench::doNotOptimize(matchCount);
+  });
+}
+
+BENCHMARK_CASE("Bitset operator&", 1'000, 100'000, 1'000'000) {
+  const std::vector<Raz::Bitset> signatures = createSignatures<Raz::Bitset>(context.getSize());
+  const Raz::Bitset systemSignature         = createSystemSignature<Raz::Bitset>();
+
+  context.measure([&signatures, &systemSignature] () {
+    std::size_t nonEmptyCount = 0;
+
+    for (const Raz::Bitset& signature : signatures)
+      nonEmptyCount += static_cast<std::size_t>(!(signature & systemSignature).isEmpty());
+
+    Bench::doNotOptimize(nonEmptyCount);
+  });
+}
+
+BENCHMARK_CASE("Bitset operator& (legacy)", 1'000, 100'000, 1'000'000) {
+  const std::vector<LegacyBitset> signatures = createSignatures<LegacyBitset>(context.getSize());
+  const LegacyBitset systemSignature         = createSystemSignature<LegacyBitset>();
+
+  context.measure([&signatures, &systemSignature] () {
+    std::size_t nonEmptyCount = 0;
+
+    for (const LegacyBitset& signature : signatures)
+      nonEmptyCount += static_cast<std::size_t>(!(signature & systemSignature).isEmpty());
+
+    Bench::doNotOptimize(nonEmptyCount);
+  });
+}
+
+BENCHMARK_CASE("Bitset equality", 1'000, 100'000, 1'000'000) {
+  const std::vector<Raz::Bitset> signatures = createSignatures<Raz::Bitset>(context.getSize());
+
+  context.measure([&signatures] () {
+    std::size_t equalCount = 0;
+
+    for (std::size_t bitsetIndex = 1; bitsetIndex < signatures.size(); ++bitsetIndex)
+      equalCount += static_cast<std::size_t>(signatures[bitsetIndex] == signatures[bitsetIndex - 1]);
+
+    Bench::doNotOptimize(equalCount);
+  });
+}
+
+BENCHMARK_CASE("Bitset enabled bits iteration", 1'000, 100'000, 1'000'000) {
+  const std::vector<Raz::Bitset> signatures = createSignatures<Raz::Bitset>(context.getSize());
+
+  context.measure([&signatures] () {
+    std::size_t sum = 0;
+
+    for (const Raz::Bitset& signature : signatures)
+      signature.forEachEnabledBit([&sum] (std::size_t bitIndex) { sum += bitIndex; });
+
+    Bench::doNotOptimize(sum);
+  });
+}
@@ -0,0 +1,81 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Utils/MpmcQueue.hpp"
+
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#if defined(RAZ_THREADS_AVAILABLE)
+
+namespace {
+
+constexpr std::size_t ThreadCount = 2; ///< Amount of producer threads, & of consumer threads in addition to the measuring one.
+
+} // namespace
+
+// Reference point for the lock-free queue below, as cross-thread communication would be done without it
+BENCHMARK_CASE("MpmcQueue mutex-guarded deque", 10'000, 100'000) {
+  context.measure([&context] () {
+    std::deque<std::size_t> queue;
+    std::mutex mutex;
+
+    const std::size_t valueCountPerThread = context.getSize() / ThreadCount;
+    std::vector<std::thread> producers;
+
+    for (std::size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex) {
+      producers.emplace_back([&queue, &mutex, valueCountPerThread] () noexcept {
+        for (std::size_t value = 0; value < valueCountPerThread; ++value) {
+          std::lock_guard<std::mutex> lock(mutex);
+          queue.emplace_back(value);
+        }
+      });
+    }
+
+    for (std::size_t poppedCount = 0; poppedCount < valueCountPerThread * ThreadCount;) {
+      std::lock_guard<std::mutex> lock(mutex);
+
+      if (queue.empty())
+        continue;
+
+      Bench::doNotOptimize(queue.front());
+      queue.pop_front();
+      ++poppedCount;
+    }
+
+    for (std::thread& producer : producers)
+      producer.join();
+  });
+}
+
+BENCHMARK_CASE("MpmcQueue transfer", 10'000, 100'000) {
+  Raz::MpmcQueue<std::size_t> queue(1024);
+
+  context.measure([&queue, &context] () {
+    const std::size_t valueCountPerThread = context.getSize() / ThreadCount;
+    std::vector<std::thread> producers;
+
+    for (std::size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex) {
+      producers.emplace_back([&queue, valueCountPerThread] () noexcept {
+        for (std::size_t value = 0; value < valueCountPerThread; ++value) {
+          while (!queue.tryPush(value))
+            std::this_thread::yield();
+        }
+      });
+    }
+
+    std::size_t value {};
+
+    for (std::size_t poppedCount = 0; poppedCount < valueCountPerThread * ThreadCount; ++poppedCount) {
+      while (!queue.tryPop(value))
+        std::this_thread::yield();
+
+      Bench::doNotOptimize(value);
+    }
+
+    for (std::thread& producer : producers)
+      producer.join();
+  });
+}
+
+#endif
@@ -0,0 +1,111 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Utils/ParallelAlgorithms.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#if defined(RAZ_THREADS_AVAILABLE)
+
+namespace {
+
+/// Creates keys in random order, as a render queue would sort them by material & depth.
+/// \param keyCount Amount of keys to be created.
+/// \return Shuffled keys.
+std::vector<std::uint64_t> createKeys(std::size_t keyCount) {
+  std::vector<std::uint64_t> keys(keyCount);
+  std::iota(keys.begin(), keys.end(), 0);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937_64(42));
+  return keys;
+}
+
+std::vector<float> createValues(std::size_t valueCount) {
+  std::vector<float> values(valueCount);
+  std::iota(values.begin(), values.end(), 0.f);
+  return values;
+}
+
+} // namespace
+
+// The sequential versions are the standard algorithms, to which the parallel ones fall back for small ranges
+
+BENCHMARK_CASE("ParallelAlgorithms sequential sort", 10'000, 1'000'000) {
+  const std::vector<std::uint64_t> shuffledKeys = createKeys(context.getSize());
+  std::vector<std::uint64_t> keys;
+
+  context.measure([&keys, &shuffledKeys] () { keys = shuffledKeys; }, [&keys] () {
+    std::sort(keys.begin(), keys.end());
+    Bench::doNotOptimize(keys.front());
+  });
+}
+
+BENCHMARK_CASE("ParallelAlgorithms parallel sort", 10'000, 1'000'000) {
+  const std::vector<std::uint64_t> shuffledKeys = createKeys(context.getSize());
+  std::vector<std::uint64_t> keys;
+
+  context.measure([&keys, &shuffledKeys] () { keys = shuffledKeys; }, [&keys] () {
+    Raz::Threading::parallelSort(keys.begin(), keys.end());
+    Bench::doNotOptimize(keys.front());
+  });
+}
+
+BENCHMARK_CASE("ParallelAlgorithms sequential transformReduce", 10'000, 1'000'000, 10'000'000) {
+  const std::vector<float> values = createValues(context.getSize());
+
+  context.measure([&values] () {
+    Bench::doNotOptimize(std::transform_reduce(values.cbegin(), values.cend(), 0.f, [] (float val1, float val2) { return std::max(val1, val2); },
+                                               [] (float value) { return value * 0.5f + 1.f; }));
+  });
+}
+
+BENCHMARK_CASE("ParallelAlgorithms parallel transformReduce", 10'000, 1'000'000, 10'000'000) {
+  const std::vector<float> values = createValues(context.getSize());
+
+  context.measure([&values] () {
+    Bench::doNotOptimize(Raz::Threading::parallelTransformReduce(values.cbegin(), values.cend(), 0.f,
+                                                                 [] (float val1, float val2) { return std::max(val1, val2); },
+                                                                 [] (float value) { return value * 0.5f + 1.f; }));
+  });
+}
+
+BENCHMARK_CASE("ParallelAlgorithms sequential exclusive scan", 10'000, 1'000'000, 10'000'000) {
+  const std::vector<float> values = createValues(context.getSize());
+  std::vector<float> sums(values.size());
+
+  context.measure([&values, &sums] () {
+    std::exclusive_scan(values.cbegin(), values.cend(), sums.begin(), 0.f);
+    Bench::doNotOptimize(sums.back());
+  });
+}
+
+BENCHMARK_CASE("ParallelAlgorithms parallel exclusive scan", 10'000, 1'000'000, 10'000'000) {
+  const std::vector<float> values = createValues(context.getSize());
+  std::vector<float> sums(values.size());
+
+  context.measure([&values, &sums] () {
+    Raz::Threading::parallelExclusiveScan(values.cbegin(), values.cend(), sums.begin(), 0.f);
+    Bench::doNotOptimize(sums.back());
+  });
+}
+
+BENCHMARK_CASE("ParallelAlgorithms sequential partition", 10'000, 1'000'000) {
+  const std::vector<std::uint64_t> shuffledKeys = createKeys(context.getSize());
+  std::vector<std::uint64_t> keys;
+
+  context.measure([&keys, &shuffledKeys] () { keys = shuffledKeys; }, [&keys] () {
+    Bench::doNotOptimize(*std::stable_partition(keys.begin(), keys.end(), [] (std::uint64_t key) { return (key % 3 == 0); }));
+  });
+}
+
+BENCHMARK_CASE("ParallelAlgorithms parallel partition", 10'000, 1'000'000) {
+  const std::vector<std::uint64_t> shuffledKeys = createKeys(context.getSize());
+  std::vector<std::uint64_t> keys;
+
+  context.measure([&keys, &shuffledKeys] () { keys = shuffledKeys; }, [&keys] () {
+    Bench::doNotOptimize(*Raz::Threading::parallelPartition(keys.begin(), keys.end(), [] (std::uint64_t key) { return (key % 3 == 0); }));
+  });
+}
+
+#endif
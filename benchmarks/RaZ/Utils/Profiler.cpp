@@ -0,0 +1,22 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Utils/Profiler.hpp"
+
+// The buffers are emptied before each repetition, so that no event is dropped; sizes must thus remain below the buffers' capacity
+BENCHMARK_CASE("Profiler zones", 1'000, 10'000) {
+  context.measure([] () { Raz::Profiler::capture(); }, [&context] () {
+    for (std::size_t zoneIndex = 0; zoneIndex < context.getSize(); ++zoneIndex)
+      const Raz::ProfileZone zone("Zone");
+  });
+}
+
+BENCHMARK_CASE("Profiler zones (disabled)", 1'000, 10'000) {
+  Raz::Profiler::disable();
+
+  context.measure([&context] () {
+    for (std::size_t zoneIndex = 0; zoneIndex < context.getSize(); ++zoneIndex)
+      const Raz::ProfileZone zone("Zone");
+  });
+
+  Raz::Profiler::enable();
+}
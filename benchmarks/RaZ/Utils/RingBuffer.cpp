@@ -0,0 +1,58 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Utils/RingBuffer.hpp"
+
+#include <algorithm>
+#include <array>
+
+#if defined(RAZ_THREADS_AVAILABLE)
+
+namespace {
+
+/// Streams the given amount of values from a producer thread to the calling one, both transferring them in batches of the given size.
+/// \param buffer Buffer through which the values are transferred.
+/// \param valueCount Amount of values to be transferred.
+/// \param batchSize Maximal amount of values pushed or popped at once; must not be greater than 256.
+void streamValues(Raz::RingBuffer<std::size_t>& buffer, std::size_t valueCount, std::size_t batchSize) {
+  std::thread producer([&buffer, valueCount, batchSize] () noexcept {
+    std::array<std::size_t, 256> batch {};
+
+    for (std::size_t pushedCount = 0; pushedCount < valueCount;) {
+      const std::size_t count = buffer.push(batch.data(), std::min(batchSize, valueCount - pushedCount));
+
+      if (count == 0)
+        std::this_thread::yield();
+
+      pushedCount += count;
+    }
+  });
+
+  std::array<std::size_t, 256> batch {};
+
+  for (std::size_t poppedCount = 0; poppedCount < valueCount;) {
+    const std::size_t count = buffer.pop(batch.data(), batchSize);
+
+    if (count == 0)
+      std::this_thread::yield();
+
+    poppedCount += count;
+  }
+
+  Bench::doNotOptimize(batch.front());
+  producer.join();
+}
+
+} // namespace
+
+// Transferring the values one by one, as an SpscQueue would
+BENCHMARK_CASE("RingBuffer single transfer", 10'000, 100'000) {
+  Raz::RingBuffer<std::size_t> buffer(1024);
+  context.measure([&buffer, &context] () { streamValues(buffer, context.getSize(), 1); });
+}
+
+BENCHMARK_CASE("RingBuffer batch transfer", 10'000, 100'000) {
+  Raz::RingBuffer<std::size_t> buffer(1024);
+  context.measure([&buffer, &context] () { streamValues(buffer, context.getSize(), 256); });
+}
+
+#endif
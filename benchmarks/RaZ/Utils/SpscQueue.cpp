@@ -0,0 +1,62 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Utils/SpscQueue.hpp"
+
+#include <deque>
+#include <mutex>
+
+#if defined(RAZ_THREADS_AVAILABLE)
+
+// Reference point for the lock-free queue below, as cross-thread communication would be done without it
+BENCHMARK_CASE("SpscQueue mutex-guarded deque", 10'000, 100'000) {
+  context.measure([&context] () {
+    std::deque<std::size_t> queue;
+    std::mutex mutex;
+
+    std::thread producer([&queue, &mutex, &context] () {
+      for (std::size_t value = 0; value < context.getSize(); ++value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.emplace_back(value);
+      }
+    });
+
+    for (std::size_t poppedCount = 0; poppedCount < context.getSize();) {
+      std::lock_guard<std::mutex> lock(mutex);
+
+      if (queue.empty())
+        continue;
+
+      Bench::doNotOptimize(queue.front());
+      queue.pop_front();
+      ++poppedCount;
+    }
+
+    producer.join();
+  });
+}
+
+BENCHMARK_CASE("SpscQueue transfer", 10'000, 100'000) {
+  Raz::SpscQueue<std::size_t> queue(1024);
+
+  context.measure([&queue, &context] () {
+    std::thread producer([&queue, &context] () {
+      for (std::size_t value = 0; value < context.getSize(); ++value) {
+        while (!queue.tryPush(value))
+          std::this_thread::yield();
+      }
+    });
+
+    std::size_t value {};
+
+    for (std::size_t poppedCount = 0; poppedCount < context.getSize(); ++poppedCount) {
+      while (!queue.tryPop(value))
+        std::this_thread::yield();
+
+      Bench::doNotOptimize(value);
+    }
+
+    producer.join();
+  });
+}
+
+#endif
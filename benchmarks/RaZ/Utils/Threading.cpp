@@ -0,0 +1,72 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/Utils/Threading.hpp"
+
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+#if defined(RAZ_THREADS_AVAILABLE)
+
+namespace {
+
+/// Applies a small amount of work to each of the given values, as a system would on its components.
+/// \param values Values to be processed.
+/// \param beginIndex Index of the first value to be processed.
+/// \param endIndex Index past the last value to be processed.
+void processValues(std::vector<float>& values, std::size_t beginIndex, std::size_t endIndex) {
+  for (std::size_t valueIndex = beginIndex; valueIndex < endIndex; ++valueIndex)
+    values[valueIndex] = std::sqrt(values[valueIndex] * 0.5f + 1.f);
+}
+
+std::vector<float> createValues(std::size_t valueCount) {
+  std::vector<float> values(valueCount);
+  std::iota(values.begin(), values.end(), 0.f);
+  return values;
+}
+
+} // namespace
+
+// Reference point for the parallel executions below
+BENCHMARK_CASE("Threading sequential", 1'000, 100'000, 1'000'000) {
+  std::vector<float> values = createValues(context.getSize());
+
+  context.measure([&values] () {
+    processValues(values, 0, values.size());
+    Bench::doNotOptimize(values.front());
+  });
+}
+
+BENCHMARK_CASE("Threading parallelize", 1'000, 100'000, 1'000'000) {
+  std::vector<float> values = createValues(context.getSize());
+
+  context.measure([&values] () {
+    Raz::Threading::parallelize(values, [&values] (Raz::Threading::IndexRange range) {
+      processValues(values, range.beginIndex, range.endIndex);
+    });
+
+    Bench::doNotOptimize(values.front());
+  });
+}
+
+BENCHMARK_CASE("Threading parallelFor", 1'000, 100'000, 1'000'000) {
+  std::vector<float> values = createValues(context.getSize());
+
+  context.measure([&values] () {
+    Raz::Threading::parallelFor(Raz::Threading::IndexRange{ 0, values.size() }, 4096, [&values] (Raz::Threading::IndexRange range) {
+      processValues(values, range.beginIndex, range.endIndex);
+    });
+
+    Bench::doNotOptimize(values.front());
+  });
+}
+
+BENCHMARK_CASE("Threading task submission", 1'000, 100'000) {
+  Raz::ThreadPool& threadPool = Raz::Threading::getDefaultThreadPool();
+
+  context.measure([&threadPool, &context] () {
+    threadPool.run(context.getSize(), [] (std::size_t index) { Bench::doNotOptimize(index); });
+  });
+}
+
+#endif
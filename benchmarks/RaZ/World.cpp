@@ -0,0 +1,223 @@
+#include "Benchmark.hpp"
+
+#include "RaZ/System.hpp"
+#include "RaZ/World.hpp"
+#include "RaZ/WorldSnapshot.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Physics/RigidBody.hpp"
+
+#include <optional>
+#include <utility>
+
+namespace {
+
+class TransformSystem final : public Raz::System {
+public:
+  TransformSystem() { m_acceptedComponents.setBit(Raz::Component::getId<Raz::Transform>()); }
+
+  bool update(float) override { return true; }
+};
+
+/// Fills the given world with entities, half of them also holding a rigid body so that several archetypes are involved.
+/// \param world World to be filled.
+/// \param entityCount Amount of entities to be added.
+void populateWorld(Raz::World& world, std::size_t entityCount) {
+  for (std::size_t entityIndex = 0; entityIndex < entityCount; ++entityIndex) {
+    Raz::Entity& entity = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(static_cast<float>(entityIndex), 0.f, 0.f));
+
+    if (entityIndex % 2 == 0)
+      entity.addComponent<Raz::RigidBody>(1.f, 0.f);
+  }
+}
+
+} // namespace
+
+BENCHMARK_CASE("World entity creation", 1'000, 100'000, 1'000'000) {
+  std::optional<Raz::World> world;
+
+  context.measure([&world] () { world.emplace(); }, [&world, &context] () {
+    for (std::size_t entityIndex = 0; entityIndex < context.getSize(); ++entityIndex)
+      world->addEntityWithComponent<Raz::Transform>();
+  });
+}
+
+BENCHMARK_CASE("World entity creation (reserved)", 1'000, 100'000, 1'000'000) {
+  std::optional<Raz::World> world;
+
+  context.measure([&world, &context] () { world.emplace(context.getSize()); }, [&world, &context] () {
+    for (std::size_t entityIndex = 0; entityIndex < context.getSize(); ++entityIndex)
+      world->addEntityWithComponent<Raz::Transform>();
+  });
+}
+
+BENCHMARK_CASE("World refresh", 1'000, 100'000, 1'000'000) {
+  std::optional<Raz::World> world;
+
+  // All the entities have just been added, & thus have to be linked to the systems
+  context.measure([&world, &context] () {
+    world.emplace(context.getSize());
+    world->addSystem<TransformSystem>();
+    populateWorld(*world, context.getSize());
+  }, [&world] () {
+    world->refresh();
+  });
+}
+
+BENCHMARK_CASE("World refresh (unchanged)", 1'000, 100'000, 1'000'000) {
+  Raz::World world(context.getSize());
+  world.addSystem<TransformSystem>();
+  populateWorld(world, context.getSize());
+  world.refresh();
+
+  context.measure([&world] () { world.refresh(); });
+}
+
+BENCHMARK_CASE("World entity destruction", 1'000, 100'000, 1'000'000) {
+  std::optional<Raz::World> world;
+
+  context.measure([&world, &context] () {
+    world.emplace(context.getSize());
+    world->addSystem<TransformSystem>();
+    populateWorld(*world, context.getSize());
+    world->refresh();
+
+    for (std::size_t entityIndex = 0; entityIndex < context.getSize(); entityIndex += 2)
+      world->destroyEntity(*world->getEntities()[entityIndex]);
+  }, [&world] () {
+    world->refresh();
+  });
+}
+
+BENCHMARK_CASE("System linking", 1'000, 100'000, 1'000'000) {
+  Raz::World world(context.getSize());
+  populateWorld(world, context.getSize());
+
+  std::optional<TransformSystem> system;
+
+  context.measure([&system] () { system.emplace(); }, [&world, &system] () {
+    for (const Raz::EntityPtr& entity : world.getEntities()) {
+      if (system->acceptsEntity(*entity))
+        system->linkEntity(entity);
+    }
+  });
+}
+
+BENCHMARK_CASE("Query iteration (write)", 1'000, 100'000, 1'000'000) {
+  Raz::World world(context.getSize());
+  populateWorld(world, context.getSize());
+  world.refresh();
+
+  const auto& query = world.query<Raz::Transform>();
+
+  context.measure([&query] () {
+    query.forEach([] (Raz::Transform& transform) { transform.translate(0.f, 1.f, 0.f); });
+  });
+}
+
+BENCHMARK_CASE("Query iteration (read)", 1'000, 100'000, 1'000'000) {
+  Raz::World world(context.getSize());
+  populateWorld(world, context.getSize());
+  world.refresh();
+
+  const auto& query = world.query<const Raz::Transform>();
+
+  context.measure([&query] () {
+    float sum = 0.f;
+    query.forEach([&sum] (const Raz::Transform& transform) { sum += transform.getPosition()[0]; });
+    Bench::doNotOptimize(sum);
+  });
+}
+
+BENCHMARK_CASE("Query iteration (2 components)", 1'000, 100'000, 1'000'000) {
+  Raz::World world(context.getSize());
+  populateWorld(world, context.getSize());
+  world.refresh();
+
+  const auto& query = world.query<Raz::Transform, const Raz::RigidBody>();
+
+  context.measure([&query] () {
+    query.forEach([] (Raz::Transform& transform, const Raz::RigidBody& rigidBody) {
+      transform.translate(rigidBody.getVelocity());
+    });
+  });
+}
+
+BENCHMARK_CASE("Entity component access", 1'000, 100'000, 1'000'000) {
+  Raz::World world(context.getSize());
+  populateWorld(world, context.getSize());
+
+  context.measure([&world] () {
+    float sum = 0.f;
+
+    for (const Raz::EntityPtr& entity : world.getEntities())
+      sum += std::as_const(*entity).getComponent<Raz::Transform>().getPosition()[0];
+
+    Bench::doNotOptimize(sum);
+  });
+}
+
+BENCHMARK_CASE("World snapshot save", 1'000, 100'000, 1'000'000) {
+  Raz::World world(context.getSize());
+  populateWorld(world, context.getSize());
+
+  const Raz::WorldSnapshot snapshot;
+
+  context.measure([&world, &snapshot] () { Bench::doNotOptimize(snapshot.save(world)); });
+}
+
+BENCHMARK_CASE("World snapshot load", 1'000, 100'000, 1'000'000) {
+  std::vector<std::byte> data;
+
+  const Raz::WorldSnapshot snapshot;
+
+  {
+    Raz::World world(context.getSize());
+    populateWorld(world, context.getSize());
+    data = snapshot.save(world);
+  }
+
+  std::optional<Raz::World> world;
+
+  context.measure([&world, &context] () { world.emplace(context.getSize()); }, [&world, &snapshot, &data] () {
+    Bench::doNotOptimize(snapshot.load(*world, data));
+  });
+}
+
+BENCHMARK_CASE("World snapshot save (reused buffer)", 1'000, 100'000, 1'000'000) {
+  Raz::World world(context.getSize());
+  populateWorld(world, context.getSize());
+
+  const Raz::WorldSnapshot snapshot;
+  std::vector<std::byte> data;
+
+  context.measure([&world, &snapshot, &data] () {
+    snapshot.save(world, data);
+    Bench::doNotOptimize(data);
+  });
+}
+
+BENCHMARK_CASE("World entity spawning (one by one)", 1'000, 10'000, 100'000) {
+  std::optional<Raz::World> world;
+
+  context.measure([&world] () { world.emplace(); }, [&world, &context] () {
+    for (std::size_t entityIndex = 0; entityIndex < context.getSize(); ++entityIndex) {
+      Raz::Entity& entity = world->addEntityWithComponent<Raz::Transform>(Raz::Vec3f(1.f, 2.f, 3.f));
+      entity.addComponent<Raz::RigidBody>(1.f, 0.f);
+    }
+
+    world->refresh();
+  });
+}
+
+BENCHMARK_CASE("World entity spawning (prefab)", 1'000, 10'000, 100'000) {
+  Raz::Prefab prefab;
+  prefab.addComponent<Raz::Transform>(Raz::Vec3f(1.f, 2.f, 3.f));
+  prefab.addComponent<Raz::RigidBody>(1.f, 0.f);
+
+  std::optional<Raz::World> world;
+
+  context.measure([&world] () { world.emplace(); }, [&world, &prefab, &context] () {
+    world->instantiate(prefab, context.getSize());
+    world->refresh();
+  });
+}
@@ -8,10 +8,24 @@
 #include "RaZ/Utils/Window.hpp"
 #include "RaZ/World.hpp"
 
+#include <cassert>
 #include <chrono>
+#include <functional>
 
 namespace Raz {
 
+class RenderSystem;
+
+/// Application class, updating worlds once per frame.
+/// By default, all the systems are updated once per frame with the frame's duration. If a fixed time step is set, the systems requiring it
+///  (see System::isFixedStepRequired()) are instead updated as many times as needed to catch up with the elapsed time, always with this
+///  step; the others are still updated once per frame, being given the interpolation factor between the last two steps.
+/// Worlds share neither entities nor systems; if enabled, those which don't require the main thread are updated concurrently.
+/// If any world holds a pipelined system (see System::isPipelined()), such as a pipelined RenderSystem, the structural changes & the
+///  windows' inputs are applied at the beginning of each frame; the worlds are then simulated on the default thread pool, while the main
+///  thread renders the frames prepared during the previous one. The overlays' callbacks are thus executed concurrently with the simulation.
+///  If any world requires the main thread, or if a system may write components that a prepared frame references (see
+///  System::getRenderedComponents()), the worlds are simulated before the rendering instead.
 class Application {
 public:
   explicit Application(std::size_t worldCount = 1) { m_worlds.reserve(worldCount); }
@@ -19,23 +33,84 @@ public:
   const std::vector<World>& getWorlds() const { return m_worlds; }
   std::vector<World>& getWorlds() { return m_worlds; }
   float getDeltaTime() const { return m_deltaTime; }
+  float getFixedTimeStep() const noexcept { return m_fixedTimeStep; }
+  std::size_t getMaxStepCount() const noexcept { return m_maxStepCount; }
+  /// Gets the progression of the last frame between the last two fixed steps.
+  /// \return Interpolation factor between 0 & 1; always 0 if no fixed time step is set.
+  float getStepInterpolation() const noexcept { return m_stepInterpolation; }
+  bool isParallelWorldUpdateEnabled() const noexcept { return m_isParallelWorldUpdateEnabled; }
+  /// Gets the time spent updating each world during the last frame, including all its fixed steps if any.
+  /// \return Update durations in seconds, indexed like the worlds.
+  const std::vector<float>& getWorldUpdateTimes() const noexcept { return m_worldUpdateTimes; }
+
+  /// Sets the duration of the fixed simulation step.
+  /// \param timeStep Duration of a simulation step, in seconds (1 / 60 for a 60 Hz simulation); 0 to update all systems once per frame.
+  void setFixedTimeStep(float timeStep) {
+    assert("Error: The fixed time step must not be negative." && timeStep >= 0.f);
+    m_fixedTimeStep = timeStep;
+  }
+  /// Sets the maximum amount of fixed steps executed in a single frame.
+  /// If the frame lasted longer than this amount of steps, the remaining time is dropped so that the simulation doesn't fall further behind.
+  /// \param maxStepCount Maximum amount of fixed steps per frame; must not be 0.
+  void setMaxStepCount(std::size_t maxStepCount) {
+    assert("Error: The maximum step count must not be 0." && maxStepCount > 0);
+    m_maxStepCount = maxStepCount;
+  }
+  /// Sets the minimum duration of a frame, limiting the rate at which the variable step systems are updated.
+  /// \param frameRate Maximum amount of frames per second (144 to render at 144 Hz); 0 to run as fast as possible.
+  void setMaxFrameRate(float frameRate);
+  /// Enables or disables the concurrent update of worlds.
+  /// If enabled, the worlds which don't require the main thread (see World::isMainThreadRequired()) are updated on the default thread pool,
+  ///  while the others are updated one after the other on the thread running the application.
+  /// \param enabled True if the worlds should be updated concurrently, false otherwise.
+  void enableParallelWorldUpdate(bool enabled = true) noexcept { m_isParallelWorldUpdateEnabled = enabled; }
 
   /// Adds a World into the Application.
   /// \param world World to be added.
   /// \return Reference to the newly added World.
   World& addWorld(World world);
-  /// Runs the application.
+  /// Runs a frame of the application, measuring the time elapsed since the previous one.
   /// \return True if the application is still running, false otherwise.
   bool run();
+  /// Runs a frame of the application as if the given time had elapsed since the previous one, instead of measuring it.
+  /// This allows driving the simulation at a chosen pace, for instance to replay it; the maximum frame rate is not applied.
+  /// \param deltaTime Duration of the frame, in seconds.
+  /// \return True if the application is still running, false otherwise.
+  bool run(float deltaTime);
   /// Tells the application to stop running.
   void quit() { m_isRunning = false; }
 
 private:
+  struct PipelinedSystem {
+    System* system;
+    std::size_t worldIndex; ///< Index of the system's World, deactivated if the rendering reports the system as inactive.
+  };
+
+  /// Updates all the worlds once, making as many fixed steps as needed beforehand if a fixed time step is set.
+  void simulate();
+  /// Updates all the worlds on the default thread pool while the given systems render their last prepared frame on the calling thread.
+  /// If any world requires the main thread or may modify the components referenced by a frame, the worlds are updated before the rendering
+  ///  instead.
+  /// \param pipelinedSystems Pipelined systems to be rendered.
+  void simulateAndRender(const std::vector<PipelinedSystem>& pipelinedSystems);
+  /// Updates all the worlds, concurrently if enabled, & adds their update durations to the current frame's.
+  /// \param update Function updating a single world, returning true if the world is still active & false otherwise.
+  void updateWorlds(const std::function<bool(World&)>& update);
+
   std::vector<World> m_worlds {};
   Bitset m_activeWorlds {};
+  std::vector<float> m_worldUpdateTimes {};
+  bool m_isParallelWorldUpdateEnabled {};
 
-  std::chrono::time_point<std::chrono::system_clock> m_lastFrameTime {};
+  std::chrono::time_point<std::chrono::steady_clock> m_lastFrameTime = std::chrono::steady_clock::now();
+  std::chrono::steady_clock::duration m_minFrameDuration {};
   float m_deltaTime {};
+
+  float m_fixedTimeStep {};
+  std::size_t m_maxStepCount = 5;
+  float m_timeAccumulator {}; ///< Elapsed time which has not been simulated yet by the fixed step systems.
+  float m_stepInterpolation {};
+
   bool m_isRunning = true;
 };
 
@@ -0,0 +1,75 @@
+#pragma once
+
+#ifndef RAZ_ARCHETYPE_HPP
+#define RAZ_ARCHETYPE_HPP
+
+#include "RaZ/Component.hpp"
+#include "RaZ/Utils/Bitset.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace Raz {
+
+class Archetype;
+using ArchetypePtr = std::unique_ptr<Archetype>;
+
+class Entity;
+
+/// Archetype class, grouping all the enabled entities which hold exactly the same set of components.
+/// Alongside its entities, an archetype keeps one column per component type, referencing the entities' components in the same order;
+///   these columns can be iterated over directly, without going through each entity & checking its components.
+/// An archetype is an index over the components, not their storage: it doesn't own them, & doesn't lay them out by archetype.
+/// \note The columns hold pointers to the components, which stay in the chunked storage of their type (see ComponentStorage) so that
+///   their address never changes when an entity moves from an archetype to another. Iterating over a column thus still costs one
+///   indirection per component, & the components are only contiguous in memory if they were created together (for example when
+///   instantiating a prefab several times) & are iterated in that order; entities being added & removed over time scatter them.
+class Archetype {
+public:
+  /// Creates an archetype for the given component signature.
+  /// \param signature Set of component IDs held by the archetype's entities; must not have any trailing disabled bit.
+  explicit Archetype(Bitset signature);
+  Archetype(const Archetype&) = delete;
+  Archetype(Archetype&&) noexcept = delete;
+
+  const Bitset& getSignature() const noexcept { return m_signature; }
+  const std::vector<std::size_t>& getComponentIds() const noexcept { return m_componentIds; }
+  const std::vector<Entity*>& getEntities() const noexcept { return m_entities; }
+  std::size_t getEntityCount() const noexcept { return m_entities.size(); }
+  bool isEmpty() const noexcept { return m_entities.empty(); }
+
+  /// Tells if the archetype's entities all hold the component of the given ID.
+  /// \param compId ID of the component to be checked.
+  /// \return True if the component is part of the archetype's signature, false otherwise.
+  bool hasComponent(std::size_t compId) const noexcept { return (compId < m_signature.getSize() && m_signature[compId]); }
+  /// Gets the column of the component of the given ID, ordered like the archetype's entities.
+  /// The component must be part of the archetype's signature.
+  /// \param compId ID of the component to get the column of.
+  /// \return Components of the given ID held by the archetype's entities.
+  const std::vector<Component*>& getColumn(std::size_t compId) const noexcept { return m_columns[compId]; }
+  /// Adds an entity into the archetype, along with its components.
+  /// The entity's enabled components must match the archetype's signature.
+  /// \param entity Entity to be added.
+  void addEntity(Entity& entity);
+  /// Adds several entities into the archetype at once, along with their components.
+  /// The entities' enabled components must all match the archetype's signature.
+  /// \param entities Entities to be added.
+  void addEntities(const std::vector<Entity*>& entities);
+  /// Removes an entity from the archetype in constant time, moving the last entity in its place.
+  /// \param entity Entity to be removed; must belong to the archetype.
+  void removeEntity(Entity& entity);
+
+  Archetype& operator=(const Archetype&) = delete;
+  Archetype& operator=(Archetype&&) noexcept = delete;
+
+private:
+  Bitset m_signature {};
+  std::vector<std::size_t> m_componentIds {};
+
+  std::vector<Entity*> m_entities {};
+  std::vector<std::vector<Component*>> m_columns {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_ARCHETYPE_HPP
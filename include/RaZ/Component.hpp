@@ -3,12 +3,23 @@
 #ifndef RAZ_COMPONENT_HPP
 #define RAZ_COMPONENT_HPP
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 
 namespace Raz {
 
+class BaseComponentStorage;
 class Component;
-using ComponentPtr = std::unique_ptr<Component>;
+
+/// Deleter of a ComponentPtr, giving the component back to the storage it has been created from if any.
+struct ComponentDeleter {
+  void operator()(Component* component) const noexcept;
+
+  BaseComponentStorage* storage = nullptr; ///< Storage the component belongs to; if null, the component has been allocated on its own.
+};
+
+using ComponentPtr = std::unique_ptr<Component, ComponentDeleter>;
 
 /// Component class representing a base Component to be inherited.
 class Component {
@@ -20,19 +31,41 @@ public:
   /// \tparam T Type of the component to get the ID for.
   /// \return Given component's ID.
   template <typename T> static std::size_t getId();
+  /// Gets the version of the component registry at which the component has last been modified.
+  /// A component is considered modified when it is created, accessed with Entity::getMutableComponent() or from a query iterating over it
+  ///  mutably.
+  /// \note Components modified through references kept from a previous access, or obtained with Entity::getComponent(), are not considered
+  ///  as such.
+  /// \return Version of the component's last modification; 0 if the component doesn't belong to a registry.
+  std::uint64_t getChangeVersion() const noexcept { return m_changeVersion.load(std::memory_order_relaxed); }
+  /// Tells if the component has been modified after the given version, usually a system's last update (System::getLastUpdateVersion()).
+  /// \param version Version to compare the component's last modification with.
+  /// \return True if the component has been modified since the given version, false otherwise.
+  bool hasChangedSince(std::uint64_t version) const noexcept { return (getChangeVersion() > version); }
+  /// Marks the component as modified at the given version; this can be done concurrently, the highest version being kept.
+  /// \param version Version of the modification.
+  void markChanged(std::uint64_t version) noexcept {
+    std::uint64_t changeVersion = getChangeVersion();
+    while (changeVersion < version && !m_changeVersion.compare_exchange_weak(changeVersion, version, std::memory_order_relaxed)) {}
+  }
 
   virtual ~Component() = default;
 
 protected:
   Component() = default;
-  Component(const Component&) = default;
-  Component(Component&&) noexcept = default;
+  Component(const Component& component) noexcept : m_changeVersion{ component.getChangeVersion() } {}
+  Component(Component&& component) noexcept : Component(static_cast<const Component&>(component)) {}
 
-  Component& operator=(const Component&) = default;
-  Component& operator=(Component&&) noexcept = default;
+  Component& operator=(const Component& component) noexcept {
+    m_changeVersion.store(component.getChangeVersion(), std::memory_order_relaxed);
+    return *this;
+  }
+  Component& operator=(Component&& component) noexcept { return *this = static_cast<const Component&>(component); }
 
 private:
-  static inline std::size_t m_maxId = 0;
+  static inline std::atomic<std::size_t> m_maxId = 0;
+
+  std::atomic<std::uint64_t> m_changeVersion {};
 };
 
 } // namespace Raz
@@ -1,12 +1,20 @@
+#include <type_traits>
+
 namespace Raz {
 
 template <typename Comp>
 std::size_t Component::getId() {
   static_assert(std::is_base_of_v<Component, Comp>, "Error: Fetched component must be derived from Component.");
-  static_assert(!std::is_same_v<Component, Comp>, "Error: Fetched component must not be of specific type 'Component'.");
+  static_assert(!std::is_same_v<Component, std::remove_const_t<Comp>>, "Error: Fetched component must not be of specific type 'Component'.");
 
-  static const std::size_t id = m_maxId++;
-  return id;
+  // A constant component type shares the ID of its mutable counterpart, so that queries can only read some of their components
+  if constexpr (std::is_const_v<Comp>) {
+    return getId<std::remove_const_t<Comp>>();
+  } else {
+    // The local static is initialized only once, but different component types may be assigned their ID concurrently
+    static const std::size_t id = m_maxId.fetch_add(1, std::memory_order_relaxed);
+    return id;
+  }
 }
 
 } // namespace Raz
@@ -0,0 +1,136 @@
+#pragma once
+
+#ifndef RAZ_COMPONENTREGISTRY_HPP
+#define RAZ_COMPONENTREGISTRY_HPP
+
+#include "RaZ/Archetype.hpp"
+#include "RaZ/ComponentStorage.hpp"
+#include "RaZ/Query.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+namespace Raz {
+
+class Entity;
+
+/// ComponentRegistry class, owning the components of a World's entities & sorting these entities by archetype.
+/// Components are stored in chunks per type, where they keep their address; each enabled entity is referenced by the archetype matching
+///  its set of components.
+/// The queries made on the registry are cached, & updated whenever a new archetype appears.
+/// Entities which have been structurally modified are marked as dirty, so that only these are reevaluated by the World they belong to.
+class ComponentRegistry {
+public:
+  ComponentRegistry() = default;
+  ComponentRegistry(const ComponentRegistry&) = delete;
+  ComponentRegistry(ComponentRegistry&&) noexcept = delete;
+
+  const std::vector<ArchetypePtr>& getArchetypes() const noexcept { return m_archetypes; }
+  const std::vector<Entity*>& getDirtyEntities() const noexcept { return m_dirtyEntities; }
+  const std::vector<Entity*>& getDestroyedEntities() const noexcept { return m_destroyedEntities; }
+  /// Gets the current change version, with which the components are stamped when modified.
+  /// \return Current change version.
+  std::uint64_t getChangeVersion() const noexcept { return m_changeVersion.load(std::memory_order_relaxed); }
+
+  /// Tells if a storage exists for the given component type.
+  /// \tparam Comp Type of the component to be checked.
+  /// \return True if a component of the given type has already been created, false otherwise.
+  template <typename Comp> bool hasStorage() const;
+  /// Gets the storage of the given component type.
+  /// This storage must exist. If not, an exception is thrown.
+  /// \tparam Comp Type of the component to get the storage of.
+  /// \return Reference to the storage.
+  template <typename Comp> const ComponentStorage<Comp>& getStorage() const;
+  /// Creates a component in the storage of its type.
+  /// \tparam Comp Type of the component to be created.
+  /// \tparam Args Types of the arguments to be forwarded to the component.
+  /// \param args Arguments to be forwarded to the component.
+  /// \return Owning pointer to the component, which gives it back to its storage once destroyed.
+  template <typename Comp, typename... Args> ComponentPtr createComponent(Args&&... args);
+  /// Creates several copies of a component at once in the storage of its type, allocating the required memory beforehand.
+  /// \tparam Comp Type of the components to be created.
+  /// \param prototype Component to be copied.
+  /// \param count Amount of copies to be created.
+  /// \return Owning pointers to the components, which give them back to their storage once destroyed.
+  template <typename Comp> std::vector<ComponentPtr> createComponents(const Comp& prototype, std::size_t count);
+  /// Increments the change version, so that the components modified from now on are distinguished from the previous ones.
+  /// This is done at the end of each system's update; it can safely be called concurrently from several threads.
+  /// \return Change version before the increment.
+  std::uint64_t incrementChangeVersion() noexcept { return m_changeVersion.fetch_add(1, std::memory_order_relaxed); }
+  /// Gets the query matching the given components, creating it if it doesn't exist yet.
+  /// The returned reference stays valid as long as the registry exists, & can thus be kept to avoid looking the query up again.
+  /// \tparam Comps Types of the components to be queried.
+  /// \tparam ExcludedComps Types of the components that matched entities must not hold.
+  /// \return Reference to the query.
+  template <typename... Comps, typename... ExcludedComps> Query<Comps...>& query(Exclude<ExcludedComps...> = {});
+  /// Moves the given entity into the archetype matching its current enabled components & marks it as dirty.
+  /// If the entity is disabled, it is removed from any archetype.
+  /// \param entity Entity to be updated.
+  void updateEntity(Entity& entity);
+  /// Moves new entities, all holding the same components & having the same enabled state, into the archetype matching them at once & marks them as dirty.
+  /// This is equivalent to updating them one by one (see updateEntity()), but finds their archetype only once.
+  /// \param entities Entities to be added; must not belong to any archetype yet.
+  void addEntities(const std::vector<Entity*>& entities);
+  /// Marks the given entity as dirty, so that it is reevaluated by its World on the next refresh.
+  /// \param entity Entity to be marked.
+  void markDirty(Entity& entity);
+  /// Marks all the dirty entities as clean.
+  void clearDirtyEntities();
+  /// Marks the given entity to be destroyed by its World on the next refresh.
+  /// This can safely be called concurrently from several threads; an entity already marked is ignored.
+  /// \param entity Entity to be marked.
+  void markDestroyed(Entity& entity);
+  /// Forgets all the entities marked to be destroyed; these must have been destroyed beforehand.
+  void clearDestroyedEntities() noexcept { m_destroyedEntities.clear(); }
+  /// Removes the given entity from its archetype, if any.
+  /// \param entity Entity to be removed.
+  void removeEntity(Entity& entity);
+
+  ComponentRegistry& operator=(const ComponentRegistry&) = delete;
+  ComponentRegistry& operator=(ComponentRegistry&&) noexcept = delete;
+
+private:
+  /// Key identifying a cached query. Component IDs being unique per type & ordered like the query's template arguments, equal keys
+  ///  imply the same query type.
+  struct QueryKey {
+    bool operator==(const QueryKey& key) const noexcept {
+      return (componentIds == key.componentIds && excludedComponents == key.excludedComponents && constComponents == key.constComponents);
+    }
+
+    std::vector<std::size_t> componentIds {};
+    Bitset excludedComponents {};
+    Bitset constComponents {};
+  };
+
+  struct QueryKeyHasher {
+    std::size_t operator()(const QueryKey& key) const noexcept;
+  };
+
+  /// Gets the storage of the given component type, creating it if it doesn't exist yet.
+  /// \tparam Comp Type of the component to get the storage of.
+  /// \return Reference to the storage.
+  template <typename Comp> ComponentStorage<Comp>& recoverStorage();
+  /// Finds the archetype matching the given signature, creating it if it doesn't exist yet.
+  /// \param signature Signature of the archetype to recover; must not have any trailing disabled bit.
+  /// \return Reference to the found archetype.
+  Archetype& recoverArchetype(const Bitset& signature);
+
+  std::vector<std::unique_ptr<BaseComponentStorage>> m_storages {};
+  std::vector<ArchetypePtr> m_archetypes {};
+  std::unordered_map<Bitset, Archetype*> m_archetypesBySignature {};
+  std::vector<std::unique_ptr<BaseQuery>> m_queries {};
+  std::unordered_map<QueryKey, BaseQuery*, QueryKeyHasher> m_queriesByKey {};
+  std::atomic<std::uint64_t> m_changeVersion = 1; ///< Starts after 0, so that all components are considered modified before any update.
+
+  std::vector<Entity*> m_dirtyEntities {};
+
+  std::vector<Entity*> m_destroyedEntities {};
+  std::mutex m_destroyedEntitiesMutex {};
+};
+
+} // namespace Raz
+
+#include "RaZ/ComponentRegistry.inl"
+
+#endif // RAZ_COMPONENTREGISTRY_HPP
@@ -0,0 +1,94 @@
+#include <stdexcept>
+
+namespace Raz {
+
+template <typename Comp>
+bool ComponentRegistry::hasStorage() const {
+  static_assert(std::is_base_of_v<Component, Comp>, "Error: Checked component must be derived from Component.");
+
+  const std::size_t compId = Component::getId<Comp>();
+  return ((compId < m_storages.size()) && m_storages[compId]);
+}
+
+template <typename Comp>
+const ComponentStorage<Comp>& ComponentRegistry::getStorage() const {
+  static_assert(std::is_base_of_v<Component, Comp>, "Error: Fetched component must be derived from Component.");
+
+  if (hasStorage<Comp>())
+    return static_cast<const ComponentStorage<Comp>&>(*m_storages[Component::getId<Comp>()]);
+
+  throw std::runtime_error("Error: No storage available for the specified component type");
+}
+
+template <typename Comp, typename... Args>
+ComponentPtr ComponentRegistry::createComponent(Args&&... args) {
+  static_assert(std::is_base_of_v<Component, Comp>, "Error: Created component must be derived from Component.");
+
+  ComponentStorage<Comp>& storage = recoverStorage<Comp>();
+
+  Comp& component = storage.emplace(std::forward<Args>(args)...);
+  component.markChanged(getChangeVersion());
+
+  return ComponentPtr(&component, ComponentDeleter{ &storage });
+}
+
+template <typename Comp>
+std::vector<ComponentPtr> ComponentRegistry::createComponents(const Comp& prototype, std::size_t count) {
+  static_assert(std::is_base_of_v<Component, Comp>, "Error: Created components must be derived from Component.");
+  static_assert(std::is_copy_constructible_v<Comp>, "Error: Components created from a prototype must be copy-constructible.");
+
+  ComponentStorage<Comp>& storage = recoverStorage<Comp>();
+  storage.reserve(storage.getComponentCount() + count);
+
+  const std::uint64_t changeVersion = getChangeVersion();
+
+  std::vector<ComponentPtr> components;
+  components.reserve(count);
+
+  for (std::size_t compIndex = 0; compIndex < count; ++compIndex) {
+    Comp& component = storage.emplace(prototype);
+    component.markChanged(changeVersion);
+
+    components.emplace_back(&component, ComponentDeleter{ &storage });
+  }
+
+  return components;
+}
+
+template <typename... Comps, typename... ExcludedComps>
+Query<Comps...>& ComponentRegistry::query(Exclude<ExcludedComps...>) {
+  static_assert((std::is_base_of_v<Component, ExcludedComps> && ...), "Error: Excluded components must be derived from Component.");
+
+  QueryKey key { { Component::getId<Comps>()... }, {}, Query<Comps...>::computeConstComponents() };
+  (key.excludedComponents.setBit(Component::getId<ExcludedComps>()), ...);
+
+  const auto queryIt = m_queriesByKey.find(key);
+
+  if (queryIt != m_queriesByKey.end())
+    return static_cast<Query<Comps...>&>(*queryIt->second);
+
+  m_queries.emplace_back(std::make_unique<Query<Comps...>>(key.excludedComponents, m_changeVersion));
+
+  auto& query = static_cast<Query<Comps...>&>(*m_queries.back());
+  m_queriesByKey.emplace(std::move(key), &query);
+
+  for (const ArchetypePtr& archetype : m_archetypes)
+    query.addArchetype(*archetype);
+
+  return query;
+}
+
+template <typename Comp>
+ComponentStorage<Comp>& ComponentRegistry::recoverStorage() {
+  const std::size_t compId = Component::getId<Comp>();
+
+  if (compId >= m_storages.size())
+    m_storages.resize(compId + 1);
+
+  if (!m_storages[compId])
+    m_storages[compId] = std::make_unique<ComponentStorage<Comp>>();
+
+  return static_cast<ComponentStorage<Comp>&>(*m_storages[compId]);
+}
+
+} // namespace Raz
@@ -0,0 +1,70 @@
+#pragma once
+
+#ifndef RAZ_COMPONENTSTORAGE_HPP
+#define RAZ_COMPONENTSTORAGE_HPP
+
+#include "RaZ/Component.hpp"
+#include "RaZ/Utils/ObjectPool.hpp"
+
+namespace Raz {
+
+/// Type-erased base of a ComponentStorage, allowing components to be given back to their storage without knowing their actual type.
+class BaseComponentStorage {
+public:
+  BaseComponentStorage(const BaseComponentStorage&) = delete;
+  BaseComponentStorage(BaseComponentStorage&&) noexcept = delete;
+
+  /// Destroys the given component & makes its slot available for a future one.
+  /// \param component Component to be destroyed; must have been created by this storage.
+  virtual void destroy(Component& component) noexcept = 0;
+
+  BaseComponentStorage& operator=(const BaseComponentStorage&) = delete;
+  BaseComponentStorage& operator=(BaseComponentStorage&&) noexcept = delete;
+
+  virtual ~BaseComponentStorage() = default;
+
+protected:
+  BaseComponentStorage() = default;
+};
+
+/// ComponentStorage class, holding all the components of a given type contiguously in fixed-size chunks.
+/// Chunks are never reallocated, so that a component created by a storage keeps the same address for its whole lifetime.
+/// \see ObjectPool
+/// \tparam Comp Type of the components to be stored.
+template <typename Comp>
+class ComponentStorage final : public BaseComponentStorage {
+  static_assert(std::is_base_of_v<Component, Comp>, "Error: Stored component must be derived from Component.");
+
+public:
+  /// Amount of components held by a single chunk, chosen so that a chunk spans roughly 16 KiB.
+  static constexpr std::size_t ChunkCapacity = ObjectPool<Comp>::ChunkCapacity;
+
+  ComponentStorage() = default;
+
+  std::size_t getComponentCount() const noexcept { return m_pool.getObjectCount(); }
+  std::size_t getChunkCount() const noexcept { return m_pool.getChunkCount(); }
+  /// Gets the pool in which the components are stored, giving access to its occupancy & fragmentation.
+  /// \return Constant reference to the components' pool.
+  const ObjectPool<Comp>& getPool() const noexcept { return m_pool; }
+
+  /// Allocates enough chunks to hold the given amount of components without any further allocation.
+  /// \param componentCount Amount of components to reserve slots for.
+  void reserve(std::size_t componentCount) { m_pool.reserve(componentCount); }
+  /// Constructs a component in the first available slot.
+  /// \tparam Args Types of the arguments to be forwarded to the component.
+  /// \param args Arguments to be forwarded to the component.
+  /// \return Reference to the newly created component.
+  template <typename... Args> Comp& emplace(Args&&... args) { return m_pool.emplace(std::forward<Args>(args)...); }
+  /// Destroys the given component & makes its slot available for a future one.
+  /// \param component Component to be destroyed; must have been created by this storage.
+  void destroy(Component& component) noexcept override { m_pool.destroy(static_cast<Comp&>(component)); }
+
+  ~ComponentStorage() override = default;
+
+private:
+  ObjectPool<Comp> m_pool {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_COMPONENTSTORAGE_HPP
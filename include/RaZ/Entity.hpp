@@ -4,8 +4,12 @@
 #define RAZ_ENTITY_HPP
 
 #include "RaZ/Component.hpp"
+#include "RaZ/ComponentRegistry.hpp"
 #include "RaZ/Utils/Bitset.hpp"
+#include "RaZ/Utils/ObjectPool.hpp"
 
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <vector>
@@ -13,19 +17,52 @@
 namespace Raz {
 
 class Entity;
-using EntityPtr = std::unique_ptr<Entity>;
+
+/// Deleter of an EntityPtr, giving the entity back to the pool it has been created from if any.
+struct EntityDeleter {
+  void operator()(Entity* entity) const noexcept;
+
+  ObjectPool<Entity>* pool = nullptr; ///< Pool the entity belongs to; if null, the entity has been allocated on its own.
+};
+
+using EntityPtr = std::unique_ptr<Entity, EntityDeleter>;
+
+class World;
+
+/// EntityHandle structure, referencing an entity of a World without pointing to it.
+/// Its generation allows to detect that the entity has been destroyed, even if its index has been reused by another one since then.
+struct EntityHandle {
+  std::size_t index = std::numeric_limits<std::size_t>::max();
+  std::uint32_t generation {};
+
+  bool operator==(const EntityHandle& handle) const noexcept { return (index == handle.index && generation == handle.generation); }
+  bool operator!=(const EntityHandle& handle) const noexcept { return !(*this == handle); }
+};
 
 /// Entity class representing an aggregate of Component objects.
 class Entity {
 public:
   explicit Entity(std::size_t index, bool enabled = true) : m_id{ index }, m_enabled{ enabled } {}
+  /// Creates an entity whose components are stored in the given registry, usually owned by a World.
+  /// \param index Index of the entity.
+  /// \param registry Registry in which to create the entity's components & to reference the entity by archetype.
+  /// \param enabled True if the entity should be active immediately, false otherwise.
+  Entity(std::size_t index, ComponentRegistry& registry, bool enabled = true);
+  Entity(const Entity&) = delete;
+  Entity(Entity&&) noexcept = delete;
 
   std::size_t getId() const { return m_id; }
+  /// Gets a handle to the entity, which can be checked by its World to know if the entity still exists.
+  /// \return Handle to the entity.
+  EntityHandle getHandle() const noexcept { return EntityHandle{ m_id, m_generation }; }
   bool isEnabled() const { return m_enabled; }
   const std::vector<ComponentPtr>& getComponents() const { return m_components; }
   const Bitset& getEnabledComponents() const { return m_enabledComponents; }
+  const Archetype* getArchetype() const { return m_archetype; }
+  bool isDirty() const { return m_isDirty; }
+  bool isPendingDestruction() const { return m_isPendingDestruction; }
 
-  template <typename... Args> static EntityPtr create(Args&&... args) { return std::make_unique<Entity>(std::forward<Args>(args)...); }
+  template <typename... Args> static EntityPtr create(Args&&... args) { return EntityPtr(new Entity(std::forward<Args>(args)...)); }
 
   /// Tells if a given component is held by the entity.
   /// \tparam Comp Type of the component to be checked.
@@ -38,9 +75,16 @@ public:
   template <typename Comp> const Comp& getComponent() const;
   /// Gets a given component held by the entity.
   /// The entity must have this component. If not, an exception is thrown.
+  /// \note The component isn't marked as modified; if the changes must be tracked (see Component::hasChangedSince()), use
+  ///  getMutableComponent() instead.
   /// \tparam Comp Type of the component to be fetched.
   /// \return Reference to the found component.
   template <typename Comp> Comp& getComponent() { return const_cast<Comp&>(static_cast<const Entity*>(this)->getComponent<Comp>()); }
+  /// Gets a given component held by the entity to modify it, marking it as such (see Component::hasChangedSince()).
+  /// The entity must have this component. If not, an exception is thrown.
+  /// \tparam Comp Type of the component to be fetched.
+  /// \return Reference to the found component.
+  template <typename Comp> Comp& getMutableComponent();
   /// Adds a component to be held by the entity.
   /// \tparam Comp Type of the component to be added.
   /// \tparam Args Types of the arguments to be forwarded to the given component.
@@ -63,18 +107,32 @@ public:
   /// Changes the entity's enabled state.
   /// Enables or disables the entity according to the given parameter.
   /// \param enabled True if the entity should be enabled, false if it should be disabled.
-  void enable(bool enabled = true) { m_enabled = enabled; }
+  void enable(bool enabled = true);
   /// Disables the entity.
   void disable() { enable(false); }
 
+  Entity& operator=(const Entity&) = delete;
+  Entity& operator=(Entity&&) noexcept = delete;
+
 protected:
   Entity() = default;
 
 private:
+  friend Archetype;
+  friend ComponentRegistry;
+  friend World;
+
   std::size_t m_id {};
+  std::uint32_t m_generation {};
   bool m_enabled {};
   std::vector<ComponentPtr> m_components {};
   Bitset m_enabledComponents {};
+
+  ComponentRegistry* m_registry {};
+  Archetype* m_archetype {};
+  std::size_t m_archetypeIndex {};
+  bool m_isDirty {}; ///< True if the entity has been structurally modified since the last refresh of its World, false otherwise.
+  bool m_isPendingDestruction {}; ///< True if the entity is to be destroyed on the next refresh of its World, false otherwise.
 };
 
 } // namespace Raz
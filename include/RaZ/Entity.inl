@@ -18,6 +18,16 @@ const Comp& Entity::getComponent() const {
   throw std::runtime_error("Error: No component available of specified type");
 }
 
+template <typename Comp>
+Comp& Entity::getMutableComponent() {
+  auto& component = getComponent<Comp>();
+
+  if (m_registry)
+    component.markChanged(m_registry->getChangeVersion());
+
+  return component;
+}
+
 template <typename Comp, typename... Args>
 Comp& Entity::addComponent(Args&&... args) {
   static_assert(std::is_base_of_v<Component, Comp>, "Error: Added component must be derived from Component.");
@@ -27,9 +37,16 @@ Comp& Entity::addComponent(Args&&... args) {
   if (compId >= m_components.size())
     m_components.resize(compId + 1);
 
-  m_components[compId] = std::make_unique<Comp>(std::forward<Args>(args)...);
+  if (m_registry)
+    m_components[compId] = m_registry->createComponent<Comp>(std::forward<Args>(args)...);
+  else
+    m_components[compId] = ComponentPtr(new Comp(std::forward<Args>(args)...));
+
   m_enabledComponents.setBit(compId);
 
+  if (m_registry)
+    m_registry->updateEntity(*this);
+
   return static_cast<Comp&>(*m_components[compId]);
 }
 
@@ -56,6 +73,9 @@ void Entity::removeComponent() {
 
     m_components[compId].reset();
     m_enabledComponents.setBit(compId, false);
+
+    if (m_registry)
+      m_registry->updateEntity(*this);
   }
 }
 
@@ -0,0 +1,113 @@
+#pragma once
+
+#ifndef RAZ_ENTITYCOMMANDBUFFER_HPP
+#define RAZ_ENTITYCOMMANDBUFFER_HPP
+
+#include "RaZ/Entity.hpp"
+
+#include <functional>
+#include <vector>
+
+namespace Raz {
+
+class World;
+
+/// Entity to be created when an EntityCommandBuffer is played back; it can be referenced by the commands recorded after it in the same buffer.
+struct DeferredEntity {
+  std::size_t index {}; ///< Position of the entity among the ones created by the buffer.
+};
+
+/// EntityCommandBuffer class, recording structural changes to be made on a World's entities & applying them all at once later.
+/// Recording commands never modifies the world, so that it can be done while systems iterate over entities. A buffer must however be
+///  recorded into by a single thread at a time; World::getCommandBuffer() gives a separate buffer to each thread.
+class EntityCommandBuffer {
+public:
+  EntityCommandBuffer() = default;
+  EntityCommandBuffer(const EntityCommandBuffer&) = delete;
+  EntityCommandBuffer(EntityCommandBuffer&&) noexcept = default;
+
+  std::size_t getCommandCount() const noexcept { return m_commands.size(); }
+  bool isEmpty() const noexcept { return m_commands.empty(); }
+
+  /// Records the creation of an entity.
+  /// \param enabled True if the entity should be enabled once created, false otherwise.
+  /// \return Entity to be created, which can be given to the next commands of this buffer.
+  DeferredEntity createEntity(bool enabled = true);
+  /// Records the destruction of an entity. If the entity doesn't exist anymore on playback, nothing is done.
+  /// \param entity Handle to the entity to be destroyed.
+  void destroyEntity(EntityHandle entity) { m_commands.emplace_back(Command{ CommandType::DESTROY, Target(entity) }); }
+  /// Records the destruction of an entity created by this buffer.
+  /// \param entity Entity to be destroyed.
+  void destroyEntity(DeferredEntity entity) { m_commands.emplace_back(Command{ CommandType::DESTROY, Target(entity) }); }
+  /// Records a change of an entity's enabled state. If the entity doesn't exist anymore on playback, nothing is done.
+  /// \param entity Handle to the entity to be enabled or disabled.
+  /// \param enabled True if the entity should be enabled, false if it should be disabled.
+  void enableEntity(EntityHandle entity, bool enabled = true) { m_commands.emplace_back(Command{ CommandType::ENABLE, Target(entity), enabled }); }
+  /// Records a change of the enabled state of an entity created by this buffer.
+  /// \param entity Entity to be enabled or disabled.
+  /// \param enabled True if the entity should be enabled, false if it should be disabled.
+  void enableEntity(DeferredEntity entity, bool enabled = true) { m_commands.emplace_back(Command{ CommandType::ENABLE, Target(entity), enabled }); }
+  /// Records the addition of a component to an entity. If the entity doesn't exist anymore on playback, nothing is done.
+  /// \tparam Comp Type of the component to be added.
+  /// \tparam Args Types of the arguments to be forwarded to the component.
+  /// \param entity Handle to the entity to add the component to.
+  /// \param args Arguments to be forwarded to the component; they are stored until the buffer is played back.
+  template <typename Comp, typename... Args> void addComponent(EntityHandle entity, Args&&... args);
+  /// Records the addition of a component to an entity created by this buffer.
+  /// \tparam Comp Type of the component to be added.
+  /// \tparam Args Types of the arguments to be forwarded to the component.
+  /// \param entity Entity to add the component to.
+  /// \param args Arguments to be forwarded to the component; they are stored until the buffer is played back.
+  template <typename Comp, typename... Args> void addComponent(DeferredEntity entity, Args&&... args);
+  /// Records the removal of a component from an entity. If the entity doesn't exist anymore on playback, nothing is done.
+  /// \tparam Comp Type of the component to be removed.
+  /// \param entity Handle to the entity to remove the component from.
+  template <typename Comp> void removeComponent(EntityHandle entity);
+  /// Records the removal of a component from an entity created by this buffer.
+  /// \tparam Comp Type of the component to be removed.
+  /// \param entity Entity to remove the component from.
+  template <typename Comp> void removeComponent(DeferredEntity entity);
+  /// Applies all the recorded commands to the given world, in the order they have been recorded, then clears the buffer.
+  /// If a command throws, the following ones are not applied; the buffer is cleared all the same before the exception is propagated.
+  /// \param world World to apply the commands to.
+  void playback(World& world);
+  /// Removes all the recorded commands.
+  void clear() noexcept;
+
+  EntityCommandBuffer& operator=(const EntityCommandBuffer&) = delete;
+  EntityCommandBuffer& operator=(EntityCommandBuffer&&) noexcept = default;
+
+private:
+  enum class CommandType : uint8_t {
+    CREATE,
+    DESTROY,
+    ENABLE,
+    MODIFY
+  };
+
+  /// Entity targeted by a command, either referenced by a handle or created by the buffer.
+  struct Target {
+    Target() = default;
+    explicit Target(EntityHandle entityHandle) : handle{ entityHandle } {}
+    explicit Target(DeferredEntity entity) : handle{ entity.index, 0 }, isDeferred{ true } {}
+
+    EntityHandle handle {};
+    bool isDeferred {};
+  };
+
+  struct Command {
+    CommandType type {};
+    Target target {};
+    bool enabled {};
+    std::function<void(Entity&)> modification {};
+  };
+
+  std::vector<Command> m_commands {};
+  std::size_t m_deferredEntityCount {};
+};
+
+} // namespace Raz
+
+#include "RaZ/EntityCommandBuffer.inl"
+
+#endif // RAZ_ENTITYCOMMANDBUFFER_HPP
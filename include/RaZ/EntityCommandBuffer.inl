@@ -0,0 +1,57 @@
+#include <memory>
+#include <tuple>
+
+namespace Raz {
+
+namespace EntityCommandBufferUtils {
+
+template <typename Comp, typename... Args>
+std::function<void(Entity&)> makeComponentAddition(Args&&... args) {
+  static_assert(std::is_base_of_v<Component, Comp>, "Error: Added component must be derived from Component.");
+
+  // The arguments are shared so that the function stays copyable even if they are move-only; they are moved into the component on playback
+  auto arguments = std::make_shared<std::tuple<std::decay_t<Args>...>>(std::forward<Args>(args)...);
+
+  return [arguments = std::move(arguments)] (Entity& entity) {
+    std::apply([&entity] (auto&&... componentArgs) {
+      entity.addComponent<Comp>(std::move(componentArgs)...);
+    }, std::move(*arguments));
+  };
+}
+
+template <typename Comp>
+std::function<void(Entity&)> makeComponentRemoval() {
+  static_assert(std::is_base_of_v<Component, Comp>, "Error: Removed component must be derived from Component.");
+
+  return [] (Entity& entity) { entity.removeComponent<Comp>(); };
+}
+
+} // namespace EntityCommandBufferUtils
+
+template <typename Comp, typename... Args>
+void EntityCommandBuffer::addComponent(EntityHandle entity, Args&&... args) {
+  m_commands.emplace_back(Command{ CommandType::MODIFY,
+                                   Target(entity),
+                                   false,
+                                   EntityCommandBufferUtils::makeComponentAddition<Comp>(std::forward<Args>(args)...) });
+}
+
+template <typename Comp, typename... Args>
+void EntityCommandBuffer::addComponent(DeferredEntity entity, Args&&... args) {
+  m_commands.emplace_back(Command{ CommandType::MODIFY,
+                                   Target(entity),
+                                   false,
+                                   EntityCommandBufferUtils::makeComponentAddition<Comp>(std::forward<Args>(args)...) });
+}
+
+template <typename Comp>
+void EntityCommandBuffer::removeComponent(EntityHandle entity) {
+  m_commands.emplace_back(Command{ CommandType::MODIFY, Target(entity), false, EntityCommandBufferUtils::makeComponentRemoval<Comp>() });
+}
+
+template <typename Comp>
+void EntityCommandBuffer::removeComponent(DeferredEntity entity) {
+  m_commands.emplace_back(Command{ CommandType::MODIFY, Target(entity), false, EntityCommandBufferUtils::makeComponentRemoval<Comp>() });
+}
+
+} // namespace Raz
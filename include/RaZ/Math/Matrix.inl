@@ -1,3 +1,4 @@
+#include "RaZ/Math/Simd.hpp"
 #include "RaZ/Utils/FloatUtils.hpp"
 
 #include <algorithm>
@@ -242,6 +243,15 @@ template <typename T, std::size_t W, std::size_t H>
 constexpr Matrix<T, H, W> Matrix<T, W, H>::transpose() const noexcept {
   Matrix<T, H, W> res;
 
+#if defined(RAZ_SIMD_SSE)
+  if constexpr (std::is_same_v<T, float> && W == 4 && H == 4) {
+    if (!Simd::isConstantEvaluated()) {
+      Simd::transposeMatrix(m_data.data(), res.getDataPtr());
+      return res;
+    }
+  }
+#endif
+
   for (std::size_t heightIndex = 0; heightIndex < H; ++heightIndex) {
     for (std::size_t widthIndex = 0; widthIndex < W; ++widthIndex)
       res[widthIndex * H + heightIndex] = m_data[heightIndex * W + widthIndex];
@@ -261,6 +271,16 @@ template <typename T, std::size_t W, std::size_t H>
 constexpr Matrix<T, W, H> Matrix<T, W, H>::inverse() const {
   static_assert(W == H, "Error: Matrix must be a square one.");
 
+#if defined(RAZ_SIMD_SSE)
+  if constexpr (std::is_same_v<T, float> && W == 4) {
+    if (!Simd::isConstantEvaluated()) {
+      Matrix<T, W, H> res;
+      Simd::inverseMatrix(m_data.data(), res.getDataPtr());
+      return res;
+    }
+  }
+#endif
+
   return computeMatrixInverse(*this, computeMatrixDeterminant(*this));
 }
 
@@ -350,6 +370,15 @@ constexpr Vector<T, H> Matrix<T, W, H>::operator*(const Vector<T, H>& vec) const
   // This multiplication is made assuming the vector to be vertical
   Vector<T, H> res {};
 
+#if defined(RAZ_SIMD_SSE)
+  if constexpr (std::is_same_v<T, float> && W == 4 && H == 4) {
+    if (!Simd::isConstantEvaluated()) {
+      Simd::multiplyMatrixVector(m_data.data(), vec.getDataPtr(), res.getDataPtr());
+      return res;
+    }
+  }
+#endif
+
   for (std::size_t heightIndex = 0; heightIndex < H; ++heightIndex) {
     for (std::size_t widthIndex = 0; widthIndex < W; ++widthIndex)
       res[heightIndex] += m_data[heightIndex * W + widthIndex] * vec[widthIndex];
@@ -365,6 +394,15 @@ constexpr Matrix<T, H, WI> Matrix<T, W, H>::operator*(const Matrix<T, WI, HI>& m
 
   Matrix<T, H, WI> res {};
 
+#if defined(RAZ_SIMD_SSE)
+  if constexpr (std::is_same_v<T, float> && W == 4 && H == 4 && WI == 4) {
+    if (!Simd::isConstantEvaluated()) {
+      Simd::multiplyMatrices(m_data.data(), mat.getDataPtr(), res.getDataPtr());
+      return res;
+    }
+  }
+#endif
+
   for (std::size_t heightIndex = 0; heightIndex < H; ++heightIndex) {
     for (std::size_t widthIndex = 0; widthIndex < W; ++widthIndex) {
       T& val = res.getData()[heightIndex * W + widthIndex];
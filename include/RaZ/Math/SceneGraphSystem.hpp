@@ -0,0 +1,69 @@
+#pragma once
+
+#ifndef RAZ_SCENEGRAPHSYSTEM_HPP
+#define RAZ_SCENEGRAPHSYSTEM_HPP
+
+#include "RaZ/System.hpp"
+
+namespace Raz {
+
+class SceneNode;
+
+/// SceneGraphSystem class, computing the world matrices of the entities holding a SceneNode.
+/// The hierarchies are flattened in breadth-first order, each one occupying a contiguous range so that parents are always processed
+///  before their children; this order is only rebuilt when one of the system's own hierarchies changes. A node's matrices are recomputed
+///  only if its Transform has changed since the last update or if its parent's world matrix has been recomputed; an entity without a
+///  Transform is considered placed at its parent's origin. Independent hierarchies are processed in parallel when there are enough nodes.
+/// Only the nodes whose entities are linked to the system are updated, along with their descendants.
+class SceneGraphSystem final : public System {
+public:
+  SceneGraphSystem();
+
+  /// Gets the amount of nodes processed on each update, in the order they are updated.
+  /// \return Amount of nodes in all the hierarchies linked to the system.
+  std::size_t getNodeCount() const noexcept { return m_nodes.size(); }
+  /// Gets the amount of independent hierarchies, each being a tree starting from a root node.
+  /// \return Amount of hierarchies.
+  std::size_t getHierarchyCount() const noexcept { return (m_hierarchyOffsets.empty() ? 0 : m_hierarchyOffsets.size() - 1); }
+  /// Gets the amount of nodes from which the hierarchies are processed in parallel.
+  /// \return Minimal amount of nodes for a parallel update.
+  std::size_t getParallelThreshold() const noexcept { return m_parallelThreshold; }
+
+  /// Sets the amount of nodes from which the hierarchies are processed in parallel. Below it, they are all processed on the calling thread.
+  /// \param parallelThreshold Minimal amount of nodes for a parallel update.
+  void setParallelThreshold(std::size_t parallelThreshold) noexcept { m_parallelThreshold = parallelThreshold; }
+
+  void linkEntity(Entity& entity) override;
+  void unlinkEntity(Entity& entity) override;
+  bool update(float deltaTime) override;
+
+private:
+  struct NodeEntry {
+    const Entity* entity;
+    SceneNode* node;
+    std::size_t parentIndex; ///< Index of the parent's entry; equal to the node's own index if it is a root.
+    bool hasTransform; ///< True if the entity held a Transform during the last update.
+    bool isWorldMatrixUpdated; ///< True if the world matrix has been recomputed during the current update.
+  };
+
+  /// Checks if any linked node has been attached to or detached from a parent since the hierarchies have last been flattened.
+  /// \return True if the hierarchies must be flattened again, false otherwise.
+  bool isHierarchyModified() const;
+  /// Flattens the hierarchies of the linked nodes, each one being stored contiguously in breadth-first order.
+  void rebuildOrder();
+  /// Updates the matrices of the nodes in the given range of hierarchies.
+  /// \param firstHierarchyIndex Index of the first hierarchy to be updated.
+  /// \param lastHierarchyIndex Index past the last hierarchy to be updated.
+  /// \param forceUpdate True if all the matrices must be recomputed, false if only those which have changed must be.
+  void updateHierarchies(std::size_t firstHierarchyIndex, std::size_t lastHierarchyIndex, bool forceUpdate);
+
+  std::vector<NodeEntry> m_nodes {};
+  std::vector<std::size_t> m_hierarchyOffsets {}; ///< Index of the first node of each hierarchy, followed by the total node count.
+  std::uint64_t m_hierarchyRevision {}; ///< Latest hierarchy revision when the hierarchies have last been flattened.
+  bool m_isOrderDirty = true;
+  std::size_t m_parallelThreshold = 1024;
+};
+
+} // namespace Raz
+
+#endif // RAZ_SCENEGRAPHSYSTEM_HPP
@@ -0,0 +1,71 @@
+#pragma once
+
+#ifndef RAZ_SCENENODE_HPP
+#define RAZ_SCENENODE_HPP
+
+#include "RaZ/Component.hpp"
+#include "RaZ/Math/Matrix.hpp"
+
+#include <atomic>
+#include <vector>
+
+namespace Raz {
+
+class SceneGraphSystem;
+
+/// SceneNode class, placing its entity in a hierarchy so that it is transformed relatively to its parent.
+/// Unlike a generic GraphNode, a scene node has at most one parent. Its local & world matrices are cached, & only recomputed by the
+///  SceneGraphSystem when the entity's Transform or any of its ancestors' has changed.
+/// The hierarchy must not be modified concurrently; a destroyed node detaches itself from its parent & its children become roots.
+class SceneNode final : public Component {
+  friend SceneGraphSystem;
+
+public:
+  SceneNode() = default;
+  SceneNode(const SceneNode&) = delete;
+  SceneNode(SceneNode&&) noexcept = delete;
+
+  const std::vector<SceneNode*>& getChildren() const noexcept { return m_children; }
+  bool isRoot() const noexcept { return (m_parent == nullptr); }
+  const SceneNode* getParent() const noexcept { return m_parent; }
+  SceneNode* getParent() noexcept { return m_parent; }
+  /// Gets the matrix transforming the entity relatively to its parent, as of the last update of the SceneGraphSystem.
+  /// \return Local transformation matrix.
+  const Mat4f& getLocalMatrix() const noexcept { return m_localMatrix; }
+  /// Gets the matrix transforming the entity in world space, as of the last update of the SceneGraphSystem.
+  /// \return World transformation matrix.
+  const Mat4f& getWorldMatrix() const noexcept { return m_worldMatrix; }
+
+  /// Attaches the node to the given parent, detaching it from its current one if any.
+  /// \param parent New parent of the node; must neither be the node itself nor one of its descendants.
+  void setParent(SceneNode& parent);
+  /// Attaches the given node as a child of the current one.
+  /// \param child Node to be attached; must neither be the node itself nor one of its ancestors.
+  void addChild(SceneNode& child) { child.setParent(*this); }
+  /// Detaches the node from its parent, making it a root. If the node has no parent, nothing is done.
+  void detach();
+
+  SceneNode& operator=(const SceneNode&) = delete;
+  SceneNode& operator=(SceneNode&&) noexcept = delete;
+
+  ~SceneNode() override;
+
+private:
+  /// Gets the latest revision given to a node whose parent has changed; revisions only serve to order the modifications.
+  /// \return Current hierarchy revision.
+  static std::uint64_t getHierarchyRevision() noexcept { return m_hierarchyRevision.load(std::memory_order_relaxed); }
+  /// Marks the node's parent as changed, giving it a new revision.
+  void markParentChanged() noexcept { m_parentRevision = m_hierarchyRevision.fetch_add(1, std::memory_order_relaxed) + 1; }
+
+  static inline std::atomic<std::uint64_t> m_hierarchyRevision = 0;
+
+  SceneNode* m_parent {};
+  std::uint64_t m_parentRevision {}; ///< Revision at which the node has last been attached or detached, or at which its parent was destroyed.
+  std::vector<SceneNode*> m_children {};
+  Mat4f m_localMatrix = Mat4f::identity();
+  Mat4f m_worldMatrix = Mat4f::identity();
+};
+
+} // namespace Raz
+
+#endif // RAZ_SCENENODE_HPP
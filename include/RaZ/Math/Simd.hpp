@@ -0,0 +1,192 @@
+#pragma once
+
+#ifndef RAZ_SIMD_HPP
+#define RAZ_SIMD_HPP
+
+// SSE is used when the target supports it; enabling AVX in the compiler's flags (such as -mavx or /arch:AVX) makes the same functions
+//  use its VEX-encoded instructions. Defining RAZ_NO_SIMD forces the generic implementations to be used everywhere
+#if !defined(RAZ_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define RAZ_SIMD_SSE
+#include <xmmintrin.h>
+#endif
+
+#include <cstddef>
+
+// Whether the compiler can tell if a function is evaluated at compile time; if not, the SIMD functions are also used in constant
+//  expressions, in which 4x4 single-precision matrices & vectors can then not be multiplied, transposed or inverted
+#if defined(__clang__) || defined(__GNUC__)
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define RAZ_CONSTANT_EVALUATION_DETECTABLE
+#endif
+#elif !defined(__clang__) && __GNUC__ >= 9
+#define RAZ_CONSTANT_EVALUATION_DETECTABLE
+#endif
+#elif defined(_MSC_VER) && _MSC_VER >= 1925
+#define RAZ_CONSTANT_EVALUATION_DETECTABLE
+#endif
+
+namespace Raz::Simd {
+
+/// Checks if the calling function is being evaluated at compile time, in which case no SIMD instruction can be used.
+/// \return True if evaluated in a constant expression; always false if the compiler can't tell.
+constexpr bool isConstantEvaluated() noexcept {
+#if defined(RAZ_CONSTANT_EVALUATION_DETECTABLE)
+  return __builtin_is_constant_evaluated();
+#else
+  return false;
+#endif
+}
+
+#if defined(RAZ_SIMD_SSE)
+
+// The functions below give results identical to the bit to those of the generic implementations: every element is computed with the
+//  same operations, in the same order, with no fused multiply-add. This does not hold if the compiler is allowed to contract the generic
+//  implementations' operations into FMA instructions (for example with -march=native & GCC's default -ffp-contract=fast)
+// The matrices are 4x4 single-precision ones, stored row by row
+
+/// Multiplies two matrices.
+/// \param lhs Left-hand side matrix's elements.
+/// \param rhs Right-hand side matrix's elements.
+/// \param res Resulting matrix's elements.
+inline void multiplyMatrices(const float* lhs, const float* rhs, float* res) noexcept {
+  // Each result row is the sum of the right-hand side's rows, weighted by the left-hand side's row elements. The sums start from 0
+  //  like the generic implementation, which matters for the sign of zero results
+  const __m128 rhsRow0 = _mm_loadu_ps(rhs);
+  const __m128 rhsRow1 = _mm_loadu_ps(rhs + 4);
+  const __m128 rhsRow2 = _mm_loadu_ps(rhs + 8);
+  const __m128 rhsRow3 = _mm_loadu_ps(rhs + 12);
+
+  for (std::size_t rowIndex = 0; rowIndex < 4; ++rowIndex) {
+    const float* lhsRow = lhs + rowIndex * 4;
+
+    __m128 resRow = _mm_setzero_ps();
+    resRow = _mm_add_ps(resRow, _mm_mul_ps(_mm_set1_ps(lhsRow[0]), rhsRow0));
+    resRow = _mm_add_ps(resRow, _mm_mul_ps(_mm_set1_ps(lhsRow[1]), rhsRow1));
+    resRow = _mm_add_ps(resRow, _mm_mul_ps(_mm_set1_ps(lhsRow[2]), rhsRow2));
+    resRow = _mm_add_ps(resRow, _mm_mul_ps(_mm_set1_ps(lhsRow[3]), rhsRow3));
+
+    _mm_storeu_ps(res + rowIndex * 4, resRow);
+  }
+}
+
+/// Multiplies a matrix by a vertical vector.
+/// \param mat Matrix's elements.
+/// \param vec Vector's elements.
+/// \param res Resulting vector's elements.
+inline void multiplyMatrixVector(const float* mat, const float* vec, float* res) noexcept {
+  // Transposing the matrix gives its columns, which summed & weighted by the vector's elements give the result
+  __m128 column0 = _mm_loadu_ps(mat);
+  __m128 column1 = _mm_loadu_ps(mat + 4);
+  __m128 column2 = _mm_loadu_ps(mat + 8);
+  __m128 column3 = _mm_loadu_ps(mat + 12);
+  _MM_TRANSPOSE4_PS(column0, column1, column2, column3);
+
+  __m128 resVec = _mm_setzero_ps();
+  resVec = _mm_add_ps(resVec, _mm_mul_ps(column0, _mm_set1_ps(vec[0])));
+  resVec = _mm_add_ps(resVec, _mm_mul_ps(column1, _mm_set1_ps(vec[1])));
+  resVec = _mm_add_ps(resVec, _mm_mul_ps(column2, _mm_set1_ps(vec[2])));
+  resVec = _mm_add_ps(resVec, _mm_mul_ps(column3, _mm_set1_ps(vec[3])));
+
+  _mm_storeu_ps(res, resVec);
+}
+
+/// Multiplies a horizontal vector by a matrix.
+/// \param vec Vector's elements.
+/// \param mat Matrix's elements.
+/// \param res Resulting vector's elements.
+inline void multiplyVectorMatrix(const float* vec, const float* mat, float* res) noexcept {
+  __m128 resVec = _mm_setzero_ps();
+  resVec = _mm_add_ps(resVec, _mm_mul_ps(_mm_set1_ps(vec[0]), _mm_loadu_ps(mat)));
+  resVec = _mm_add_ps(resVec, _mm_mul_ps(_mm_set1_ps(vec[1]), _mm_loadu_ps(mat + 4)));
+  resVec = _mm_add_ps(resVec, _mm_mul_ps(_mm_set1_ps(vec[2]), _mm_loadu_ps(mat + 8)));
+  resVec = _mm_add_ps(resVec, _mm_mul_ps(_mm_set1_ps(vec[3]), _mm_loadu_ps(mat + 12)));
+
+  _mm_storeu_ps(res, resVec);
+}
+
+/// Transposes a matrix.
+/// \param mat Matrix's elements.
+/// \param res Transposed matrix's elements.
+inline void transposeMatrix(const float* mat, float* res) noexcept {
+  __m128 row0 = _mm_loadu_ps(mat);
+  __m128 row1 = _mm_loadu_ps(mat + 4);
+  __m128 row2 = _mm_loadu_ps(mat + 8);
+  __m128 row3 = _mm_loadu_ps(mat + 12);
+  _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+  _mm_storeu_ps(res, row0);
+  _mm_storeu_ps(res + 4, row1);
+  _mm_storeu_ps(res + 8, row2);
+  _mm_storeu_ps(res + 12, row3);
+}
+
+/// Computes the determinants of the four 3x3 minors obtained by removing a given row & each column of a matrix.
+/// \param rowA First remaining row.
+/// \param rowB Second remaining row.
+/// \param rowC Third remaining row.
+/// \return Minors' determinants, the Nth one having the Nth column removed.
+inline __m128 computeMinorDeterminants(__m128 rowA, __m128 rowB, __m128 rowC) noexcept {
+  // For each lane, the minor's columns are the 3 matrix's columns other than the lane's index: (1, 0, 0, 0), (2, 2, 1, 1) & (3, 3, 3, 2)
+  const __m128 a0 = _mm_shuffle_ps(rowA, rowA, _MM_SHUFFLE(0, 0, 0, 1));
+  const __m128 a1 = _mm_shuffle_ps(rowA, rowA, _MM_SHUFFLE(1, 1, 2, 2));
+  const __m128 a2 = _mm_shuffle_ps(rowA, rowA, _MM_SHUFFLE(2, 3, 3, 3));
+
+  const __m128 b0 = _mm_shuffle_ps(rowB, rowB, _MM_SHUFFLE(0, 0, 0, 1));
+  const __m128 b1 = _mm_shuffle_ps(rowB, rowB, _MM_SHUFFLE(1, 1, 2, 2));
+  const __m128 b2 = _mm_shuffle_ps(rowB, rowB, _MM_SHUFFLE(2, 3, 3, 3));
+
+  const __m128 c0 = _mm_shuffle_ps(rowC, rowC, _MM_SHUFFLE(0, 0, 0, 1));
+  const __m128 c1 = _mm_shuffle_ps(rowC, rowC, _MM_SHUFFLE(1, 1, 2, 2));
+  const __m128 c2 = _mm_shuffle_ps(rowC, rowC, _MM_SHUFFLE(2, 3, 3, 3));
+
+  // Expanding along the first row, as does the generic 3x3 determinant: (b1c2 - c1b2) * a0 - (b0c2 - c0b2) * a1 + (b0c1 - c0b1) * a2
+  const __m128 leftDeterm   = _mm_sub_ps(_mm_mul_ps(b1, c2), _mm_mul_ps(c1, b2));
+  const __m128 centerDeterm = _mm_sub_ps(_mm_mul_ps(b0, c2), _mm_mul_ps(c0, b2));
+  const __m128 rightDeterm  = _mm_sub_ps(_mm_mul_ps(b0, c1), _mm_mul_ps(c0, b1));
+
+  return _mm_add_ps(_mm_sub_ps(_mm_mul_ps(leftDeterm, a0), _mm_mul_ps(centerDeterm, a1)), _mm_mul_ps(rightDeterm, a2));
+}
+
+/// Inverses a matrix, computing the cofactors of all its elements at once.
+/// \param mat Matrix's elements.
+/// \param res Inverse matrix's elements.
+inline void inverseMatrix(const float* mat, float* res) noexcept {
+  const __m128 row0 = _mm_loadu_ps(mat);
+  const __m128 row1 = _mm_loadu_ps(mat + 4);
+  const __m128 row2 = _mm_loadu_ps(mat + 8);
+  const __m128 row3 = _mm_loadu_ps(mat + 12);
+
+  const __m128 minors0 = computeMinorDeterminants(row1, row2, row3);
+  const __m128 minors1 = computeMinorDeterminants(row0, row2, row3);
+  const __m128 minors2 = computeMinorDeterminants(row0, row1, row3);
+  const __m128 minors3 = computeMinorDeterminants(row0, row1, row2);
+
+  // The determinant is expanded along the first row, in the same order as the generic implementation
+  alignas(16) float firstMinors[4] {};
+  _mm_store_ps(firstMinors, minors0);
+  const float determinant = firstMinors[0] * mat[0] - firstMinors[1] * mat[1] + firstMinors[2] * mat[2] - firstMinors[3] * mat[3];
+
+  // Applying the cofactors' alternating signs, which only flips their sign bit
+  const __m128 evenRowSigns = _mm_set_ps(-0.f, 0.f, -0.f, 0.f);
+  const __m128 oddRowSigns  = _mm_set_ps(0.f, -0.f, 0.f, -0.f);
+
+  __m128 cofactors0 = _mm_xor_ps(minors0, evenRowSigns);
+  __m128 cofactors1 = _mm_xor_ps(minors1, oddRowSigns);
+  __m128 cofactors2 = _mm_xor_ps(minors2, evenRowSigns);
+  __m128 cofactors3 = _mm_xor_ps(minors3, oddRowSigns);
+  _MM_TRANSPOSE4_PS(cofactors0, cofactors1, cofactors2, cofactors3);
+
+  const __m128 determinantVec = _mm_set1_ps(determinant);
+
+  _mm_storeu_ps(res, _mm_div_ps(cofactors0, determinantVec));
+  _mm_storeu_ps(res + 4, _mm_div_ps(cofactors1, determinantVec));
+  _mm_storeu_ps(res + 8, _mm_div_ps(cofactors2, determinantVec));
+  _mm_storeu_ps(res + 12, _mm_div_ps(cofactors3, determinantVec));
+}
+
+#endif // RAZ_SIMD_SSE
+
+} // namespace Raz::Simd
+
+#endif // RAZ_SIMD_HPP
@@ -0,0 +1,88 @@
+#pragma once
+
+#ifndef RAZ_SPATIALINDEXSYSTEM_HPP
+#define RAZ_SPATIALINDEXSYSTEM_HPP
+
+#include "RaZ/System.hpp"
+#include "RaZ/Utils/AABBTree.hpp"
+
+namespace Raz {
+
+/// SpatialIndexSystem class, sorting the entities holding a Mesh by their world-space bounding box to find those lying in a given area.
+/// The world-space box of an entity is the bounding box of its mesh, transformed by the world matrix of its SceneNode if any, or else
+///  by its Transform. The world matrices being computed by the SceneGraphSystem, the index reflects those of the previous frame if this
+///  system happens to be updated first (systems being ordered by their IDs). On each update, only the entities whose Transform,
+///  SceneNode or Mesh has changed since the previous one are reevaluated, & are only moved in the index if they got out of their
+///  enlarged box.
+/// The system doesn't declare its accesses, so that no other system is updated concurrently & can thus safely query it.
+class SpatialIndexSystem final : public System {
+public:
+  /// Creates a spatial index system.
+  /// \param margin Distance by which the entities' boxes are enlarged on each side; the higher it is, the less often moving entities
+  ///   have to be reinserted, but the coarser the queries become.
+  explicit SpatialIndexSystem(float margin = 0.1f);
+
+  /// Gets the tree holding the entities, allowing any custom query on it.
+  /// \return Constant reference to the tree.
+  const AABBTree<Entity*>& getTree() const noexcept { return m_tree; }
+
+  /// Finds the entities whose box intersects the given shape, which can be an AABB, a Sphere, a Frustum or a Ray.
+  /// The boxes being slightly enlarged, the found entities may lie a bit outside of the shape.
+  /// \tparam ShapeT Type of the shape to be checked.
+  /// \tparam FuncT Type of the function to be called.
+  /// \param shape Shape to be checked.
+  /// \param func Function to be called with a pointer to each found entity.
+  template <typename ShapeT, typename FuncT> void query(const ShapeT& shape, FuncT&& func) const { m_tree.query(shape, std::forward<FuncT>(func)); }
+  /// Finds the entities whose box intersects the given shape, which can be an AABB, a Sphere, a Frustum or a Ray.
+  /// \tparam ShapeT Type of the shape to be checked.
+  /// \param shape Shape to be checked.
+  /// \return Found entities, in no particular order.
+  template <typename ShapeT> std::vector<Entity*> query(const ShapeT& shape) const;
+  /// Finds the entities whose box intersects each of the given boxes. The queries are made in parallel if there are enough of them.
+  /// \param boxes Boxes to be checked.
+  /// \return Found entities for each box, in the same order.
+  std::vector<std::vector<Entity*>> query(const std::vector<AABB>& boxes) const;
+  /// Finds the entities whose box intersects each of the given spheres. The queries are made in parallel if there are enough of them.
+  /// \param spheres Spheres to be checked.
+  /// \return Found entities for each sphere, in the same order.
+  std::vector<std::vector<Entity*>> query(const std::vector<Sphere>& spheres) const;
+  /// Finds the entities whose box intersects each of the given frustums. The queries are made in parallel if there are enough of them.
+  /// \param frustums Frustums to be checked.
+  /// \return Found entities for each frustum, in the same order.
+  std::vector<std::vector<Entity*>> query(const std::vector<Frustum>& frustums) const;
+  /// Finds the entities whose box is hit by each of the given rays. The queries are made in parallel if there are enough of them.
+  /// \param rays Rays to be cast.
+  /// \return Found entities for each ray, in the same order.
+  std::vector<std::vector<Entity*>> query(const std::vector<Ray>& rays) const;
+  /// Finds the entities whose box is hit by the given ray, sorted from the closest to the furthest.
+  /// \param ray Ray to be cast.
+  /// \param maxDistance Distance from the ray's origin beyond which entities are ignored.
+  /// \return Found entities, along with the distance at which the ray enters their box.
+  std::vector<std::pair<Entity*, float>> raycast(const Ray& ray, float maxDistance = std::numeric_limits<float>::max()) const;
+
+  void linkEntity(Entity& entity) override;
+  void unlinkEntity(Entity& entity) override;
+  bool update(float deltaTime) override;
+
+private:
+  struct EntityEntry {
+    std::size_t proxyId = AABBTree<Entity*>::InvalidIndex;
+    bool hasTransform {}; ///< True if the entity held a Transform when its box has last been computed.
+    bool hasSceneNode {}; ///< True if the entity held a SceneNode when its box has last been computed.
+  };
+
+  /// Computes the world-space bounding box of the given entity, & saves the components it has been computed from.
+  /// \param entity Entity to compute the box of.
+  /// \param entry Entry of the entity.
+  /// \return Entity's world-space box.
+  static AABB computeWorldBox(const Entity& entity, EntityEntry& entry);
+
+  AABBTree<Entity*> m_tree;
+  std::vector<EntityEntry> m_entries {}; ///< Entries of the linked entities, indexed by their ID.
+};
+
+} // namespace Raz
+
+#include "RaZ/Math/SpatialIndexSystem.inl"
+
+#endif // RAZ_SPATIALINDEXSYSTEM_HPP
@@ -0,0 +1,10 @@
+namespace Raz {
+
+template <typename ShapeT>
+std::vector<Entity*> SpatialIndexSystem::query(const ShapeT& shape) const {
+  std::vector<Entity*> entities;
+  m_tree.query(shape, [&entities] (Entity* entity) { entities.emplace_back(entity); });
+  return entities;
+}
+
+} // namespace Raz
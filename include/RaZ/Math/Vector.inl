@@ -1,3 +1,4 @@
+#include "RaZ/Math/Simd.hpp"
 #include "RaZ/Utils/FloatUtils.hpp"
 
 #include <algorithm>
@@ -135,6 +136,15 @@ constexpr Vector<T, Size> Vector<T, Size>::operator*(const Matrix<T, Size, H>& m
   // This multiplication is made assuming the vector to be horizontal
   Vector<T, Size> res {};
 
+#if defined(RAZ_SIMD_SSE)
+  if constexpr (std::is_same_v<T, float> && Size == 4 && H == 4) {
+    if (!Simd::isConstantEvaluated()) {
+      Simd::multiplyVectorMatrix(m_data.data(), mat.getDataPtr(), res.getDataPtr());
+      return res;
+    }
+  }
+#endif
+
   for (std::size_t widthIndex = 0; widthIndex < Size; ++widthIndex) {
     for (std::size_t heightIndex = 0; heightIndex < H; ++heightIndex)
       res[widthIndex] += m_data[heightIndex] * mat[heightIndex * Size + widthIndex];
@@ -8,6 +8,9 @@
 
 namespace Raz {
 
+class RigidBody;
+class Transform;
+
 class PhysicsSystem final : public System {
 public:
   PhysicsSystem();
@@ -18,10 +21,13 @@ public:
     m_friction = friction;
   }
 
+  void linkComponentRegistry(ComponentRegistry& registry) override;
   bool update(float deltaTime) override;
   void destroy() override {}
 
 private:
+  const Query<Transform, RigidBody>* m_bodies {}; ///< Query giving the rigid bodies to be simulated & their transforms; null outside of a World.
+
   Vec3f m_gravity  = Vec3f(0.f, -9.80665f, 0.f); ///< Gravity force.
   float m_friction = 0.95f; ///< Friction coefficient.
 };
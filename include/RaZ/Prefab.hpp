@@ -0,0 +1,78 @@
+#pragma once
+
+#ifndef RAZ_PREFAB_HPP
+#define RAZ_PREFAB_HPP
+
+#include "RaZ/Component.hpp"
+#include "RaZ/Utils/Bitset.hpp"
+
+#include <vector>
+
+namespace Raz {
+
+class ComponentRegistry;
+
+/// Prefab class, holding a set of preconfigured components used as a template to create entities (see World::instantiate()).
+/// Each entity instantiated from a prefab receives its own copies of the prefab's components; modifying the prefab afterward doesn't
+///  affect the entities already created.
+class Prefab {
+public:
+  Prefab() = default;
+  Prefab(const Prefab&) = delete;
+  Prefab(Prefab&&) noexcept = default;
+
+  /// Gets the set of IDs of the components held by the prefab.
+  /// \return Bitset in which each enabled bit is the ID of a held component.
+  const Bitset& getSignature() const noexcept { return m_signature; }
+  std::size_t getComponentCount() const noexcept { return m_signature.getEnabledBitCount(); }
+
+  /// Tells if a given component is held by the prefab.
+  /// \tparam Comp Type of the component to be checked.
+  /// \return True if the prefab holds the given component, false otherwise.
+  template <typename Comp> bool hasComponent() const noexcept;
+  /// Gets a given component held by the prefab.
+  /// The prefab must have this component. If not, an exception is thrown.
+  /// \tparam Comp Type of the component to be fetched.
+  /// \return Reference to the found component.
+  template <typename Comp> const Comp& getComponent() const;
+  /// Gets a given component held by the prefab, allowing to configure it before instantiating the prefab.
+  /// The prefab must have this component. If not, an exception is thrown.
+  /// \tparam Comp Type of the component to be fetched.
+  /// \return Reference to the found component.
+  template <typename Comp> Comp& getComponent() { return const_cast<Comp&>(static_cast<const Prefab*>(this)->getComponent<Comp>()); }
+  /// Adds a component to be copied into each instantiated entity. If the prefab already holds one of this type, it is replaced.
+  /// \tparam Comp Type of the component to be added; must be copy-constructible.
+  /// \tparam Args Types of the arguments to be forwarded to the given component.
+  /// \param args Arguments to be forwarded to the given component.
+  /// \return Reference to the newly added component.
+  template <typename Comp, typename... Args> Comp& addComponent(Args&&... args);
+  /// Removes the given component from the prefab.
+  /// \tparam Comp Type of the component to be removed.
+  template <typename Comp> void removeComponent();
+  /// Creates several copies of the prefab's component of the given ID in a registry.
+  /// \param compId ID of the component to be copied; the prefab must hold it.
+  /// \param registry Registry in which to create the copies.
+  /// \param count Amount of copies to be created.
+  /// \return Owning pointers to the copies.
+  std::vector<ComponentPtr> copyComponent(std::size_t compId, ComponentRegistry& registry, std::size_t count) const;
+
+  Prefab& operator=(const Prefab&) = delete;
+  Prefab& operator=(Prefab&&) noexcept = default;
+
+private:
+  using CopyFunc = std::vector<ComponentPtr> (*)(const Component&, ComponentRegistry&, std::size_t);
+
+  struct ComponentTemplate {
+    ComponentPtr prototype {};
+    CopyFunc copy {}; ///< Function creating copies of the prototype, knowing its actual type.
+  };
+
+  std::vector<ComponentTemplate> m_components {}; ///< Components indexed by their ID.
+  Bitset m_signature {};
+};
+
+} // namespace Raz
+
+#include "RaZ/Prefab.inl"
+
+#endif // RAZ_PREFAB_HPP
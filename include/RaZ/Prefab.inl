@@ -0,0 +1,60 @@
+#include "RaZ/ComponentRegistry.hpp"
+
+#include <stdexcept>
+#include <type_traits>
+
+namespace Raz {
+
+template <typename Comp>
+bool Prefab::hasComponent() const noexcept {
+  static_assert(std::is_base_of_v<Component, Comp>, "Error: Checked component must be derived from Component.");
+
+  const std::size_t compId = Component::getId<Comp>();
+  return ((compId < m_signature.getSize()) && m_signature[compId]);
+}
+
+template <typename Comp>
+const Comp& Prefab::getComponent() const {
+  static_assert(std::is_base_of_v<Component, Comp>, "Error: Fetched component must be derived from Component.");
+
+  if (hasComponent<Comp>())
+    return static_cast<const Comp&>(*m_components[Component::getId<Comp>()].prototype);
+
+  throw std::runtime_error("Error: No component available of specified type");
+}
+
+template <typename Comp, typename... Args>
+Comp& Prefab::addComponent(Args&&... args) {
+  static_assert(std::is_base_of_v<Component, Comp>, "Error: Added component must be derived from Component.");
+  static_assert(std::is_copy_constructible_v<Comp>, "Error: A prefab's component must be copy-constructible.");
+
+  const std::size_t compId = Component::getId<Comp>();
+
+  if (compId >= m_components.size())
+    m_components.resize(compId + 1);
+
+  ComponentTemplate& compTemplate = m_components[compId];
+  compTemplate.prototype = ComponentPtr(new Comp(std::forward<Args>(args)...));
+  compTemplate.copy      = [] (const Component& prototype, ComponentRegistry& registry, std::size_t count) {
+    return registry.createComponents(static_cast<const Comp&>(prototype), count);
+  };
+
+  m_signature.setBit(compId);
+
+  return static_cast<Comp&>(*compTemplate.prototype);
+}
+
+template <typename Comp>
+void Prefab::removeComponent() {
+  static_assert(std::is_base_of_v<Component, Comp>, "Error: Removed component must be derived from Component.");
+
+  if (!hasComponent<Comp>())
+    return;
+
+  const std::size_t compId = Component::getId<Comp>();
+
+  m_components[compId] = ComponentTemplate{};
+  m_signature.setBit(compId, false);
+}
+
+} // namespace Raz
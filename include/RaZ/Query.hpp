@@ -0,0 +1,139 @@
+#pragma once
+
+#ifndef RAZ_QUERY_HPP
+#define RAZ_QUERY_HPP
+
+#include "RaZ/Archetype.hpp"
+
+#include <array>
+#include <atomic>
+#include <tuple>
+
+namespace Raz {
+
+/// Tag type listing the components an entity must not hold to be matched by a Query.
+/// \tparam Comps Types of the components to be excluded.
+template <typename... Comps>
+struct Exclude {};
+
+/// Tag listing the components an entity must not hold to be matched by a Query.
+/// \tparam Comps Types of the components to be excluded.
+template <typename... Comps>
+constexpr Exclude<Comps...> exclude {};
+
+/// Type-erased base of a Query, holding the archetypes matched by it.
+class BaseQuery {
+public:
+  BaseQuery(const BaseQuery&) = delete;
+  BaseQuery(BaseQuery&&) noexcept = delete;
+
+  const std::vector<std::size_t>& getComponentIds() const noexcept { return m_componentIds; }
+  const Bitset& getExcludedComponents() const noexcept { return m_excludedComponents; }
+  /// Gets the components queried as constant, which are only read & thus never marked as modified by the query.
+  /// \return Bitset of the constant components' IDs.
+  const Bitset& getConstComponents() const noexcept { return m_constComponents; }
+  const std::vector<const Archetype*>& getArchetypes() const noexcept { return m_archetypes; }
+
+  /// Computes the amount of entities currently matched by the query.
+  /// \return Number of matched entities.
+  std::size_t computeEntityCount() const noexcept;
+  /// Tells if the entities of the given archetype are to be matched by the query.
+  /// \param archetype Archetype to be checked.
+  /// \return True if the archetype holds all the queried components & none of the excluded ones, false otherwise.
+  bool matches(const Archetype& archetype) const noexcept;
+  /// Adds the given archetype into the query's matched ones if it matches.
+  /// \param archetype Archetype to be checked & added.
+  void addArchetype(const Archetype& archetype);
+
+  BaseQuery& operator=(const BaseQuery&) = delete;
+  BaseQuery& operator=(BaseQuery&&) noexcept = delete;
+
+  virtual ~BaseQuery() = default;
+
+protected:
+  BaseQuery(std::vector<std::size_t> componentIds, Bitset excludedComponents, Bitset constComponents)
+    : m_componentIds{ std::move(componentIds) },
+      m_excludedComponents{ std::move(excludedComponents) },
+      m_constComponents{ std::move(constComponents) } {}
+
+  std::vector<std::size_t> m_componentIds {};
+  Bitset m_excludedComponents {};
+  Bitset m_constComponents {};
+  std::vector<const Archetype*> m_archetypes {};
+};
+
+/// Query class, giving a direct access to all the enabled entities holding a given set of components.
+/// The matched archetypes are cached & kept up to date by the ComponentRegistry the query has been created from.
+/// Entities must not be structurally modified (components added or removed, enabled or disabled) while a query is iterated over.
+/// Components queried as constant (Query<const Comp>) are only read; the others are marked as modified when accessed.
+/// \tparam Comps Types of the components to be queried.
+template <typename... Comps>
+class Query final : public BaseQuery {
+  static_assert(sizeof...(Comps) > 0, "Error: A query must be made on at least one component.");
+  static_assert((std::is_base_of_v<Component, Comps> && ...), "Error: Queried components must be derived from Component.");
+
+public:
+  /// Iterator over a Query, giving a tuple of references to each matched entity's components.
+  class Iterator {
+  public:
+    Iterator(const std::vector<const Archetype*>& archetypes, std::size_t archetypeIndex, std::uint64_t changeVersion);
+
+    Entity& getEntity() const { return *m_archetypes[m_archetypeIndex]->getEntities()[m_entityIndex]; }
+
+    std::tuple<Comps&...> operator*() const;
+    Iterator& operator++();
+    bool operator==(const Iterator& iter) const noexcept { return (m_archetypeIndex == iter.m_archetypeIndex && m_entityIndex == iter.m_entityIndex); }
+    bool operator!=(const Iterator& iter) const noexcept { return !(*this == iter); }
+
+  private:
+    /// Skips the archetypes which don't have any entity, starting from the current one.
+    void skipEmptyArchetypes();
+
+    const std::vector<const Archetype*>& m_archetypes;
+    std::size_t m_archetypeIndex {};
+    std::size_t m_entityIndex {};
+    std::uint64_t m_changeVersion {};
+  };
+
+  /// Creates a query for the given components.
+  /// \param excludedComponents Components that matched entities must not hold.
+  /// \param changeVersion Change version of the registry the query is made on, with which the accessed components are stamped.
+  Query(Bitset excludedComponents, const std::atomic<std::uint64_t>& changeVersion)
+    : BaseQuery({ Component::getId<Comps>()... }, std::move(excludedComponents), computeConstComponents()), m_changeVersion{ &changeVersion } {}
+
+  /// Computes the IDs of the components queried as constant.
+  /// \return Bitset of the constant components' IDs.
+  static Bitset computeConstComponents();
+
+  Iterator begin() const { return Iterator(m_archetypes, 0, m_changeVersion->load(std::memory_order_relaxed)); }
+  Iterator end() const { return Iterator(m_archetypes, m_archetypes.size(), 0); }
+
+  /// Calls the given function on every matched entity.
+  /// This is the fastest way of iterating over a query.
+  /// \tparam Func Type of the function to be called; may take either the queried components, or the entity followed by them.
+  /// \param func Function to be called.
+  template <typename Func> void forEach(Func&& func) const;
+  /// Calls the given function on every matched entity of which any queried component has been modified since the given version.
+  /// \tparam Func Type of the function to be called; may take either the queried components, or the entity followed by them.
+  /// \param version Version after which the components must have been modified, usually System::getLastUpdateVersion().
+  /// \param func Function to be called.
+  template <typename Func> void forEachChanged(std::uint64_t version, Func&& func) const;
+
+private:
+  /// Gets the given component, marking it as modified if it isn't queried as constant.
+  /// \tparam Comp Type of the component to be accessed.
+  /// \param component Component to be accessed.
+  /// \param changeVersion Version with which to stamp the component if modified.
+  /// \return Reference to the component.
+  template <typename Comp> static Comp& accessComponent(Component& component, std::uint64_t changeVersion) noexcept;
+  template <bool OnlyChanged, typename Func, std::size_t... Indices>
+  void forEach(Func& func, std::uint64_t version, std::index_sequence<Indices...>) const;
+
+  const std::atomic<std::uint64_t>* m_changeVersion {};
+};
+
+} // namespace Raz
+
+#include "RaZ/Query.inl"
+
+#endif // RAZ_QUERY_HPP
@@ -0,0 +1,90 @@
+namespace Raz {
+
+template <typename... Comps>
+Query<Comps...>::Iterator::Iterator(const std::vector<const Archetype*>& archetypes, std::size_t archetypeIndex, std::uint64_t changeVersion)
+  : m_archetypes{ archetypes }, m_archetypeIndex{ archetypeIndex }, m_changeVersion{ changeVersion } {
+  skipEmptyArchetypes();
+}
+
+template <typename... Comps>
+typename Query<Comps...>::Iterator& Query<Comps...>::Iterator::operator++() {
+  ++m_entityIndex;
+
+  if (m_entityIndex >= m_archetypes[m_archetypeIndex]->getEntityCount()) {
+    ++m_archetypeIndex;
+    m_entityIndex = 0;
+
+    skipEmptyArchetypes();
+  }
+
+  return *this;
+}
+
+template <typename... Comps>
+std::tuple<Comps&...> Query<Comps...>::Iterator::operator*() const {
+  const Archetype& archetype = *m_archetypes[m_archetypeIndex];
+  return std::tuple<Comps&...>(accessComponent<Comps>(*archetype.getColumn(Component::getId<Comps>())[m_entityIndex], m_changeVersion)...);
+}
+
+template <typename... Comps>
+void Query<Comps...>::Iterator::skipEmptyArchetypes() {
+  while (m_archetypeIndex < m_archetypes.size() && m_archetypes[m_archetypeIndex]->isEmpty())
+    ++m_archetypeIndex;
+}
+
+template <typename... Comps>
+template <typename Func>
+void Query<Comps...>::forEach(Func&& func) const {
+  forEach<false>(func, 0, std::index_sequence_for<Comps...>());
+}
+
+template <typename... Comps>
+template <typename Func>
+void Query<Comps...>::forEachChanged(std::uint64_t version, Func&& func) const {
+  forEach<true>(func, version, std::index_sequence_for<Comps...>());
+}
+
+template <typename... Comps>
+Bitset Query<Comps...>::computeConstComponents() {
+  Bitset constComponents;
+  ((std::is_const_v<Comps> ? constComponents.setBit(Component::getId<Comps>()) : void()), ...);
+
+  return constComponents;
+}
+
+template <typename... Comps>
+template <typename Comp>
+Comp& Query<Comps...>::accessComponent(Component& component, std::uint64_t changeVersion) noexcept {
+  if constexpr (!std::is_const_v<Comp>)
+    component.markChanged(changeVersion);
+
+  return static_cast<Comp&>(component);
+}
+
+template <typename... Comps>
+template <bool OnlyChanged, typename Func, std::size_t... Indices>
+void Query<Comps...>::forEach(Func& func, [[maybe_unused]] std::uint64_t version, std::index_sequence<Indices...>) const {
+  static_assert(std::is_invocable_v<Func&, Comps&...> || std::is_invocable_v<Func&, Entity&, Comps&...>,
+                "Error: The function must take either the queried components, or an entity followed by them.");
+
+  const std::uint64_t changeVersion = m_changeVersion->load(std::memory_order_relaxed);
+
+  for (const Archetype* archetype : m_archetypes) {
+    const std::vector<Entity*>& entities = archetype->getEntities();
+    const std::array<Component* const*, sizeof...(Comps)> columns = { archetype->getColumn(m_componentIds[Indices]).data()... };
+
+    for (std::size_t entityIndex = 0; entityIndex < entities.size(); ++entityIndex) {
+      if constexpr (OnlyChanged) {
+        if (!(columns[Indices][entityIndex]->hasChangedSince(version) || ...))
+          continue;
+      }
+
+      if constexpr (std::is_invocable_v<Func&, Entity&, Comps&...>)
+        func(*entities[entityIndex], accessComponent<Comps>(*columns[Indices][entityIndex], changeVersion)...);
+      else
+        func(accessComponent<Comps>(*columns[Indices][entityIndex], changeVersion)...);
+    }
+  }
+}
+
+} // namespace Raz
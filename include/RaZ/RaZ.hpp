@@ -6,14 +6,26 @@
 #define GLEW_STATIC
 
 #include "Application.hpp"
+#include "Archetype.hpp"
 #include "Component.hpp"
+#include "ComponentRegistry.hpp"
+#include "ComponentStorage.hpp"
 #include "Entity.hpp"
+#include "EntityCommandBuffer.hpp"
+#include "Prefab.hpp"
+#include "Query.hpp"
 #include "System.hpp"
+#include "SystemGraph.hpp"
 #include "World.hpp"
+#include "WorldSnapshot.hpp"
 #include "Math/Angle.hpp"
 #include "Math/Constants.hpp"
 #include "Math/Matrix.hpp"
 #include "Math/Quaternion.hpp"
+#include "Math/SceneGraphSystem.hpp"
+#include "Math/SceneNode.hpp"
+#include "Math/Simd.hpp"
+#include "Math/SpatialIndexSystem.hpp"
 #include "Math/Transform.hpp"
 #include "Math/Vector.hpp"
 #include "Physics/PhysicsSystem.hpp"
@@ -26,21 +38,31 @@
 #include "Render/Material.hpp"
 #include "Render/Mesh.hpp"
 #include "Render/Renderer.hpp"
+#include "Render/RenderState.hpp"
 #include "Render/RenderSystem.hpp"
 #include "Render/Shader.hpp"
 #include "Render/ShaderProgram.hpp"
 #include "Render/Submesh.hpp"
 #include "Render/Texture.hpp"
 #include "Render/UniformBuffer.hpp"
+#include "Utils/AABBTree.hpp"
 #include "Utils/Bitset.hpp"
 #include "Utils/FileUtils.hpp"
 #include "Utils/FloatUtils.hpp"
+#include "Utils/Frustum.hpp"
 #include "Utils/Image.hpp"
 #include "Utils/Input.hpp"
+#include "Utils/MpmcQueue.hpp"
+#include "Utils/ObjectPool.hpp"
 #include "Utils/Overlay.hpp"
+#include "Utils/ParallelAlgorithms.hpp"
+#include "Utils/Profiler.hpp"
 #include "Utils/Ray.hpp"
+#include "Utils/RingBuffer.hpp"
 #include "Utils/Shape.hpp"
+#include "Utils/SpscQueue.hpp"
 #include "Utils/StrUtils.hpp"
+#include "Utils/TaskGraph.hpp"
 #if defined(__GNUC__) && defined(_GLIBCXX_HAS_GTHREADS)
 #include "Utils/Threading.hpp"
 #endif
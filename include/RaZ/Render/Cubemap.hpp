@@ -49,7 +49,11 @@ public:
   void unbind() const;
   /// Draws the cubemap around the scene.
   /// \param camera Camera component from which will be taken the view & projection matrices.
-  void draw(const Camera& camera) const;
+  void draw(const Camera& camera) const { draw(camera.getViewMatrix(), camera.getProjectionMatrix()); }
+  /// Draws the cubemap around the scene.
+  /// \param viewMat View matrix of the camera, whose translation is ignored.
+  /// \param projMat Projection matrix of the camera.
+  void draw(const Mat4f& viewMat, const Mat4f& projMat) const;
 
 private:
   unsigned int m_index {};
@@ -0,0 +1,56 @@
+#pragma once
+
+#ifndef RAZ_RENDERSTATE_HPP
+#define RAZ_RENDERSTATE_HPP
+
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Math/Vector.hpp"
+
+#include <vector>
+
+namespace Raz {
+
+class Mesh;
+
+/// RenderState structure, holding everything needed to draw a frame: the meshes along with their model matrices, the lights & the camera.
+/// The matrices, the lights & the camera are copied, but the meshes are only referenced: once extracted from a World, a state can be drawn
+///  while the World is being updated, as long as no system modifies the meshes in the meantime (see System::getRenderedComponents()).
+struct RenderState {
+  struct MeshInstance {
+    const Mesh* mesh {}; ///< Mesh to be drawn, which must stay alive & unmodified as long as the state may be.
+    Mat4f modelMatrix {};
+  };
+
+  struct LightInstance {
+    Vec4f homogeneousPosition {}; ///< Position of the light, whose last component is 0 for a directional light & 1 otherwise.
+    Vec3f direction {};
+    Vec3f color {};
+    float energy {};
+    float angle {};
+
+    bool operator==(const LightInstance& light) const noexcept {
+      return (homogeneousPosition == light.homogeneousPosition && direction == light.direction && color == light.color
+           && energy == light.energy && angle == light.angle);
+    }
+    bool operator!=(const LightInstance& light) const noexcept { return !(*this == light); }
+  };
+
+  /// Empties the state, keeping its memory to be reused by the next extraction.
+  void clear() noexcept {
+    meshes.clear();
+    lights.clear();
+  }
+
+  std::vector<MeshInstance> meshes {};
+  std::vector<LightInstance> lights {};
+
+  Mat4f viewMatrix = Mat4f::identity();
+  Mat4f inverseViewMatrix = Mat4f::identity();
+  Mat4f projectionMatrix = Mat4f::identity();
+  Mat4f inverseProjectionMatrix = Mat4f::identity();
+  Vec3f cameraPosition {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_RENDERSTATE_HPP
@@ -9,13 +9,22 @@
 #include "RaZ/Render/Cubemap.hpp"
 #include "RaZ/Render/Framebuffer.hpp"
 #include "RaZ/Render/RenderPass.hpp"
+#include "RaZ/Render/RenderState.hpp"
 #include "RaZ/Render/UniformBuffer.hpp"
 #include "RaZ/System.hpp"
 #include "RaZ/Utils/Window.hpp"
 
+#include <array>
+#include <mutex>
+
 namespace Raz {
 
+class SceneNode;
+class Transform;
+
 /// RenderSystem class, handling the rendering part.
+/// By default, each update draws the scene right away from the World's components. Once pipelined (see enablePipelining()), an update
+///  only extracts a RenderState, which is drawn by render() on the main thread while the World's next update takes place.
 class RenderSystem final : public System {
 public:
   /// Creates a render system, initializing its inner data.
@@ -53,8 +62,27 @@ public:
   void enableSSRPass(FragmentShader fragShader);
   void disableGeometryPass() { m_renderPasses[static_cast<std::size_t>(RenderPassType::GEOMETRY)].reset(); }
   void disableSSRPass() { m_renderPasses[static_cast<std::size_t>(RenderPassType::SSR)].reset(); }
-  void linkEntity(const EntityPtr& entity) override;
+  /// Enables or disables the pipelined rendering.
+  /// When pipelined, an update doesn't make any graphics API call & can thus be made on any thread: it only copies the meshes' model
+  ///  matrices, the lights & the camera into a RenderState, which references the meshes themselves. The last extracted state is drawn by
+  ///  render(), which must be called on the main thread & can be so while the World is being updated; the Application does this
+  ///  automatically, unless another system of the World may write meshes (see System::getRenderedComponents()). The World's structural
+  ///  changes (see World::refresh()) must however be applied while no state is being drawn, & the meshes must thus not be removed during
+  ///  the World's updates, but through its command buffers.
+  /// \param enabled True if the rendering should be pipelined, false otherwise.
+  void enablePipelining(bool enabled = true);
+  void disablePipelining() { enablePipelining(false); }
+  void linkComponentRegistry(ComponentRegistry& registry) override;
+  using System::linkEntity;
+  void linkEntity(Entity& entity) override;
+  using System::unlinkEntity;
+  void unlinkEntity(Entity& entity) override;
+  void relinkEntity(Entity& entity) override;
   bool update(float deltaTime) override;
+  /// Draws the last RenderState extracted by an update; the rendering must be pipelined (see enablePipelining()).
+  /// This must be called on the main thread, & can be so while the World is being updated.
+  /// \return True if the window, if any, is still open, false otherwise.
+  bool render() override;
   void sendViewMatrix(const Mat4f& viewMat) const { m_cameraUbo.sendData(viewMat, 0); }
   void sendInverseViewMatrix(const Mat4f& invViewMat) const { m_cameraUbo.sendData(invViewMat, sizeof(Mat4f)); }
   void sendProjectionMatrix(const Mat4f& projMat) const { m_cameraUbo.sendData(projMat, sizeof(Mat4f) * 2); }
@@ -73,17 +101,58 @@ public:
 private:
   void initialize();
   void initialize(unsigned int sceneWidth, unsigned int sceneHeight);
+  /// Copies the camera's matrices, the lights & the meshes along with their model matrices into the given state.
+  /// \param state State to be filled.
+  void extractRenderState(RenderState& state);
+  /// Records the mesh held by the given entity as its current one, keeping the previous one as removed if it changed.
+  /// \param entity Linked entity whose mesh is to be recorded.
+  /// \return True if the entity holds a mesh which wasn't recorded yet, false otherwise.
+  bool recordEntityMesh(const Entity& entity);
+  /// Records the given model matrix as the entity's latest simulated one, & interpolates it with the previous one according to the current
+  ///  step interpolation (see System::getStepInterpolation()). The matrices themselves are linearly interpolated, which is exact for
+  ///  translations & approximate for rotations, given that each fixed step only changes them slightly.
+  /// If the matrix changed without any fixed step being made, or if more than one step has been made since the last call, the entity is
+  ///  considered to have been teleported & its matrix is returned as is.
+  /// \param entityId ID of the entity to which the matrix belongs.
+  /// \param modelMatrix Model matrix resulting from the latest simulation step.
+  /// \return Model matrix to be drawn.
+  Mat4f interpolateModelMatrix(std::size_t entityId, const Mat4f& modelMatrix);
+  /// Removes the meshes removed since the last call from the states which may still be drawn, & would otherwise be dangling.
+  /// The state mutex must be locked beforehand.
+  void purgeRemovedMeshes();
 
   unsigned int m_sceneWidth {};
   unsigned int m_sceneHeight {};
 
   WindowPtr m_window {};
   Entity m_cameraEntity = Entity(0);
+  const Query<const Transform, const Mesh>* m_meshes {}; ///< Query giving the meshes outside of any hierarchy, along with their transforms.
+  const Query<const SceneNode, const Mesh>* m_nodeMeshes {}; ///< Query giving the meshes placed in a hierarchy, along with their nodes.
 
   std::array<RenderPassPtr, static_cast<std::size_t>(RenderPassType::RENDER_PASS_COUNT)> m_renderPasses {};
   UniformBuffer m_cameraUbo = UniformBuffer(sizeof(Mat4f) * 5 + sizeof(Vec4f), 0);
 
   CubemapPtr m_cubemap {};
+
+  /// Render states, respectively being extracted, ready to be drawn & drawn; the extraction & the drawing thus never wait for each other.
+  std::array<RenderState, 3> m_renderStates {};
+  std::size_t m_extractedStateIndex = 0;
+  std::size_t m_readyStateIndex = 1;
+  std::size_t m_renderedStateIndex = 2;
+  bool m_hasReadyState {};
+  std::mutex m_stateMutex {};
+  std::vector<RenderState::LightInstance> m_sentLights {};
+  std::vector<const Mesh*> m_entityMeshes {}; ///< Mesh held by each linked entity, indexed by the entity's ID; null if it holds none.
+  std::vector<const Mesh*> m_removedMeshes {}; ///< Meshes removed since the last rendering, which states extracted before may reference.
+
+  struct ModelMatrices {
+    Mat4f previous {};
+    Mat4f current {};
+    std::uint64_t fixedStepCount {}; ///< Amount of fixed steps made by the World when the current matrix was recorded.
+    bool isRecorded {};
+  };
+
+  std::vector<ModelMatrices> m_modelMatrices {}; ///< Last simulated model matrices of each drawn entity, indexed by the entity's ID.
 };
 
 } // namespace Raz
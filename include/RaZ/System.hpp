@@ -6,6 +6,8 @@
 #include "RaZ/Entity.hpp"
 #include "RaZ/Utils/Bitset.hpp"
 
+#include <chrono>
+#include <string_view>
 #include <vector>
 
 namespace Raz {
@@ -13,6 +15,9 @@ namespace Raz {
 class System;
 using SystemPtr = std::unique_ptr<System>;
 
+class SystemGraph;
+class World;
+
 /// System class representing a base System to be inherited.
 class System {
 public:
@@ -20,6 +25,59 @@ public:
   System(System&&) noexcept = delete;
 
   const Bitset& getAcceptedComponents() const { return m_acceptedComponents; }
+  const Bitset& getReadComponents() const noexcept { return m_readComponents; }
+  const Bitset& getWrittenComponents() const noexcept { return m_writtenComponents; }
+  /// Tells if the system has declared the components it reads or writes.
+  /// If not, it is considered to possibly access any component, & is thus never updated concurrently with any other system.
+  /// \return True if the system has declared its accesses, false otherwise.
+  bool hasDeclaredAccesses() const noexcept { return !(m_readComponents.isEmpty() && m_writtenComponents.isEmpty()); }
+  /// Tells if the system must be updated on the thread updating its World, for instance if it makes graphics API calls.
+  /// A system which hasn't declared its accesses is always updated on this thread.
+  /// \return True if the system must be updated on the World's thread, false otherwise.
+  bool isMainThreadRequired() const noexcept { return (m_isMainThreadRequired || !hasDeclaredAccesses()); }
+  /// Tells if the system must be updated at the fixed simulation step of its World, for instance if it integrates physics.
+  /// The other systems are updated once per frame, with the frame's variable duration.
+  /// \return True if the system must be updated at a fixed step, false otherwise.
+  bool isFixedStepRequired() const noexcept { return m_isFixedStepRequired; }
+  /// Gets the progression of the current frame between the last two fixed simulation steps, allowing to interpolate the simulated state.
+  /// This is only relevant to systems updated at a variable step; it is always 0 if the World isn't updated at a fixed step.
+  /// \return Interpolation factor between 0 (last step's state) & 1 (next step's state).
+  float getStepInterpolation() const noexcept { return m_stepInterpolation; }
+  /// Gets the amount of fixed simulation steps made by the World, allowing to tell how many have been made since a previous update.
+  /// This is only relevant to systems updated at a variable step; it is always 0 if the World isn't updated at a fixed step.
+  /// \return Amount of fixed steps made by the World.
+  std::uint64_t getFixedStepCount() const noexcept { return m_fixedStepCount; }
+  /// Tells if the system's rendering is pipelined: its updates then only prepare frames, each drawn by render() on the main thread, which
+  ///  the Application may do while the system's World is being updated.
+  /// \return True if the system is pipelined, false otherwise.
+  bool isPipelined() const noexcept { return m_isPipelined; }
+  /// Gets the components which the frames prepared by a pipelined system reference instead of copying them. Their rendering can only
+  ///  overlap the World's update if no other system of the World may write these components.
+  /// \return Components referenced by the prepared frames.
+  const Bitset& getRenderedComponents() const noexcept { return m_renderedComponents; }
+  /// Gets the change version of the component registry at the end of the system's last update.
+  /// During an update, the components modified since the previous one can be recovered by comparing their version to this one, for
+  ///  instance with Query::forEachChanged().
+  /// \return Change version at the end of the last update; 0 if the system has never been updated.
+  std::uint64_t getLastUpdateVersion() const noexcept { return m_lastUpdateVersion; }
+  /// Gets the name of the system's type, as recovered when it has been added to a World; it notably names the system's profiling zones.
+  /// \return Name of the system's type; empty if the system doesn't belong to a World.
+  std::string_view getTypeName() const noexcept { return m_typeName; }
+  /// Gets the amount of its World's updates between two updates of the system.
+  /// \return Update interval; 1 if the system is updated every time.
+  std::size_t getUpdateInterval() const noexcept { return m_updateInterval; }
+  /// Gets the maximal frequency at which the system is updated.
+  /// \return Maximal amount of updates per second; 0 if the system's updates are only limited by its interval.
+  float getUpdateFrequency() const noexcept { return m_updateFrequency; }
+  /// Gets the duration that the system's updates should not exceed.
+  /// \return Time budget in seconds; 0 if the system has none.
+  float getTimeBudget() const noexcept { return m_timeBudget; }
+  /// Gets the time taken by the system's last update.
+  /// \return Duration of the last update in seconds; 0 if the system has never been updated.
+  float getLastUpdateDuration() const noexcept { return m_lastUpdateDuration; }
+  /// Tells if the system's last update took longer than its time budget.
+  /// \return True if the system has a time budget & exceeded it, false otherwise.
+  bool hasExceededTimeBudget() const noexcept { return (m_timeBudget > 0.f && m_lastUpdateDuration > m_timeBudget); }
 
   /// Gets the ID of the given system.
   /// It uses CRTP to assign a different ID to each system it is called with.
@@ -28,21 +86,70 @@ public:
   /// \tparam T Type of the system to get the ID for.
   /// \return Given system's ID.
   template <typename T> static std::size_t getId();
+  /// Sets the amount of its World's updates between two updates of the system, allowing expensive but low-priority systems to be
+  ///  updated less often. The time given to the system's update is then the sum of those elapsed since its previous update.
+  /// A system requiring a fixed step (see isFixedStepRequired()) only counts the fixed steps.
+  /// \param updateCount Amount of World updates between two of the system's; must not be 0.
+  void setUpdateInterval(std::size_t updateCount) noexcept;
+  /// Sets the maximal frequency at which the system is updated; it is then only updated once at least 1 / frequency seconds have
+  ///  elapsed since its previous update, with all the time elapsed in the meantime. Unlike with a fixed step, the system is never updated
+  ///  several times to catch up with the elapsed time. If an update interval is also set, both conditions must be met.
+  /// \param frequency Maximal amount of updates per second; 0 to remove the limit.
+  void setUpdateFrequency(float frequency) noexcept;
+  /// Sets the duration that the system's updates should not exceed.
+  /// A system doing a large amount of work may check its remaining budget (see computeRemainingTimeBudget()) to stop once it has been
+  ///  spent, resuming its work on its next update. Updates exceeding their budget are reported by the World (see World::getBudgetOverruns()).
+  /// \param budget Time budget in seconds; 0 to remove it.
+  void setTimeBudget(float budget) noexcept;
+  /// Tells if the given entity is enabled & holds any of the components accepted by the system, & should thus be linked to it.
+  /// \param entity Entity to be checked.
+  /// \return True if the entity should be linked to the system, false otherwise.
+  bool acceptsEntity(const Entity& entity) const noexcept;
+  /// Checks if the system & the given one can't be updated concurrently.
+  /// This is the case if either of them writes components that the other accesses, or if any has not declared its accesses.
+  /// \param system System to be checked.
+  /// \return True if the systems must not be updated concurrently, false otherwise.
+  bool conflictsWith(const System& system) const noexcept;
+  /// Checks if the system contains the given entity.
+  /// This check is made in constant time.
+  /// \param entity Entity to be checked.
+  /// \return True if the system contains the entity, false otherwise.
+  bool containsEntity(const Entity& entity) const noexcept;
   /// Checks if the system contains the given entity.
   /// \param entity Entity to be checked.
   /// \return True if the system contains the entity, false otherwise.
-  bool containsEntity(const EntityPtr& entity);
+  bool containsEntity(const EntityPtr& entity) const noexcept { return containsEntity(*entity); }
   /// Links the entity to the system.
+  /// If the entity is already linked, nothing is done.
   /// \param entity Entity to be linked.
-  virtual void linkEntity(const EntityPtr& entity);
+  virtual void linkEntity(Entity& entity);
+  /// Links the entity to the system.
+  /// \param entity Entity to be linked.
+  void linkEntity(const EntityPtr& entity) { linkEntity(*entity); }
+  /// Unlinks the entity from the system in constant time; the last linked entity takes its place.
+  /// If the entity isn't linked, nothing is done.
+  /// \param entity Entity to be unlinked.
+  virtual void unlinkEntity(Entity& entity);
   /// Unlinks the entity from the system.
   /// \param entity Entity to be unlinked.
-  virtual void unlinkEntity(const EntityPtr& entity);
+  void unlinkEntity(const EntityPtr& entity) { unlinkEntity(*entity); }
+  /// Handles a structural modification of an entity which is linked to the system & stays so, as done by the World on refresh.
+  /// Nothing is done by default; systems keeping data about their entities' components can override it to update this data.
+  /// \param entity Entity which has been modified.
+  virtual void relinkEntity(Entity& /* entity */) {}
+  /// Links the system to the component registry of the World it has been added to, allowing it to make queries on the world's entities.
+  /// \param registry Component registry to be linked.
+  virtual void linkComponentRegistry(ComponentRegistry& registry) { m_componentRegistry = &registry; }
   /// Updates the system.
   /// This function is pure virtual and so must be reimplemented in the derived classes.
   /// \param deltaTime Time elapsed since the last update.
   /// \return True if the system is still active, false otherwise.
   virtual bool update(float deltaTime) = 0;
+  /// Draws the last frame prepared by the system's updates; this is only called on pipelined systems (see isPipelined()).
+  /// This is made on the main thread, possibly while the system's World is being updated: only the prepared frame & the components
+  ///  declared as rendered (see getRenderedComponents()) may thus be accessed.
+  /// \return True if the system is still active, false otherwise.
+  virtual bool render() { return true; }
   /// Destroys the system.
   virtual void destroy() {}
 
@@ -54,10 +161,60 @@ public:
 protected:
   System() = default;
 
+  /// Declares components as read by the system during its update.
+  /// \tparam Comps Types of the components read by the system.
+  template <typename... Comps> void registerReadComponents();
+  /// Declares components as written by the system during its update. A written component doesn't have to also be declared as read.
+  /// \tparam Comps Types of the components written by the system.
+  template <typename... Comps> void registerWrittenComponents();
+  /// Declares components as referenced by the frames that the system prepares when pipelined, & thus read while they are rendered.
+  /// \tparam Comps Types of the components referenced by the prepared frames.
+  template <typename... Comps> void registerRenderedComponents();
+  /// Requires the system to be updated on the thread updating its World.
+  void requireMainThread() noexcept { m_isMainThreadRequired = true; }
+  /// Requires the system to be updated at the fixed simulation step of its World.
+  void requireFixedStep() noexcept { m_isFixedStepRequired = true; }
+  /// Computes the time left to the current update before it exceeds the system's time budget.
+  /// A time-sliced system should check it regularly during its update, & stop its work to resume it on the next one once it is spent.
+  /// \return Remaining time in seconds, negative if the budget has been exceeded; infinite if the system has no budget.
+  float computeRemainingTimeBudget() const noexcept;
+  /// Tells if the system's time budget has been spent during the current update.
+  /// \return True if the system has a time budget & no time is left, false otherwise.
+  bool isTimeBudgetSpent() const noexcept { return (computeRemainingTimeBudget() <= 0.f); }
+
   std::vector<Entity*> m_entities {};
+  std::vector<std::size_t> m_entityIndices {}; ///< Positions of the linked entities in m_entities, indexed by their ID.
   Bitset m_acceptedComponents {};
+  Bitset m_readComponents {};
+  Bitset m_writtenComponents {};
+  Bitset m_renderedComponents {};
+  bool m_isMainThreadRequired {};
+  bool m_isFixedStepRequired {};
+  bool m_isPipelined {};
+  ComponentRegistry* m_componentRegistry {};
 
 private:
+  friend SystemGraph;
+  friend World;
+
+  /// Accounts for an update of the system's World, telling if the system is due to be updated according to its interval & frequency.
+  /// \param deltaTime Time elapsed since the World's last update.
+  /// \return True if the system must be updated, false if it must be skipped.
+  bool accumulateUpdate(float deltaTime) noexcept;
+
+  float m_stepInterpolation {};
+  std::uint64_t m_fixedStepCount {};
+  std::uint64_t m_lastUpdateVersion {};
+  std::string_view m_typeName {};
+
+  std::size_t m_updateInterval = 1;
+  float m_updateFrequency {};
+  float m_timeBudget {};
+  std::size_t m_skippedUpdateCount {}; ///< Amount of the World's updates since the system's last one.
+  float m_elapsedTime {}; ///< Time elapsed since the system's last update.
+  std::chrono::steady_clock::time_point m_updateStartTime {};
+  float m_lastUpdateDuration {};
+
   static inline std::size_t m_maxId = 0;
 };
 
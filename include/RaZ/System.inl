@@ -9,4 +9,25 @@ std::size_t System::getId() {
   return id;
 }
 
+template <typename... Comps>
+void System::registerReadComponents() {
+  static_assert((std::is_base_of_v<Component, Comps> && ...), "Error: Read components must be derived from Component.");
+
+  (m_readComponents.setBit(Component::getId<Comps>()), ...);
+}
+
+template <typename... Comps>
+void System::registerWrittenComponents() {
+  static_assert((std::is_base_of_v<Component, Comps> && ...), "Error: Written components must be derived from Component.");
+
+  (m_writtenComponents.setBit(Component::getId<Comps>()), ...);
+}
+
+template <typename... Comps>
+void System::registerRenderedComponents() {
+  static_assert((std::is_base_of_v<Component, Comps> && ...), "Error: Rendered components must be derived from Component.");
+
+  (m_renderedComponents.setBit(Component::getId<Comps>()), ...);
+}
+
 } // namespace Raz
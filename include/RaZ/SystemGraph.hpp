@@ -0,0 +1,84 @@
+#pragma once
+
+#ifndef RAZ_SYSTEMGRAPH_HPP
+#define RAZ_SYSTEMGRAPH_HPP
+
+#include "RaZ/System.hpp"
+#include "RaZ/Utils/Graph.hpp"
+
+#include <atomic>
+
+namespace Raz {
+
+class SystemGraph;
+
+/// SystemNode class, representing a system in a SystemGraph; its children are the systems that must be updated after it.
+class SystemNode final : public GraphNode<SystemNode> {
+  friend SystemGraph;
+
+public:
+  SystemNode(System& system, std::size_t systemIndex) : m_system{ &system }, m_systemIndex{ systemIndex } {}
+
+  const System& getSystem() const noexcept { return *m_system; }
+  System& getSystem() noexcept { return *m_system; }
+  std::size_t getSystemIndex() const noexcept { return m_systemIndex; }
+  std::size_t getParentCount() const noexcept { return m_parentCount; }
+  /// Tells if the system has been updated during the graph's last update, as it may be skipped according to its update rate.
+  /// \return True if the system has been updated, false otherwise.
+  bool isUpdated() const noexcept { return m_isUpdated; }
+
+private:
+  System* m_system {};
+  std::size_t m_systemIndex {};
+  std::size_t m_parentCount {};
+  std::atomic<std::size_t> m_remainingParentCount {}; ///< Amount of parents still to be updated during the current update.
+  bool m_isActive = true; ///< Result of the system's last update.
+  bool m_isUpdated {};
+};
+
+/// SystemGraph class, ordering systems in a directed acyclic graph according to the components they access.
+/// Two conflicting systems (one of them writing components the other one accesses) are always updated in their index order, while
+///  the others can be updated concurrently on the default thread pool.
+class SystemGraph {
+public:
+  SystemGraph() = default;
+  SystemGraph(const SystemGraph&) = delete;
+  SystemGraph(SystemGraph&&) noexcept = default;
+
+  const Graph<SystemNode>& getGraph() const noexcept { return m_graph; }
+
+  /// Builds the graph from the given systems, replacing the current one.
+  /// \param systems Systems to be ordered, indexed by their ID; some may be null.
+  /// \param activeSystems Bitset telling which systems are active; only these are added into the graph.
+  void build(const std::vector<SystemPtr>& systems, const Bitset& activeSystems);
+  /// Updates all the systems, each once all the systems it depends on have been updated.
+  /// The calling thread takes part in the update; the systems requiring it are always updated on this thread.
+  /// If any system throws an exception, the others are still updated, after which the first exception thrown is rethrown.
+  /// \param deltaTime Time elapsed since the last update.
+  /// \param activeSystems Bitset telling which systems are active; the systems which become inactive are disabled in it.
+  /// \return True if any system has become inactive, in which case the graph should be rebuilt, false otherwise.
+  bool update(float deltaTime, Bitset& activeSystems);
+
+  SystemGraph& operator=(const SystemGraph&) = delete;
+  SystemGraph& operator=(SystemGraph&&) noexcept = default;
+
+private:
+  struct UpdateState;
+
+  /// Updates the given node's system, then releases its children; the first child which can be updated on the current thread is
+  ///  so right away, the others being scheduled.
+  /// \param node Node to be updated.
+  /// \param state State of the current update.
+  /// \param isMainThread True if called from the thread updating the graph, false otherwise.
+  static void updateNode(SystemNode& node, UpdateState& state, bool isMainThread);
+  /// Schedules the given node to be updated, either by the thread pool or by the thread updating the graph if its system requires it.
+  /// \param node Node to be scheduled.
+  /// \param state State of the current update.
+  static void scheduleNode(SystemNode& node, UpdateState& state);
+
+  Graph<SystemNode> m_graph {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_SYSTEMGRAPH_HPP
@@ -0,0 +1,140 @@
+#pragma once
+
+#ifndef RAZ_AABBTREE_HPP
+#define RAZ_AABBTREE_HPP
+
+#include "RaZ/Math/Vector.hpp"
+#include "RaZ/Utils/Frustum.hpp"
+#include "RaZ/Utils/Ray.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <limits>
+#include <vector>
+
+namespace Raz {
+
+/// AABBTree class, a bounding volume hierarchy whose leaves are axis-aligned boxes which can be inserted, moved & removed at any time.
+/// Each leaf, or proxy, holds a box enlarged by a margin; moving a proxy only modifies the tree when its new box gets out of the
+///  enlarged one. The tree is kept balanced by rotations, so that queries are done in logarithmic time.
+/// Queries never modify the tree, & can thus be made concurrently from several threads.
+/// \tparam T Type of the values associated to the proxies; must be default-constructible & copyable.
+template <typename T>
+class AABBTree {
+public:
+  static constexpr std::size_t InvalidIndex = std::numeric_limits<std::size_t>::max();
+
+  AABBTree() = default;
+  /// Creates a tree whose proxies' boxes are enlarged by the given margin.
+  /// \param margin Distance by which the boxes are enlarged on each side.
+  explicit AABBTree(float margin) noexcept : m_margin{ margin } {}
+
+  std::size_t getProxyCount() const noexcept { return m_proxyCount; }
+  bool isEmpty() const noexcept { return (m_proxyCount == 0); }
+  /// Gets the height of the tree, which is the amount of nodes on the longest path from the root to a leaf.
+  /// \return Height of the tree; 0 if it is empty.
+  std::size_t getHeight() const noexcept { return (m_rootIndex == InvalidIndex ? 0 : m_nodes[m_rootIndex].height + 1); }
+  float getMargin() const noexcept { return m_margin; }
+  /// Gets the value associated to the given proxy.
+  /// \param proxyId ID of the proxy; must exist.
+  /// \return Proxy's value.
+  const T& getValue(std::size_t proxyId) const noexcept { return m_nodes[proxyId].value; }
+  /// Gets the enlarged box held by the given proxy.
+  /// \param proxyId ID of the proxy; must exist.
+  /// \return Proxy's enlarged box.
+  AABB getFatBox(std::size_t proxyId) const { return AABB(m_nodes[proxyId].minPos, m_nodes[proxyId].maxPos); }
+
+  /// Sets the margin by which the boxes are enlarged; it only applies to the proxies inserted or reinserted afterward.
+  /// \param margin Distance by which the boxes are enlarged on each side.
+  void setMargin(float margin) noexcept { m_margin = margin; }
+
+  /// Inserts a proxy in the tree.
+  /// \param box Box of the proxy.
+  /// \param value Value associated to the proxy.
+  /// \return ID of the proxy, which stays valid until the proxy is removed.
+  std::size_t insert(const AABB& box, T value);
+  /// Removes a proxy from the tree.
+  /// \param proxyId ID of the proxy to be removed; must exist.
+  void remove(std::size_t proxyId);
+  /// Moves a proxy; the tree is only modified if the new box is not contained in the proxy's enlarged box.
+  /// \param proxyId ID of the proxy to be moved; must exist.
+  /// \param box New box of the proxy.
+  /// \return True if the proxy has been reinserted, false if it didn't need to be.
+  bool update(std::size_t proxyId, const AABB& box);
+  /// Removes all the proxies.
+  void clear() noexcept;
+
+  /// Finds the proxies whose enlarged box intersects the given box.
+  /// \tparam FuncT Type of the function to be called.
+  /// \param box Box to be checked.
+  /// \param func Function to be called with the value of each found proxy.
+  template <typename FuncT> void query(const AABB& box, FuncT&& func) const;
+  /// Finds the proxies whose enlarged box intersects the given sphere.
+  /// \tparam FuncT Type of the function to be called.
+  /// \param sphere Sphere to be checked.
+  /// \param func Function to be called with the value of each found proxy.
+  template <typename FuncT> void query(const Sphere& sphere, FuncT&& func) const;
+  /// Finds the proxies whose enlarged box intersects the given frustum.
+  /// \tparam FuncT Type of the function to be called.
+  /// \param frustum Frustum to be checked.
+  /// \param func Function to be called with the value of each found proxy.
+  template <typename FuncT> void query(const Frustum& frustum, FuncT&& func) const;
+  /// Finds the proxies whose enlarged box is hit by the given ray.
+  /// \tparam FuncT Type of the function to be called.
+  /// \param ray Ray to be cast.
+  /// \param func Function to be called with the value of each found proxy.
+  template <typename FuncT> void query(const Ray& ray, FuncT&& func) const;
+  /// Finds the proxies whose enlarged box is hit by the given ray before the given distance.
+  /// The proxies are found in no particular order; the boxes being only approximations, the actual hits should be checked afterward.
+  /// \tparam FuncT Type of the function to be called.
+  /// \param ray Ray to be cast.
+  /// \param maxDistance Distance from the ray's origin beyond which boxes are ignored.
+  /// \param func Function to be called with the value of each found proxy & the distance at which the ray enters its box (0 if its
+  ///   origin is inside).
+  template <typename FuncT> void raycast(const Ray& ray, float maxDistance, FuncT&& func) const;
+
+private:
+  /// Depth up to which the traversals don't allocate; the tree being balanced, it allows holding far more proxies than memory can.
+  static constexpr std::size_t InlineTraversalDepth = 64;
+
+  struct Node {
+    Vec3f minPos {};
+    Vec3f maxPos {};
+    std::size_t parentIndex = InvalidIndex; ///< Index of the parent node, or of the next free node if this one is free.
+    std::size_t firstChildIndex = InvalidIndex;
+    std::size_t secondChildIndex = InvalidIndex;
+    std::size_t height {}; ///< Height of the subtree starting from this node; 0 for a leaf, InvalidIndex for a free node.
+    T value {};
+
+    bool isLeaf() const noexcept { return (firstChildIndex == InvalidIndex); }
+  };
+
+  std::size_t allocateNode();
+  void freeNode(std::size_t nodeIndex) noexcept;
+  void insertLeaf(std::size_t leafIndex);
+  void removeLeaf(std::size_t leafIndex);
+  /// Recomputes the boxes & heights of the given node & of all its ancestors, balancing them on the way.
+  /// \param nodeIndex Index of the first node to be refitted.
+  void refitAncestors(std::size_t nodeIndex);
+  /// Rotates the given node with one of its children if it is unbalanced.
+  /// \param nodeIndex Index of the node to be balanced.
+  /// \return Index of the node which took its place.
+  std::size_t balance(std::size_t nodeIndex);
+  /// Traverses the tree, descending only in the nodes whose box satisfies the given predicate.
+  /// \tparam OverlapFuncT Type of the predicate.
+  /// \tparam FuncT Type of the function to be called on each reached leaf.
+  /// \param overlaps Predicate taking the minimal & maximal points of a node's box.
+  /// \param func Function to be called with each reached leaf.
+  template <typename OverlapFuncT, typename FuncT> void traverse(OverlapFuncT&& overlaps, FuncT&& func) const;
+
+  std::vector<Node> m_nodes {};
+  std::size_t m_rootIndex = InvalidIndex;
+  std::size_t m_firstFreeIndex = InvalidIndex;
+  std::size_t m_proxyCount {};
+  float m_margin = 0.1f;
+};
+
+} // namespace Raz
+
+#include "RaZ/Utils/AABBTree.inl"
+
+#endif // RAZ_AABBTREE_HPP
@@ -0,0 +1,394 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+
+namespace Raz {
+
+namespace AABBTreeUtils {
+
+inline Vec3f computeMin(const Vec3f& firstPos, const Vec3f& secondPos) noexcept {
+  return Vec3f(std::min(firstPos[0], secondPos[0]), std::min(firstPos[1], secondPos[1]), std::min(firstPos[2], secondPos[2]));
+}
+
+inline Vec3f computeMax(const Vec3f& firstPos, const Vec3f& secondPos) noexcept {
+  return Vec3f(std::max(firstPos[0], secondPos[0]), std::max(firstPos[1], secondPos[1]), std::max(firstPos[2], secondPos[2]));
+}
+
+/// Computes the surface area of a box, estimating the probability for it to be hit by a query.
+inline float computeArea(const Vec3f& minPos, const Vec3f& maxPos) noexcept {
+  const Vec3f extents = maxPos - minPos;
+  return 2.f * (extents[0] * extents[1] + extents[1] * extents[2] + extents[2] * extents[0]);
+}
+
+inline float computeMergedArea(const Vec3f& firstMinPos, const Vec3f& firstMaxPos, const Vec3f& secondMinPos, const Vec3f& secondMaxPos) noexcept {
+  return computeArea(computeMin(firstMinPos, secondMinPos), computeMax(firstMaxPos, secondMaxPos));
+}
+
+} // namespace AABBTreeUtils
+
+template <typename T>
+std::size_t AABBTree<T>::insert(const AABB& box, T value) {
+  const std::size_t leafIndex = allocateNode();
+
+  Node& leaf  = m_nodes[leafIndex];
+  leaf.minPos = box.getLeftBottomBackPos() - m_margin;
+  leaf.maxPos = box.getRightTopFrontPos() + m_margin;
+  leaf.height = 0;
+  leaf.value  = std::move(value);
+
+  insertLeaf(leafIndex);
+  ++m_proxyCount;
+
+  return leafIndex;
+}
+
+template <typename T>
+void AABBTree<T>::remove(std::size_t proxyId) {
+  assert("Error: The proxy to be removed doesn't exist." && proxyId < m_nodes.size() && m_nodes[proxyId].isLeaf()
+                                                        && m_nodes[proxyId].height != InvalidIndex);
+
+  removeLeaf(proxyId);
+  freeNode(proxyId);
+  --m_proxyCount;
+}
+
+template <typename T>
+bool AABBTree<T>::update(std::size_t proxyId, const AABB& box) {
+  assert("Error: The proxy to be updated doesn't exist." && proxyId < m_nodes.size() && m_nodes[proxyId].isLeaf()
+                                                        && m_nodes[proxyId].height != InvalidIndex);
+
+  Node& leaf = m_nodes[proxyId];
+  const Vec3f& minPos = box.getLeftBottomBackPos();
+  const Vec3f& maxPos = box.getRightTopFrontPos();
+
+  if (minPos[0] >= leaf.minPos[0] && minPos[1] >= leaf.minPos[1] && minPos[2] >= leaf.minPos[2]
+   && maxPos[0] <= leaf.maxPos[0] && maxPos[1] <= leaf.maxPos[1] && maxPos[2] <= leaf.maxPos[2])
+    return false;
+
+  removeLeaf(proxyId);
+
+  m_nodes[proxyId].minPos = minPos - m_margin;
+  m_nodes[proxyId].maxPos = maxPos + m_margin;
+
+  insertLeaf(proxyId);
+
+  return true;
+}
+
+template <typename T>
+void AABBTree<T>::clear() noexcept {
+  m_nodes.clear();
+  m_rootIndex      = InvalidIndex;
+  m_firstFreeIndex = InvalidIndex;
+  m_proxyCount     = 0;
+}
+
+template <typename T>
+template <typename FuncT>
+void AABBTree<T>::query(const AABB& box, FuncT&& func) const {
+  const Vec3f& boxMinPos = box.getLeftBottomBackPos();
+  const Vec3f& boxMaxPos = box.getRightTopFrontPos();
+
+  traverse([&boxMinPos, &boxMaxPos] (const Vec3f& minPos, const Vec3f& maxPos) {
+    return (minPos[0] <= boxMaxPos[0] && maxPos[0] >= boxMinPos[0]
+         && minPos[1] <= boxMaxPos[1] && maxPos[1] >= boxMinPos[1]
+         && minPos[2] <= boxMaxPos[2] && maxPos[2] >= boxMinPos[2]);
+  }, [&func] (const Node& leaf) { func(leaf.value); });
+}
+
+template <typename T>
+template <typename FuncT>
+void AABBTree<T>::query(const Sphere& sphere, FuncT&& func) const {
+  const Vec3f& center = sphere.getCenter();
+  const float squaredRadius = sphere.getRadius() * sphere.getRadius();
+
+  traverse([&center, squaredRadius] (const Vec3f& minPos, const Vec3f& maxPos) {
+    const Vec3f closestPoint = AABBTreeUtils::computeMin(AABBTreeUtils::computeMax(center, minPos), maxPos);
+    return ((closestPoint - center).computeSquaredLength() <= squaredRadius);
+  }, [&func] (const Node& leaf) { func(leaf.value); });
+}
+
+template <typename T>
+template <typename FuncT>
+void AABBTree<T>::query(const Frustum& frustum, FuncT&& func) const {
+  traverse([&frustum] (const Vec3f& minPos, const Vec3f& maxPos) { return frustum.intersects(minPos, maxPos); },
+           [&func] (const Node& leaf) { func(leaf.value); });
+}
+
+template <typename T>
+template <typename FuncT>
+void AABBTree<T>::query(const Ray& ray, FuncT&& func) const {
+  raycast(ray, std::numeric_limits<float>::max(), [&func] (const T& value, float) { func(value); });
+}
+
+template <typename T>
+template <typename FuncT>
+void AABBTree<T>::raycast(const Ray& ray, float maxDistance, FuncT&& func) const {
+  const Vec3f& origin       = ray.getOrigin();
+  const Vec3f& invDirection = ray.getInverseDirection();
+
+  // Slab test, computing the distances at which the ray enters & exits the box on each axis; a missed box is infinitely far
+  const auto computeEntryDistance = [&origin, &invDirection] (const Vec3f& minPos, const Vec3f& maxPos) {
+    float entryDistance = 0.f;
+    float exitDistance  = std::numeric_limits<float>::max();
+
+    for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex) {
+      const float firstDistance  = (minPos[axisIndex] - origin[axisIndex]) * invDirection[axisIndex];
+      const float secondDistance = (maxPos[axisIndex] - origin[axisIndex]) * invDirection[axisIndex];
+
+      entryDistance = std::max(entryDistance, std::min(firstDistance, secondDistance));
+      exitDistance  = std::min(exitDistance, std::max(firstDistance, secondDistance));
+    }
+
+    return (entryDistance <= exitDistance ? entryDistance : std::numeric_limits<float>::infinity());
+  };
+
+  traverse([&computeEntryDistance, maxDistance] (const Vec3f& minPos, const Vec3f& maxPos) {
+    const float entryDistance = computeEntryDistance(minPos, maxPos);
+    return (entryDistance != std::numeric_limits<float>::infinity() && entryDistance <= maxDistance);
+  }, [&computeEntryDistance, &func] (const Node& leaf) {
+    func(leaf.value, computeEntryDistance(leaf.minPos, leaf.maxPos));
+  });
+}
+
+template <typename T>
+std::size_t AABBTree<T>::allocateNode() {
+  std::size_t nodeIndex {};
+
+  if (m_firstFreeIndex != InvalidIndex) {
+    nodeIndex        = m_firstFreeIndex;
+    m_firstFreeIndex = m_nodes[nodeIndex].parentIndex;
+  } else {
+    nodeIndex = m_nodes.size();
+    m_nodes.emplace_back();
+  }
+
+  Node& node = m_nodes[nodeIndex];
+  node.parentIndex      = InvalidIndex;
+  node.firstChildIndex  = InvalidIndex;
+  node.secondChildIndex = InvalidIndex;
+  node.height           = 0;
+
+  return nodeIndex;
+}
+
+template <typename T>
+void AABBTree<T>::freeNode(std::size_t nodeIndex) noexcept {
+  Node& node = m_nodes[nodeIndex];
+  node.parentIndex = m_firstFreeIndex;
+  node.height      = InvalidIndex;
+  node.value       = T{};
+
+  m_firstFreeIndex = nodeIndex;
+}
+
+template <typename T>
+void AABBTree<T>::insertLeaf(std::size_t leafIndex) {
+  if (m_rootIndex == InvalidIndex) {
+    m_rootIndex = leafIndex;
+    m_nodes[leafIndex].parentIndex = InvalidIndex;
+    return;
+  }
+
+  const Vec3f leafMinPos = m_nodes[leafIndex].minPos;
+  const Vec3f leafMaxPos = m_nodes[leafIndex].maxPos;
+
+  // Finding the best sibling for the leaf, descending where the area added to the tree would be minimal (surface area heuristic)
+  std::size_t siblingIndex = m_rootIndex;
+
+  while (!m_nodes[siblingIndex].isLeaf()) {
+    const Node& node = m_nodes[siblingIndex];
+
+    const float area         = AABBTreeUtils::computeArea(node.minPos, node.maxPos);
+    const float combinedArea = AABBTreeUtils::computeMergedArea(node.minPos, node.maxPos, leafMinPos, leafMaxPos);
+
+    // Cost of making a new parent for this node & the leaf, & minimal cost of pushing the leaf further down
+    const float cost            = 2.f * combinedArea;
+    const float inheritanceCost = 2.f * (combinedArea - area);
+
+    const auto computeDescentCost = [this, &leafMinPos, &leafMaxPos, inheritanceCost] (std::size_t childIndex) {
+      const Node& child = m_nodes[childIndex];
+      const float mergedArea = AABBTreeUtils::computeMergedArea(child.minPos, child.maxPos, leafMinPos, leafMaxPos);
+
+      return (child.isLeaf() ? mergedArea : mergedArea - AABBTreeUtils::computeArea(child.minPos, child.maxPos)) + inheritanceCost;
+    };
+
+    const float firstCost  = computeDescentCost(node.firstChildIndex);
+    const float secondCost = computeDescentCost(node.secondChildIndex);
+
+    if (cost < firstCost && cost < secondCost)
+      break;
+
+    siblingIndex = (firstCost < secondCost ? node.firstChildIndex : node.secondChildIndex);
+  }
+
+  // Creating a new parent for the sibling & the leaf; the nodes may be reallocated, no reference can be kept beforehand
+  const std::size_t newParentIndex = allocateNode();
+  const std::size_t oldParentIndex = m_nodes[siblingIndex].parentIndex;
+
+  Node& newParent = m_nodes[newParentIndex];
+  newParent.parentIndex      = oldParentIndex;
+  newParent.firstChildIndex  = siblingIndex;
+  newParent.secondChildIndex = leafIndex;
+  newParent.minPos           = AABBTreeUtils::computeMin(m_nodes[siblingIndex].minPos, leafMinPos);
+  newParent.maxPos           = AABBTreeUtils::computeMax(m_nodes[siblingIndex].maxPos, leafMaxPos);
+  newParent.height           = m_nodes[siblingIndex].height + 1;
+
+  if (oldParentIndex != InvalidIndex) {
+    Node& oldParent = m_nodes[oldParentIndex];
+    (oldParent.firstChildIndex == siblingIndex ? oldParent.firstChildIndex : oldParent.secondChildIndex) = newParentIndex;
+  } else {
+    m_rootIndex = newParentIndex;
+  }
+
+  m_nodes[siblingIndex].parentIndex = newParentIndex;
+  m_nodes[leafIndex].parentIndex    = newParentIndex;
+
+  refitAncestors(oldParentIndex);
+}
+
+template <typename T>
+void AABBTree<T>::removeLeaf(std::size_t leafIndex) {
+  if (leafIndex == m_rootIndex) {
+    m_rootIndex = InvalidIndex;
+    return;
+  }
+
+  const std::size_t parentIndex      = m_nodes[leafIndex].parentIndex;
+  const std::size_t grandParentIndex = m_nodes[parentIndex].parentIndex;
+  const Node& parent                 = m_nodes[parentIndex];
+  const std::size_t siblingIndex     = (parent.firstChildIndex == leafIndex ? parent.secondChildIndex : parent.firstChildIndex);
+
+  // The parent is removed, the sibling taking its place
+  m_nodes[siblingIndex].parentIndex = grandParentIndex;
+
+  if (grandParentIndex != InvalidIndex) {
+    Node& grandParent = m_nodes[grandParentIndex];
+    (grandParent.firstChildIndex == parentIndex ? grandParent.firstChildIndex : grandParent.secondChildIndex) = siblingIndex;
+  } else {
+    m_rootIndex = siblingIndex;
+  }
+
+  freeNode(parentIndex);
+  m_nodes[leafIndex].parentIndex = InvalidIndex;
+
+  refitAncestors(grandParentIndex);
+}
+
+template <typename T>
+void AABBTree<T>::refitAncestors(std::size_t nodeIndex) {
+  while (nodeIndex != InvalidIndex) {
+    nodeIndex = balance(nodeIndex);
+
+    Node& node = m_nodes[nodeIndex];
+    const Node& firstChild  = m_nodes[node.firstChildIndex];
+    const Node& secondChild = m_nodes[node.secondChildIndex];
+
+    node.minPos = AABBTreeUtils::computeMin(firstChild.minPos, secondChild.minPos);
+    node.maxPos = AABBTreeUtils::computeMax(firstChild.maxPos, secondChild.maxPos);
+    node.height = std::max(firstChild.height, secondChild.height) + 1;
+
+    nodeIndex = node.parentIndex;
+  }
+}
+
+template <typename T>
+std::size_t AABBTree<T>::balance(std::size_t nodeIndex) {
+  Node& node = m_nodes[nodeIndex];
+
+  if (node.isLeaf() || node.height < 2)
+    return nodeIndex;
+
+  const std::size_t firstIndex  = node.firstChildIndex;
+  const std::size_t secondIndex = node.secondChildIndex;
+  const auto heightDiff = static_cast<std::ptrdiff_t>(m_nodes[secondIndex].height) - static_cast<std::ptrdiff_t>(m_nodes[firstIndex].height);
+
+  if (heightDiff >= -1 && heightDiff <= 1)
+    return nodeIndex;
+
+  // The highest child is promoted in place of the node, which takes the lowest grandchild; the highest grandchild stays under the
+  //  promoted child
+  const bool isSecondPromoted   = (heightDiff > 1);
+  const std::size_t promotedIndex = (isSecondPromoted ? secondIndex : firstIndex);
+  const std::size_t keptIndex     = (isSecondPromoted ? firstIndex : secondIndex);
+
+  Node& promoted = m_nodes[promotedIndex];
+  const std::size_t firstGrandChildIndex  = promoted.firstChildIndex;
+  const std::size_t secondGrandChildIndex = promoted.secondChildIndex;
+
+  promoted.firstChildIndex = nodeIndex;
+  promoted.parentIndex     = node.parentIndex;
+  node.parentIndex         = promotedIndex;
+
+  if (promoted.parentIndex != InvalidIndex) {
+    Node& parent = m_nodes[promoted.parentIndex];
+    (parent.firstChildIndex == nodeIndex ? parent.firstChildIndex : parent.secondChildIndex) = promotedIndex;
+  } else {
+    m_rootIndex = promotedIndex;
+  }
+
+  const bool isFirstGrandChildHigher = (m_nodes[firstGrandChildIndex].height > m_nodes[secondGrandChildIndex].height);
+  const std::size_t highGrandChildIndex = (isFirstGrandChildHigher ? firstGrandChildIndex : secondGrandChildIndex);
+  const std::size_t lowGrandChildIndex  = (isFirstGrandChildHigher ? secondGrandChildIndex : firstGrandChildIndex);
+
+  promoted.secondChildIndex = highGrandChildIndex;
+  (isSecondPromoted ? node.secondChildIndex : node.firstChildIndex) = lowGrandChildIndex;
+  m_nodes[lowGrandChildIndex].parentIndex = nodeIndex;
+
+  const Node& kept          = m_nodes[keptIndex];
+  const Node& lowGrandChild = m_nodes[lowGrandChildIndex];
+  node.minPos = AABBTreeUtils::computeMin(kept.minPos, lowGrandChild.minPos);
+  node.maxPos = AABBTreeUtils::computeMax(kept.maxPos, lowGrandChild.maxPos);
+  node.height = std::max(kept.height, lowGrandChild.height) + 1;
+
+  const Node& highGrandChild = m_nodes[highGrandChildIndex];
+  promoted.minPos = AABBTreeUtils::computeMin(node.minPos, highGrandChild.minPos);
+  promoted.maxPos = AABBTreeUtils::computeMax(node.maxPos, highGrandChild.maxPos);
+  promoted.height = std::max(node.height, highGrandChild.height) + 1;
+
+  return promotedIndex;
+}
+
+template <typename T>
+template <typename OverlapFuncT, typename FuncT>
+void AABBTree<T>::traverse(OverlapFuncT&& overlaps, FuncT&& func) const {
+  if (m_rootIndex == InvalidIndex)
+    return;
+
+  // Only one node per level is pending at once, plus the root's two children; the stack is thus only allocated if the tree is deeper
+  //  than what the balancing should ever produce
+  const std::size_t maxStackSize = m_nodes[m_rootIndex].height + 1;
+
+  std::array<std::size_t, InlineTraversalDepth> inlineStack {};
+  std::vector<std::size_t> allocatedStack;
+  std::size_t* stack = inlineStack.data();
+
+  if (maxStackSize > InlineTraversalDepth) {
+    allocatedStack.resize(maxStackSize);
+    stack = allocatedStack.data();
+  }
+
+  std::size_t stackSize = 0;
+
+  stack[stackSize++] = m_rootIndex;
+
+  while (stackSize > 0) {
+    const Node& node = m_nodes[stack[--stackSize]];
+
+    if (!overlaps(node.minPos, node.maxPos))
+      continue;
+
+    if (node.isLeaf()) {
+      func(node);
+      continue;
+    }
+
+    assert("Error: The traversal stack is too small for the tree's height." && stackSize + 2 <= std::max(maxStackSize, InlineTraversalDepth));
+
+    stack[stackSize++] = node.firstChildIndex;
+    stack[stackSize++] = node.secondChildIndex;
+  }
+}
+
+} // namespace Raz
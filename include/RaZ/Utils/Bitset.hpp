@@ -3,28 +3,73 @@
 #ifndef RAZ_BITSET_HPP
 #define RAZ_BITSET_HPP
 
-#include <algorithm>
-#include <iostream>
+#include <array>
+#include <cstdint>
+#include <functional>
 #include <initializer_list>
-#include <vector>
+#include <iostream>
+#include <memory>
+#include <utility>
 
 namespace Raz {
 
+/// Bitset class, storing bits packed into 64-bit words.
+/// Up to InlineWordCount words are stored directly within the object; only bigger bitsets allocate memory on the heap.
 class Bitset {
 public:
+  using WordType = std::uint64_t;
+
+  /// Amount of bits held by a single word.
+  static constexpr std::size_t WordBitCount = sizeof(WordType) * 8;
+  /// Amount of words stored inline, below which no heap allocation is made.
+  static constexpr std::size_t InlineWordCount = 2;
+
   Bitset() = default;
-  explicit Bitset(std::size_t bitCount, bool initVal = false) : m_bits(bitCount, initVal) {}
-  Bitset(std::initializer_list<bool> values) : m_bits(values.begin(), values.end()) {}
+  explicit Bitset(std::size_t bitCount, bool initVal = false);
+  Bitset(std::initializer_list<bool> values);
+  Bitset(const Bitset& bitset) { *this = bitset; }
+  Bitset(Bitset&& bitset) noexcept { *this = std::move(bitset); }
 
-  const std::vector<bool>& getBits() const { return m_bits; }
-  std::vector<bool>& getBits() { return m_bits; }
-  std::size_t getSize() const { return m_bits.size(); }
+  std::size_t getSize() const noexcept { return m_bitCount; }
+  std::size_t getWordCount() const noexcept { return computeWordCount(m_bitCount); }
+  /// Gets the words in which the bits are packed, in increasing order.
+  /// Bits beyond the bitset's size in the last word are always disabled.
+  /// \return Pointer to the first of getWordCount() words.
+  const WordType* getWords() const noexcept { return (m_heapWords ? m_heapWords.get() : m_inlineWords.data()); }
 
-  bool isEmpty() const;
-  std::size_t getEnabledBitCount() const { return static_cast<std::size_t>(std::count(m_bits.cbegin(), m_bits.cend(), true)); }
-  std::size_t getDisabledBitCount() const { return m_bits.size() - getEnabledBitCount(); }
+  bool isEmpty() const noexcept;
+  std::size_t getEnabledBitCount() const noexcept;
+  std::size_t getDisabledBitCount() const noexcept { return m_bitCount - getEnabledBitCount(); }
+  /// Finds the first enabled bit.
+  /// \return Position of the first enabled bit, or the bitset's size if none is.
+  std::size_t findFirstEnabledBit() const noexcept { return findNextEnabledBit(0); }
+  /// Finds the first enabled bit from the given position, included.
+  /// \param startPos Position to start searching from.
+  /// \return Position of the first enabled bit from the given one, or the bitset's size if none is.
+  std::size_t findNextEnabledBit(std::size_t startPos) const noexcept;
+  /// Finds the last enabled bit.
+  /// \return Position of the last enabled bit, or the bitset's size if none is.
+  std::size_t findLastEnabledBit() const noexcept;
+  /// Checks if at least one bit is enabled in both the current & the given bitsets.
+  /// \param bitset Bitset to be checked.
+  /// \return True if the bitsets have an enabled bit in common, false otherwise.
+  bool intersects(const Bitset& bitset) const noexcept;
+  /// Checks if every enabled bit of the current bitset is also enabled in the given one.
+  /// \param bitset Bitset to be checked.
+  /// \return True if the current bitset is a subset of the given one, false otherwise.
+  bool isSubsetOf(const Bitset& bitset) const noexcept;
+  /// Calls the given function for each enabled bit, in increasing order.
+  /// \tparam FuncT Type of the function to be called.
+  /// \param func Function to be called, taking the position (std::size_t) of an enabled bit.
+  template <typename FuncT> void forEachEnabledBit(FuncT&& func) const;
+  /// Computes the hash of the bitset, which is equal for bitsets comparing equal.
+  /// \param seed Value to use as a hash seed.
+  /// \return Bitset's hash.
+  std::size_t hash(std::size_t seed = 0) const noexcept;
   void setBit(std::size_t position, bool value = true);
-  void resize(std::size_t newSize) { m_bits.resize(newSize); }
+  void resize(std::size_t newSize);
+  /// Disables all bits, keeping the bitset's size.
+  void reset() noexcept;
 
   Bitset operator~() const;
   Bitset operator&(const Bitset& bitset) const;
@@ -32,21 +77,46 @@ public:
   Bitset operator^(const Bitset& bitset) const;
   Bitset operator<<(std::size_t shift) const;
   Bitset operator>>(std::size_t shift) const;
-  Bitset& operator|=(const Bitset& bitset);
-  Bitset& operator&=(const Bitset& bitset);
-  Bitset& operator^=(const Bitset& bitset);
+  Bitset& operator|=(const Bitset& bitset) noexcept;
+  Bitset& operator&=(const Bitset& bitset) noexcept;
+  Bitset& operator^=(const Bitset& bitset) noexcept;
   Bitset& operator<<=(std::size_t shift);
   Bitset& operator>>=(std::size_t shift);
-  bool operator[](std::size_t index) const { return m_bits[index]; }
-  bool operator==(const Bitset& bitset) const { return std::equal(m_bits.cbegin(), m_bits.cend(), bitset.getBits().cbegin()); }
-  bool operator!=(const Bitset& bitset) const { return !(*this == bitset); }
+  bool operator[](std::size_t index) const noexcept { return ((getWords()[index / WordBitCount] >> (index % WordBitCount)) & 1u); }
+  bool operator==(const Bitset& bitset) const noexcept;
+  bool operator!=(const Bitset& bitset) const noexcept { return !(*this == bitset); }
+  Bitset& operator=(const Bitset& bitset);
+  Bitset& operator=(Bitset&& bitset) noexcept;
   friend std::ostream& operator<<(std::ostream& stream, const Bitset& bitset);
 
 private:
-  std::vector<bool> m_bits {};
+  static constexpr std::size_t computeWordCount(std::size_t bitCount) noexcept { return (bitCount + WordBitCount - 1) / WordBitCount; }
+  static std::size_t countEnabledBits(WordType word) noexcept;
+  static std::size_t countTrailingZeros(WordType word) noexcept;
+  static std::size_t countLeadingZeros(WordType word) noexcept;
+
+  WordType* getMutableWords() noexcept { return (m_heapWords ? m_heapWords.get() : m_inlineWords.data()); }
+  /// Makes sure the storage can hold at least the given amount of words, keeping the existing ones.
+  /// \param wordCount Minimal amount of words to be held.
+  void reserveWords(std::size_t wordCount);
+  /// Disables the bits of the last word which are beyond the bitset's size.
+  void clearTrailingBits() noexcept;
+
+  // Every bit beyond m_bitCount, up to the storage's capacity, is kept disabled
+  std::size_t m_bitCount {};
+  std::size_t m_wordCapacity = InlineWordCount;
+  std::array<WordType, InlineWordCount> m_inlineWords {};
+  std::unique_ptr<WordType[]> m_heapWords {};
 };
 
 } // namespace Raz
 
-#endif // RAZ_BITSET_HPP
+// Specializing std::hash for Bitset
+template <>
+struct std::hash<Raz::Bitset> {
+  std::size_t operator()(const Raz::Bitset& bitset) const noexcept { return bitset.hash(); }
+};
 
+#include "RaZ/Utils/Bitset.inl"
+
+#endif // RAZ_BITSET_HPP
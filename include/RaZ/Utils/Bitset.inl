@@ -0,0 +1,77 @@
+#include <cassert>
+
+#if defined(RAZ_COMPILER_MSVC)
+#include <intrin.h>
+#endif
+
+namespace Raz {
+
+template <typename FuncT>
+void Bitset::forEachEnabledBit(FuncT&& func) const {
+  const WordType* words       = getWords();
+  const std::size_t wordCount = getWordCount();
+
+  for (std::size_t wordIndex = 0; wordIndex < wordCount; ++wordIndex) {
+    WordType word = words[wordIndex];
+
+    while (word != 0) {
+      func(wordIndex * WordBitCount + countTrailingZeros(word));
+      word &= word - 1; // Disabling the lowest enabled bit
+    }
+  }
+}
+
+inline std::size_t Bitset::countEnabledBits(WordType word) noexcept {
+#if defined(RAZ_COMPILER_MSVC)
+  return static_cast<std::size_t>(__popcnt64(word));
+#elif defined(RAZ_COMPILER_GCC) || defined(RAZ_COMPILER_CLANG)
+  return static_cast<std::size_t>(__builtin_popcountll(word));
+#else
+  std::size_t count = 0;
+
+  for (; word != 0; word &= word - 1)
+    ++count;
+
+  return count;
+#endif
+}
+
+inline std::size_t Bitset::countTrailingZeros(WordType word) noexcept {
+  assert("Error: Cannot count the trailing zeros of a null word." && word != 0);
+
+#if defined(RAZ_COMPILER_MSVC)
+  unsigned long index {};
+  _BitScanForward64(&index, word);
+  return index;
+#elif defined(RAZ_COMPILER_GCC) || defined(RAZ_COMPILER_CLANG)
+  return static_cast<std::size_t>(__builtin_ctzll(word));
+#else
+  std::size_t count = 0;
+
+  for (; (word & 1u) == 0; word >>= 1u)
+    ++count;
+
+  return count;
+#endif
+}
+
+inline std::size_t Bitset::countLeadingZeros(WordType word) noexcept {
+  assert("Error: Cannot count the leading zeros of a null word." && word != 0);
+
+#if defined(RAZ_COMPILER_MSVC)
+  unsigned long index {};
+  _BitScanReverse64(&index, word);
+  return WordBitCount - 1 - index;
+#elif defined(RAZ_COMPILER_GCC) || defined(RAZ_COMPILER_CLANG)
+  return static_cast<std::size_t>(__builtin_clzll(word));
+#else
+  std::size_t count = 0;
+
+  for (WordType mask = WordType(1) << (WordBitCount - 1); (word & mask) == 0; mask >>= 1u)
+    ++count;
+
+  return count;
+#endif
+}
+
+} // namespace Raz
@@ -0,0 +1,51 @@
+#pragma once
+
+#ifndef RAZ_FRUSTUM_HPP
+#define RAZ_FRUSTUM_HPP
+
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <array>
+
+namespace Raz {
+
+/// Frustum class, representing the volume delimited by six planes, usually what a camera can see.
+/// The planes' normals point towards the inside of the frustum.
+class Frustum {
+public:
+  Frustum() = default;
+  explicit Frustum(const std::array<Plane, 6>& planes) : m_planes{ planes } {}
+  /// Creates a frustum from a view-projection matrix, applied to row vectors & giving a depth between 0 & 1 in clip space, like the
+  ///  matrices computed by Camera (viewMatrix * projectionMatrix).
+  /// \param viewProjMatrix View-projection matrix to extract the planes from.
+  explicit Frustum(const Mat4f& viewProjMatrix);
+
+  const std::array<Plane, 6>& getPlanes() const noexcept { return m_planes; }
+
+  /// Point containment check.
+  /// \param point Point to be checked.
+  /// \return True if the point is inside the frustum, false otherwise.
+  bool contains(const Vec3f& point) const noexcept;
+  /// Frustum-sphere intersection check.
+  /// \param sphere Sphere to check if there is an intersection with.
+  /// \return True if the sphere is at least partly inside the frustum, false otherwise.
+  bool intersects(const Sphere& sphere) const noexcept;
+  /// Frustum-AABB intersection check.
+  /// The check is conservative: a box lying outside of the frustum but near one of its corners may be considered intersecting it.
+  /// \param aabb AABB to check if there is an intersection with.
+  /// \return True if the box is at least partly inside the frustum, false otherwise.
+  bool intersects(const AABB& aabb) const noexcept { return intersects(aabb.getLeftBottomBackPos(), aabb.getRightTopFrontPos()); }
+  /// Frustum-AABB intersection check, taking the box's extremities.
+  /// \param minPos Minimal point of the box.
+  /// \param maxPos Maximal point of the box.
+  /// \return True if the box is at least partly inside the frustum, false otherwise.
+  bool intersects(const Vec3f& minPos, const Vec3f& maxPos) const noexcept;
+
+private:
+  std::array<Plane, 6> m_planes {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_FRUSTUM_HPP
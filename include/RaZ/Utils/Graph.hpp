@@ -3,6 +3,8 @@
 #ifndef RAZ_GRAPH_HPP
 #define RAZ_GRAPH_HPP
 
+#include <algorithm>
+#include <cassert>
 #include <memory>
 #include <vector>
 
@@ -65,7 +67,7 @@ public:
   Graph(const Graph&) = delete;
   Graph(Graph&&) noexcept = default;
 
-  const std::vector<const NodePtr>& getNodes() const noexcept { return m_nodes; }
+  const std::vector<NodePtr>& getNodes() const noexcept { return m_nodes; }
   const std::vector<NodePtr>& getNodes() noexcept { return m_nodes; }
 
   /// Adds a node into the graph.
@@ -0,0 +1,89 @@
+#pragma once
+
+#ifndef RAZ_MPMCQUEUE_HPP
+#define RAZ_MPMCQUEUE_HPP
+
+#include "RaZ/Utils/Threading.hpp"
+
+#ifdef RAZ_THREADS_AVAILABLE
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+namespace Raz {
+
+/// MpmcQueue class, a bounded lock-free queue to which any amount of threads can push elements & from which any amount can pop them.
+/// Each slot of the circular buffer holds a sequence number telling whether it is ready to be written or read for a given position;
+///  producers & consumers reserve a position by incrementing their respective index, then wait for no one but the slot's previous
+///  user. Pushing into a full queue or popping from an empty one fails instead of blocking.
+/// Once a position is reserved, the slot must be filled or emptied for the other threads to go on; constructing or move-assigning an
+///  element must therefore not throw, std::terminate() being called if it does.
+/// \tparam T Type of the elements to be stored.
+template <typename T>
+class MpmcQueue {
+public:
+  /// Creates a queue able to hold at least the given amount of elements.
+  /// \param capacity Minimal amount of elements the queue can hold; rounded up to the next power of two, & to at least 2.
+  explicit MpmcQueue(std::size_t capacity);
+  MpmcQueue(const MpmcQueue&) = delete;
+  MpmcQueue(MpmcQueue&&) noexcept = delete;
+
+  std::size_t getCapacity() const noexcept { return m_capacity; }
+  /// Gets the amount of elements in the queue.
+  /// \note If called while the queue is being modified, the result may already be outdated when returned. Elements being pushed or
+  ///  popped at the same time are counted as already pushed or popped.
+  /// \return Amount of elements waiting to be popped.
+  std::size_t getSize() const noexcept;
+  bool isEmpty() const noexcept { return (getSize() == 0); }
+
+  /// Constructs an element at the end of the queue, if it is not full. Can be called from any thread.
+  /// \tparam Args Types of the arguments to be forwarded to the element.
+  /// \param args Arguments to be forwarded to the element.
+  /// \return True if the element has been added, false if the queue is full.
+  template <typename... Args> bool tryEmplace(Args&&... args) noexcept;
+  /// Adds a copy of the given element at the end of the queue, if it is not full. Can be called from any thread.
+  /// \param value Element to be added.
+  /// \return True if the element has been added, false if the queue is full.
+  bool tryPush(const T& value) noexcept { return tryEmplace(value); }
+  /// Moves the given element at the end of the queue, if it is not full. Can be called from any thread.
+  /// \param value Element to be added; left untouched if the queue is full.
+  /// \return True if the element has been added, false if the queue is full.
+  bool tryPush(T&& value) noexcept { return tryEmplace(std::move(value)); }
+  /// Takes the element at the front of the queue, if it is not empty. Can be called from any thread.
+  /// \param value Element to be assigned the popped one.
+  /// \return True if an element has been popped, false if the queue is empty.
+  bool tryPop(T& value) noexcept;
+
+  MpmcQueue& operator=(const MpmcQueue&) = delete;
+  MpmcQueue& operator=(MpmcQueue&&) noexcept = delete;
+
+  /// Destroys the elements remaining in the queue.
+  ~MpmcQueue();
+
+private:
+  struct Slot {
+    /// Position for which the slot is ready: equal to it if it can be written, or to the position + 1 if it can be read.
+    std::atomic<std::size_t> sequence {};
+    alignas(T) std::byte data[sizeof(T)];
+  };
+
+  T& getElement(Slot& slot) noexcept { return *std::launder(reinterpret_cast<T*>(slot.data)); }
+
+  std::unique_ptr<Slot[]> m_slots {};
+  std::size_t m_capacity {};
+  std::size_t m_indexMask {};
+
+  // Each index is contended by all the threads on its side, & is thus kept away from the other one
+  alignas(Threading::CacheLineSize) std::atomic<std::size_t> m_writeIndex {};
+  alignas(Threading::CacheLineSize) std::atomic<std::size_t> m_readIndex {};
+};
+
+} // namespace Raz
+
+#include "RaZ/Utils/MpmcQueue.inl"
+
+#endif // RAZ_THREADS_AVAILABLE
+
+#endif // RAZ_MPMCQUEUE_HPP
@@ -0,0 +1,99 @@
+#include <cassert>
+
+namespace Raz {
+
+template <typename T>
+MpmcQueue<T>::MpmcQueue(std::size_t capacity) {
+  // With a single slot, a full slot's sequence would be equal to the next writing position, making the queue appear writable
+  m_capacity = 2;
+  while (m_capacity < capacity)
+    m_capacity *= 2;
+
+  m_indexMask = m_capacity - 1;
+  m_slots     = std::make_unique<Slot[]>(m_capacity);
+
+  for (std::size_t slotIndex = 0; slotIndex < m_capacity; ++slotIndex)
+    m_slots[slotIndex].sequence.store(slotIndex, std::memory_order_relaxed);
+}
+
+template <typename T>
+std::size_t MpmcQueue<T>::getSize() const noexcept {
+  const std::size_t readIndex  = m_readIndex.load(std::memory_order_acquire);
+  const std::size_t writeIndex = m_writeIndex.load(std::memory_order_acquire);
+
+  // Consumers may have reserved positions after the write index was loaded
+  return (writeIndex > readIndex ? writeIndex - readIndex : 0);
+}
+
+template <typename T>
+template <typename... Args>
+bool MpmcQueue<T>::tryEmplace(Args&&... args) noexcept {
+  std::size_t writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+  Slot* slot             = nullptr;
+
+  while (true) {
+    slot = &m_slots[writeIndex & m_indexMask];
+
+    const std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+    const auto difference      = static_cast<std::ptrdiff_t>(sequence - writeIndex);
+
+    if (difference == 0) {
+      // The slot is free for this position; reserving it if no other producer has done so in the meantime
+      if (m_writeIndex.compare_exchange_weak(writeIndex, writeIndex + 1, std::memory_order_relaxed))
+        break;
+    } else if (difference < 0) {
+      // The slot still holds the element pushed a full turn before, which has not been popped yet
+      return false;
+    } else {
+      // Another producer has already reserved this position
+      writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+    }
+  }
+
+  new (slot->data) T(std::forward<Args>(args)...);
+  slot->sequence.store(writeIndex + 1, std::memory_order_release);
+
+  return true;
+}
+
+template <typename T>
+bool MpmcQueue<T>::tryPop(T& value) noexcept {
+  std::size_t readIndex = m_readIndex.load(std::memory_order_relaxed);
+  Slot* slot            = nullptr;
+
+  while (true) {
+    slot = &m_slots[readIndex & m_indexMask];
+
+    const std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+    const auto difference      = static_cast<std::ptrdiff_t>(sequence - (readIndex + 1));
+
+    if (difference == 0) {
+      if (m_readIndex.compare_exchange_weak(readIndex, readIndex + 1, std::memory_order_relaxed))
+        break;
+    } else if (difference < 0) {
+      // The slot has not been written for this position yet
+      return false;
+    } else {
+      readIndex = m_readIndex.load(std::memory_order_relaxed);
+    }
+  }
+
+  T& element = getElement(*slot);
+  value = std::move(element);
+  element.~T();
+
+  // Making the slot writable for the position a full turn later
+  slot->sequence.store(readIndex + m_capacity, std::memory_order_release);
+
+  return true;
+}
+
+template <typename T>
+MpmcQueue<T>::~MpmcQueue() {
+  const std::size_t writeIndex = m_writeIndex.load(std::memory_order_acquire);
+
+  for (std::size_t readIndex = m_readIndex.load(std::memory_order_relaxed); readIndex != writeIndex; ++readIndex)
+    getElement(m_slots[readIndex & m_indexMask]).~T();
+}
+
+} // namespace Raz
@@ -0,0 +1,78 @@
+#pragma once
+
+#ifndef RAZ_OBJECTPOOL_HPP
+#define RAZ_OBJECTPOOL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Raz {
+
+/// ObjectPool class, constructing objects of a given type in fixed-size chunks of slots.
+/// Chunks are never reallocated, so that an object created by a pool keeps the same address for its whole lifetime. The slots of
+///  destroyed objects are kept in an intrusive free list, to be reused first by the next objects; destroying an object never allocates.
+/// The objects are not destroyed along with the pool: they must all have been destroyed beforehand.
+/// \tparam T Type of the objects to be stored.
+template <typename T>
+class ObjectPool {
+public:
+  /// Amount of objects held by a single chunk, chosen so that a chunk spans roughly 16 KiB.
+  static constexpr std::size_t ChunkCapacity = std::max<std::size_t>(16384 / sizeof(T), 1);
+
+  ObjectPool() = default;
+  ObjectPool(const ObjectPool&) = delete;
+  ObjectPool(ObjectPool&&) noexcept = default;
+
+  std::size_t getObjectCount() const noexcept { return m_objectCount; }
+  std::size_t getChunkCount() const noexcept { return m_chunks.size(); }
+  /// Gets the amount of objects the pool can hold without allocating any other chunk.
+  /// \return Amount of slots in all the chunks.
+  std::size_t getCapacity() const noexcept { return m_chunks.size() * ChunkCapacity; }
+  /// Gets the amount of slots which have held an object that has been destroyed since, & which are not reused yet.
+  /// \return Amount of slots in the free list.
+  std::size_t getFreeSlotCount() const noexcept { return m_freeSlotCount; }
+
+  /// Computes the ratio between the amount of objects & the pool's capacity.
+  /// \return Occupancy between 0 (empty) & 1 (full); 0 if the pool has no chunk.
+  float computeOccupancy() const noexcept;
+  /// Computes the proportion of the used slots that are free slots, left by destroyed objects among the living ones.
+  /// \return Fragmentation between 0 (objects stored without any gap) & 1 (all objects destroyed).
+  float computeFragmentation() const noexcept;
+  /// Allocates enough chunks to hold the given amount of objects without any further allocation.
+  /// \param objectCount Amount of objects to reserve slots for.
+  void reserve(std::size_t objectCount);
+  /// Constructs an object in the first available slot.
+  /// \tparam Args Types of the arguments to be forwarded to the object.
+  /// \param args Arguments to be forwarded to the object.
+  /// \return Reference to the newly created object.
+  template <typename... Args> T& emplace(Args&&... args);
+  /// Destroys the given object & makes its slot available for a future one.
+  /// \param object Object to be destroyed; must have been created by this pool.
+  void destroy(T& object) noexcept;
+
+  ObjectPool& operator=(const ObjectPool&) = delete;
+  ObjectPool& operator=(ObjectPool&&) noexcept = default;
+
+private:
+  union Slot {
+    Slot* nextFreeSlot;
+    alignas(T) std::byte data[sizeof(T)];
+  };
+
+  using Chunk = std::unique_ptr<Slot[]>;
+
+  std::vector<Chunk> m_chunks {};
+  std::size_t m_usedChunkCount {}; ///< Amount of chunks in which slots have already been given; the others are reserved.
+  std::size_t m_lastChunkSize {}; ///< Amount of slots already given in the last used chunk.
+  Slot* m_firstFreeSlot {};
+  std::size_t m_freeSlotCount {};
+  std::size_t m_objectCount {};
+};
+
+} // namespace Raz
+
+#include "RaZ/Utils/ObjectPool.inl"
+
+#endif // RAZ_OBJECTPOOL_HPP
@@ -0,0 +1,90 @@
+#include <new>
+
+namespace Raz {
+
+template <typename T>
+float ObjectPool<T>::computeOccupancy() const noexcept {
+  const std::size_t capacity = getCapacity();
+  return (capacity == 0 ? 0.f : static_cast<float>(m_objectCount) / static_cast<float>(capacity));
+}
+
+template <typename T>
+float ObjectPool<T>::computeFragmentation() const noexcept {
+  const std::size_t usedSlotCount = m_objectCount + m_freeSlotCount;
+  return (usedSlotCount == 0 ? 0.f : static_cast<float>(m_freeSlotCount) / static_cast<float>(usedSlotCount));
+}
+
+template <typename T>
+void ObjectPool<T>::reserve(std::size_t objectCount) {
+  // Free slots & those not given yet are all available, the pool thus being able to hold as many objects as its capacity
+  const std::size_t capacity = getCapacity();
+
+  if (objectCount <= capacity)
+    return;
+
+  const std::size_t chunkCount = (objectCount - capacity + ChunkCapacity - 1) / ChunkCapacity;
+  m_chunks.reserve(m_chunks.size() + chunkCount);
+
+  for (std::size_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+    m_chunks.emplace_back(std::make_unique<Slot[]>(ChunkCapacity));
+}
+
+template <typename T>
+template <typename... Args>
+T& ObjectPool<T>::emplace(Args&&... args) {
+  const bool reusesFreeSlot = (m_firstFreeSlot != nullptr);
+  Slot* slot                = nullptr;
+
+  if (reusesFreeSlot) {
+    slot            = m_firstFreeSlot;
+    m_firstFreeSlot = slot->nextFreeSlot;
+    --m_freeSlotCount;
+  } else {
+    if (m_usedChunkCount == 0 || m_lastChunkSize == ChunkCapacity) {
+      // Reserved chunks are used before allocating any new one
+      if (m_usedChunkCount == m_chunks.size())
+        m_chunks.emplace_back(std::make_unique<Slot[]>(ChunkCapacity));
+
+      ++m_usedChunkCount;
+      m_lastChunkSize = 0;
+    }
+
+    slot = &m_chunks[m_usedChunkCount - 1][m_lastChunkSize];
+  }
+
+  T* object = nullptr;
+
+  try {
+    object = new (slot->data) T(std::forward<Args>(args)...);
+  } catch (...) {
+    // The slot is only considered used once the object has been successfully constructed; it is given back to the free list otherwise
+    if (reusesFreeSlot) {
+      slot->nextFreeSlot = m_firstFreeSlot;
+      m_firstFreeSlot    = slot;
+      ++m_freeSlotCount;
+    }
+
+    throw;
+  }
+
+  if (!reusesFreeSlot)
+    ++m_lastChunkSize;
+
+  ++m_objectCount;
+
+  return *object;
+}
+
+template <typename T>
+void ObjectPool<T>::destroy(T& object) noexcept {
+  object.~T();
+
+  auto* slot         = reinterpret_cast<Slot*>(&object);
+  slot->nextFreeSlot = m_firstFreeSlot;
+  m_firstFreeSlot    = slot;
+
+  ++m_freeSlotCount;
+  --m_objectCount;
+}
+
+} // namespace Raz
@@ -0,0 +1,118 @@
+#pragma once
+
+#ifndef RAZ_PARALLELALGORITHMS_HPP
+#define RAZ_PARALLELALGORITHMS_HPP
+
+#include "RaZ/Utils/Threading.hpp"
+
+#ifdef RAZ_THREADS_AVAILABLE
+
+#include <functional>
+#include <iterator>
+
+namespace Raz::Threading {
+
+/// Minimal amount of elements for an algorithm to be executed in parallel; smaller ranges are processed sequentially by the standard
+///  algorithms, the cost of distributing them outweighing the gain. This is also the case of any range if the system has a single thread.
+constexpr std::size_t ParallelAlgorithmThreshold = 8192;
+
+/// Computes the amount of elements to be processed at once by a parallel algorithm.
+/// The range is split into a few chunks per thread so that the work can be balanced, each chunk spanning at least minGrainSize elements
+///  & a whole number of cache lines, so that no two threads write into the same cache line.
+/// \param elementCount Amount of elements to be processed.
+/// \param elementSize Size in bytes of a single element.
+/// \param minGrainSize Minimal amount of elements per chunk.
+/// \return Amount of elements per chunk.
+std::size_t computeGrainSize(std::size_t elementCount, std::size_t elementSize, std::size_t minGrainSize = 2048) noexcept;
+
+/// Sorts the given range in parallel, on the default thread pool & the calling thread.
+/// The range is split into as many runs as there are threads, each sorted independently, then merged by pairs; each merge being itself
+///  split between all threads. Equal elements are not guaranteed to keep their order. The elements are merged through a temporary
+///  buffer, & must therefore be default-constructible & movable.
+/// \tparam RandomIt Type of the range's iterators; must be random access.
+/// \tparam CompareFunc Type of the comparison function.
+/// \param begin Iterator to the range's first element.
+/// \param end Iterator past the range's last element.
+/// \param compare Function returning true if its first argument must be placed before its second one.
+template <typename RandomIt, typename CompareFunc = std::less<>>
+void parallelSort(RandomIt begin, RandomIt end, CompareFunc compare = {});
+
+/// Combines all the elements of the given range in parallel, on the default thread pool & the calling thread.
+/// Each chunk is reduced separately, the chunks' results being then combined in order; the operation must thus be associative, but not
+///  necessarily commutative.
+/// \tparam InputIt Type of the range's iterators; must be random access.
+/// \tparam T Type of the result.
+/// \tparam ReduceFunc Type of the reduction function.
+/// \param begin Iterator to the range's first element.
+/// \param end Iterator past the range's last element.
+/// \param init Initial value, combined once with the range's result.
+/// \param reduce Function combining two values into one.
+/// \return Combination of the initial value & all the elements.
+template <typename InputIt, typename T, typename ReduceFunc = std::plus<>>
+T parallelReduce(InputIt begin, InputIt end, T init, ReduceFunc reduce = {});
+
+/// Transforms all the elements of the given range & combines the results in parallel, on the default thread pool & the calling thread.
+/// \tparam InputIt Type of the range's iterators; must be random access.
+/// \tparam T Type of the result.
+/// \tparam ReduceFunc Type of the reduction function.
+/// \tparam TransformFunc Type of the transformation function.
+/// \param begin Iterator to the range's first element.
+/// \param end Iterator past the range's last element.
+/// \param init Initial value, combined once with the range's result.
+/// \param reduce Associative function combining two values into one.
+/// \param transform Function transforming an element into a value to be combined.
+/// \return Combination of the initial value & all the transformed elements.
+/// \see parallelReduce()
+template <typename InputIt, typename T, typename ReduceFunc, typename TransformFunc>
+T parallelTransformReduce(InputIt begin, InputIt end, T init, ReduceFunc reduce, TransformFunc transform);
+
+/// Computes the inclusive prefix sums of the given range in parallel, on the default thread pool & the calling thread.
+/// Each output element is the combination of all the input elements up to & including the one at the same position.
+/// The chunks are first reduced in parallel, their results scanned in order, then each chunk is scanned from its offset in parallel.
+/// \tparam InputIt Type of the input range's iterators; must be random access.
+/// \tparam OutputIt Type of the output range's iterator; must be random access. May be the same as the input one.
+/// \tparam ScanFunc Type of the combination function.
+/// \param begin Iterator to the input range's first element.
+/// \param end Iterator past the input range's last element.
+/// \param output Iterator to the output range's first element, which must be at least as large as the input one.
+/// \param scan Associative function combining two values into one.
+/// \return Iterator past the last written output element.
+template <typename InputIt, typename OutputIt, typename ScanFunc = std::plus<>>
+OutputIt parallelInclusiveScan(InputIt begin, InputIt end, OutputIt output, ScanFunc scan = {});
+
+/// Computes the exclusive prefix sums of the given range in parallel, on the default thread pool & the calling thread.
+/// Each output element is the combination of the initial value & all the input elements before the one at the same position.
+/// \tparam InputIt Type of the input range's iterators; must be random access.
+/// \tparam OutputIt Type of the output range's iterator; must be random access. May be the same as the input one.
+/// \tparam T Type of the initial value.
+/// \tparam ScanFunc Type of the combination function.
+/// \param begin Iterator to the input range's first element.
+/// \param end Iterator past the input range's last element.
+/// \param output Iterator to the output range's first element, which must be at least as large as the input one.
+/// \param init Initial value, which is the first output element.
+/// \param scan Associative function combining two values into one.
+/// \return Iterator past the last written output element.
+/// \see parallelInclusiveScan()
+template <typename InputIt, typename OutputIt, typename T, typename ScanFunc = std::plus<>>
+OutputIt parallelExclusiveScan(InputIt begin, InputIt end, OutputIt output, T init, ScanFunc scan = {});
+
+/// Reorders the given range in parallel so that all the elements satisfying the predicate come before those which don't.
+/// The chunks' matching elements are first counted in parallel, from which each chunk knows where to move its elements; the relative
+///  order of the elements is thus preserved in both groups. The elements are moved through a temporary buffer, & must therefore be
+///  default-constructible & movable.
+/// \tparam RandomIt Type of the range's iterators; must be random access.
+/// \tparam PredicateFunc Type of the predicate.
+/// \param begin Iterator to the range's first element.
+/// \param end Iterator past the range's last element.
+/// \param predicate Function returning true if the given element must be placed in the first group.
+/// \return Iterator to the first element of the second group.
+template <typename RandomIt, typename PredicateFunc>
+RandomIt parallelPartition(RandomIt begin, RandomIt end, PredicateFunc predicate);
+
+} // namespace Raz::Threading
+
+#include "RaZ/Utils/ParallelAlgorithms.inl"
+
+#endif // RAZ_THREADS_AVAILABLE
+
+#endif // RAZ_PARALLELALGORITHMS_HPP
@@ -0,0 +1,362 @@
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace Raz::Threading {
+
+namespace ParallelAlgorithmsUtils {
+
+/// Offsets the given iterator by the given amount of elements.
+/// \param iter Iterator to be offset.
+/// \param elementCount Amount of elements to move the iterator forward by.
+/// \return Offset iterator.
+template <typename It>
+It offset(It iter, std::size_t elementCount) { return iter + static_cast<typename std::iterator_traits<It>::difference_type>(elementCount); }
+
+/// Tells if a range is worth being processed in parallel.
+/// \param elementCount Amount of elements in the range.
+/// \return True if the range is large enough & the system can run several threads at once, false otherwise.
+inline bool isParallelizable(std::size_t elementCount) {
+  return (elementCount >= ParallelAlgorithmThreshold && getSystemThreadCount() > 1);
+}
+
+/// Calls the given function in parallel on each chunk of a range.
+/// \tparam Func Type of the function to be called.
+/// \param elementCount Amount of elements in the range.
+/// \param grainSize Amount of elements per chunk, the last one possibly holding fewer.
+/// \param func Function to be called with the chunk's index, & the indices of its first element & past its last one.
+template <typename Func>
+void forEachChunk(std::size_t elementCount, std::size_t grainSize, Func&& func) {
+  const std::size_t chunkCount = (elementCount + grainSize - 1) / grainSize;
+
+  parallelFor(IndexRange{ 0, chunkCount }, 1, [elementCount, grainSize, &func] (std::size_t chunkIndex) {
+    const std::size_t beginIndex = chunkIndex * grainSize;
+    func(chunkIndex, beginIndex, std::min(beginIndex + grainSize, elementCount));
+  });
+}
+
+/// Finds how many elements of the first sorted range are among the given amount of first elements of both ranges once merged, the
+///  elements of the first range coming before the equivalent ones of the second.
+/// \param outputIndex Amount of merged elements.
+/// \param first Iterator to the first range's first element.
+/// \param firstCount Amount of elements in the first range.
+/// \param second Iterator to the second range's first element.
+/// \param secondCount Amount of elements in the second range.
+/// \param compare Comparison function by which both ranges are sorted.
+/// \return Amount of elements taken from the first range.
+template <typename It, typename CompareFunc>
+std::size_t computeMergeSplit(std::size_t outputIndex, It first, std::size_t firstCount, It second, std::size_t secondCount,
+                              CompareFunc& compare) {
+  std::size_t lowIndex  = (outputIndex > secondCount ? outputIndex - secondCount : 0);
+  std::size_t highIndex = std::min(outputIndex, firstCount);
+
+  while (true) {
+    const std::size_t firstIndex  = lowIndex + (highIndex - lowIndex) / 2;
+    const std::size_t secondIndex = outputIndex - firstIndex;
+
+    if (firstIndex > 0 && secondIndex < secondCount && compare(*offset(second, secondIndex), *offset(first, firstIndex - 1))) {
+      highIndex = firstIndex - 1; // Too many elements taken from the first range
+    } else if (secondIndex > 0 && firstIndex < firstCount && !compare(*offset(second, secondIndex - 1), *offset(first, firstIndex))) {
+      lowIndex = firstIndex + 1; // Too few elements taken from the first range
+    } else {
+      return firstIndex;
+    }
+  }
+}
+
+/// Merges each pair of consecutive sorted runs from the source into the destination, in parallel. The merge of each pair is itself split
+///  into chunks, so that all threads take part in it even if there are fewer pairs than threads.
+/// \param source Iterator to the source's first element.
+/// \param destination Iterator to the destination's first element.
+/// \param runBoundaries Indices of the runs' first elements, followed by the total amount of elements.
+/// \param grainSize Amount of elements to be merged at once.
+/// \param compare Comparison function by which the runs are sorted.
+template <typename SrcIt, typename DstIt, typename CompareFunc>
+void mergeRuns(SrcIt source, DstIt destination, const std::vector<std::size_t>& runBoundaries, std::size_t grainSize, CompareFunc& compare) {
+  struct MergeChunk {
+    std::size_t runIndex;
+    std::size_t beginIndex; ///< Index of the chunk's first element within the merged pair.
+    std::size_t endIndex;   ///< Index past the chunk's last element within the merged pair.
+  };
+
+  std::vector<MergeChunk> chunks;
+  const std::size_t runCount = runBoundaries.size() - 1;
+
+  for (std::size_t runIndex = 0; runIndex < runCount; runIndex += 2) {
+    const std::size_t pairSize = runBoundaries[std::min(runIndex + 2, runCount)] - runBoundaries[runIndex];
+
+    for (std::size_t beginIndex = 0; beginIndex < pairSize; beginIndex += grainSize)
+      chunks.push_back(MergeChunk{ runIndex, beginIndex, std::min(beginIndex + grainSize, pairSize) });
+  }
+
+  parallelFor(IndexRange{ 0, chunks.size() }, 1, [&] (std::size_t chunkIndex) {
+    const MergeChunk& chunk = chunks[chunkIndex];
+    const std::size_t pairBeginIndex = runBoundaries[chunk.runIndex];
+    const DstIt output = offset(destination, pairBeginIndex + chunk.beginIndex);
+
+    // A run without any other to be merged with is simply moved as is
+    if (chunk.runIndex + 1 == runCount) {
+      std::move(offset(source, pairBeginIndex + chunk.beginIndex), offset(source, pairBeginIndex + chunk.endIndex), output);
+      return;
+    }
+
+    const SrcIt first        = offset(source, pairBeginIndex);
+    const SrcIt second       = offset(source, runBoundaries[chunk.runIndex + 1]);
+    const std::size_t firstCount  = runBoundaries[chunk.runIndex + 1] - pairBeginIndex;
+    const std::size_t secondCount = runBoundaries[chunk.runIndex + 2] - runBoundaries[chunk.runIndex + 1];
+
+    const std::size_t firstBeginIndex = computeMergeSplit(chunk.beginIndex, first, firstCount, second, secondCount, compare);
+    const std::size_t firstEndIndex   = computeMergeSplit(chunk.endIndex, first, firstCount, second, secondCount, compare);
+
+    std::merge(std::make_move_iterator(offset(first, firstBeginIndex)), std::make_move_iterator(offset(first, firstEndIndex)),
+               std::make_move_iterator(offset(second, chunk.beginIndex - firstBeginIndex)),
+               std::make_move_iterator(offset(second, chunk.endIndex - firstEndIndex)),
+               output, compare);
+  });
+}
+
+/// Moves the given amount of elements from the source to the destination, in parallel.
+/// \param source Iterator to the source's first element.
+/// \param elementCount Amount of elements to be moved.
+/// \param destination Iterator to the destination's first element.
+/// \param grainSize Amount of elements to be moved at once.
+template <typename SrcIt, typename DstIt>
+void parallelMove(SrcIt source, std::size_t elementCount, DstIt destination, std::size_t grainSize) {
+  forEachChunk(elementCount, grainSize, [source, destination] (std::size_t, std::size_t beginIndex, std::size_t endIndex) {
+    std::move(offset(source, beginIndex), offset(source, endIndex), offset(destination, beginIndex));
+  });
+}
+
+} // namespace ParallelAlgorithmsUtils
+
+template <typename RandomIt, typename CompareFunc>
+void parallelSort(RandomIt begin, RandomIt end, CompareFunc compare) {
+  using ValueType = typename std::iterator_traits<RandomIt>::value_type;
+
+  const auto elementCount = static_cast<std::size_t>(std::distance(begin, end));
+
+  if (!ParallelAlgorithmsUtils::isParallelizable(elementCount)) {
+    std::sort(begin, end, compare);
+    return;
+  }
+
+  const std::size_t threadCount = getDefaultThreadPool().getWorkerCount() + 1;
+
+  // Each thread sorts a run of its own; the merges being then split into chunks, all the threads keep taking part in them
+  const std::size_t runCount = std::min(threadCount, elementCount / (ParallelAlgorithmThreshold / 4));
+  std::vector<std::size_t> runBoundaries(runCount + 1);
+
+  for (std::size_t runIndex = 0; runIndex <= runCount; ++runIndex)
+    runBoundaries[runIndex] = runIndex * elementCount / runCount;
+
+  parallelFor(IndexRange{ 0, runCount }, 1, [begin, &runBoundaries, &compare] (std::size_t runIndex) {
+    std::sort(ParallelAlgorithmsUtils::offset(begin, runBoundaries[runIndex]),
+              ParallelAlgorithmsUtils::offset(begin, runBoundaries[runIndex + 1]),
+              compare);
+  });
+
+  const std::size_t grainSize = computeGrainSize(elementCount, sizeof(ValueType));
+  std::vector<ValueType> buffer(elementCount);
+  bool isInBuffer = false;
+
+  // The runs are merged by pairs, going back & forth between the range & the buffer, until a single one is left
+  while (runBoundaries.size() > 2) {
+    if (isInBuffer)
+      ParallelAlgorithmsUtils::mergeRuns(buffer.begin(), begin, runBoundaries, grainSize, compare);
+    else
+      ParallelAlgorithmsUtils::mergeRuns(begin, buffer.begin(), runBoundaries, grainSize, compare);
+
+    isInBuffer = !isInBuffer;
+
+    std::vector<std::size_t> mergedBoundaries;
+    mergedBoundaries.reserve(runBoundaries.size() / 2 + 1);
+
+    for (std::size_t boundaryIndex = 0; boundaryIndex < runBoundaries.size() - 1; boundaryIndex += 2)
+      mergedBoundaries.emplace_back(runBoundaries[boundaryIndex]);
+
+    mergedBoundaries.emplace_back(elementCount);
+    runBoundaries = std::move(mergedBoundaries);
+  }
+
+  if (isInBuffer)
+    ParallelAlgorithmsUtils::parallelMove(buffer.begin(), elementCount, begin, grainSize);
+}
+
+template <typename InputIt, typename T, typename ReduceFunc>
+T parallelReduce(InputIt begin, InputIt end, T init, ReduceFunc reduce) {
+  using ValueType = typename std::iterator_traits<InputIt>::value_type;
+  return parallelTransformReduce(begin, end, std::move(init), std::move(reduce), [] (const ValueType& value) -> const ValueType& { return value; });
+}
+
+template <typename InputIt, typename T, typename ReduceFunc, typename TransformFunc>
+T parallelTransformReduce(InputIt begin, InputIt end, T init, ReduceFunc reduce, TransformFunc transform) {
+  using ValueType = typename std::iterator_traits<InputIt>::value_type;
+
+  const auto elementCount = static_cast<std::size_t>(std::distance(begin, end));
+
+  if (!ParallelAlgorithmsUtils::isParallelizable(elementCount)) {
+    for (InputIt iter = begin; iter != end; ++iter)
+      init = reduce(std::move(init), transform(*iter));
+
+    return init;
+  }
+
+  const std::size_t grainSize  = computeGrainSize(elementCount, sizeof(ValueType));
+  const std::size_t chunkCount = (elementCount + grainSize - 1) / grainSize;
+
+  // The initial value is only used to construct the chunks' results, & is combined once afterward
+  std::vector<T> chunkResults(chunkCount, init);
+
+  ParallelAlgorithmsUtils::forEachChunk(elementCount, grainSize, [&] (std::size_t chunkIndex, std::size_t beginIndex, std::size_t endIndex) {
+    const InputIt chunkEnd = ParallelAlgorithmsUtils::offset(begin, endIndex);
+    InputIt iter = ParallelAlgorithmsUtils::offset(begin, beginIndex);
+    T chunkResult(transform(*iter));
+
+    for (++iter; iter != chunkEnd; ++iter)
+      chunkResult = reduce(std::move(chunkResult), transform(*iter));
+
+    chunkResults[chunkIndex] = std::move(chunkResult);
+  });
+
+  for (T& chunkResult : chunkResults)
+    init = reduce(std::move(init), std::move(chunkResult));
+
+  return init;
+}
+
+template <typename InputIt, typename OutputIt, typename ScanFunc>
+OutputIt parallelInclusiveScan(InputIt begin, InputIt end, OutputIt output, ScanFunc scan) {
+  using ValueType = typename std::iterator_traits<InputIt>::value_type;
+
+  const auto elementCount = static_cast<std::size_t>(std::distance(begin, end));
+
+  if (!ParallelAlgorithmsUtils::isParallelizable(elementCount))
+    return std::inclusive_scan(begin, end, output, scan);
+
+  const std::size_t grainSize  = computeGrainSize(elementCount, sizeof(ValueType));
+  const std::size_t chunkCount = (elementCount + grainSize - 1) / grainSize;
+
+  // Each chunk is reduced, then scanned starting from the combination of all the previous chunks' results
+  std::vector<ValueType> chunkResults(chunkCount, *begin);
+
+  ParallelAlgorithmsUtils::forEachChunk(elementCount, grainSize, [&] (std::size_t chunkIndex, std::size_t beginIndex, std::size_t endIndex) {
+    ValueType chunkResult = *ParallelAlgorithmsUtils::offset(begin, beginIndex);
+
+    for (std::size_t elementIndex = beginIndex + 1; elementIndex < endIndex; ++elementIndex)
+      chunkResult = scan(std::move(chunkResult), *ParallelAlgorithmsUtils::offset(begin, elementIndex));
+
+    chunkResults[chunkIndex] = std::move(chunkResult);
+  });
+
+  for (std::size_t chunkIndex = 1; chunkIndex < chunkCount; ++chunkIndex)
+    chunkResults[chunkIndex] = scan(chunkResults[chunkIndex - 1], chunkResults[chunkIndex]);
+
+  ParallelAlgorithmsUtils::forEachChunk(elementCount, grainSize, [&] (std::size_t chunkIndex, std::size_t beginIndex, std::size_t endIndex) {
+    if (chunkIndex == 0) {
+      std::inclusive_scan(begin, ParallelAlgorithmsUtils::offset(begin, endIndex), output, scan);
+      return;
+    }
+
+    ValueType accumulated = chunkResults[chunkIndex - 1];
+
+    for (std::size_t elementIndex = beginIndex; elementIndex < endIndex; ++elementIndex) {
+      accumulated = scan(std::move(accumulated), *ParallelAlgorithmsUtils::offset(begin, elementIndex));
+      *ParallelAlgorithmsUtils::offset(output, elementIndex) = accumulated;
+    }
+  });
+
+  return ParallelAlgorithmsUtils::offset(output, elementCount);
+}
+
+template <typename InputIt, typename OutputIt, typename T, typename ScanFunc>
+OutputIt parallelExclusiveScan(InputIt begin, InputIt end, OutputIt output, T init, ScanFunc scan) {
+  using ValueType = typename std::iterator_traits<InputIt>::value_type;
+
+  const auto elementCount = static_cast<std::size_t>(std::distance(begin, end));
+
+  if (!ParallelAlgorithmsUtils::isParallelizable(elementCount))
+    return std::exclusive_scan(begin, end, output, std::move(init), scan);
+
+  const std::size_t grainSize  = computeGrainSize(elementCount, sizeof(ValueType));
+  const std::size_t chunkCount = (elementCount + grainSize - 1) / grainSize;
+
+  // Each chunk is reduced, then scanned starting from the combination of the initial value & all the previous chunks' results
+  std::vector<T> chunkOffsets(chunkCount + 1, init);
+
+  ParallelAlgorithmsUtils::forEachChunk(elementCount, grainSize, [&] (std::size_t chunkIndex, std::size_t beginIndex, std::size_t endIndex) {
+    T chunkResult = *ParallelAlgorithmsUtils::offset(begin, beginIndex);
+
+    for (std::size_t elementIndex = beginIndex + 1; elementIndex < endIndex; ++elementIndex)
+      chunkResult = scan(std::move(chunkResult), *ParallelAlgorithmsUtils::offset(begin, elementIndex));
+
+    chunkOffsets[chunkIndex + 1] = std::move(chunkResult);
+  });
+
+  for (std::size_t chunkIndex = 1; chunkIndex < chunkCount; ++chunkIndex)
+    chunkOffsets[chunkIndex] = scan(chunkOffsets[chunkIndex - 1], chunkOffsets[chunkIndex]);
+
+  ParallelAlgorithmsUtils::forEachChunk(elementCount, grainSize, [&] (std::size_t chunkIndex, std::size_t beginIndex, std::size_t endIndex) {
+    T accumulated = chunkOffsets[chunkIndex];
+
+    for (std::size_t elementIndex = beginIndex; elementIndex < endIndex; ++elementIndex) {
+      // The input value is read before the output is written, since both may be the same
+      ValueType value = *ParallelAlgorithmsUtils::offset(begin, elementIndex);
+      *ParallelAlgorithmsUtils::offset(output, elementIndex) = accumulated;
+      accumulated = scan(std::move(accumulated), std::move(value));
+    }
+  });
+
+  return ParallelAlgorithmsUtils::offset(output, elementCount);
+}
+
+template <typename RandomIt, typename PredicateFunc>
+RandomIt parallelPartition(RandomIt begin, RandomIt end, PredicateFunc predicate) {
+  using ValueType = typename std::iterator_traits<RandomIt>::value_type;
+
+  const auto elementCount = static_cast<std::size_t>(std::distance(begin, end));
+
+  if (!ParallelAlgorithmsUtils::isParallelizable(elementCount))
+    return std::stable_partition(begin, end, predicate);
+
+  const std::size_t grainSize  = computeGrainSize(elementCount, sizeof(ValueType));
+  const std::size_t chunkCount = (elementCount + grainSize - 1) / grainSize;
+
+  // The predicate is evaluated only once per element, its results being kept for the elements to be moved afterward
+  std::vector<std::uint8_t> matches(elementCount);
+  std::vector<std::size_t> matchOffsets(chunkCount + 1);
+
+  ParallelAlgorithmsUtils::forEachChunk(elementCount, grainSize, [&] (std::size_t chunkIndex, std::size_t beginIndex, std::size_t endIndex) {
+    std::size_t matchCount = 0;
+
+    for (std::size_t elementIndex = beginIndex; elementIndex < endIndex; ++elementIndex) {
+      matches[elementIndex] = static_cast<std::uint8_t>(predicate(*ParallelAlgorithmsUtils::offset(begin, elementIndex)));
+      matchCount += matches[elementIndex];
+    }
+
+    matchOffsets[chunkIndex + 1] = matchCount;
+  });
+
+  std::partial_sum(matchOffsets.cbegin(), matchOffsets.cend(), matchOffsets.begin());
+  const std::size_t totalMatchCount = matchOffsets.back();
+
+  std::vector<ValueType> buffer(elementCount);
+
+  // Each chunk moves its matching elements after those of the previous chunks, & the others after all the matching elements & the
+  //  previous chunks' non-matching ones
+  ParallelAlgorithmsUtils::forEachChunk(elementCount, grainSize, [&] (std::size_t chunkIndex, std::size_t beginIndex, std::size_t endIndex) {
+    std::size_t matchIndex    = matchOffsets[chunkIndex];
+    std::size_t nonMatchIndex = totalMatchCount + (beginIndex - matchOffsets[chunkIndex]);
+
+    for (std::size_t elementIndex = beginIndex; elementIndex < endIndex; ++elementIndex) {
+      const std::size_t bufferIndex = (matches[elementIndex] ? matchIndex++ : nonMatchIndex++);
+      buffer[bufferIndex] = std::move(*ParallelAlgorithmsUtils::offset(begin, elementIndex));
+    }
+  });
+
+  ParallelAlgorithmsUtils::parallelMove(buffer.begin(), elementCount, begin, grainSize);
+
+  return ParallelAlgorithmsUtils::offset(begin, totalMatchCount);
+}
+
+} // namespace Raz::Threading
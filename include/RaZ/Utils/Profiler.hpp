@@ -0,0 +1,128 @@
+#pragma once
+
+#ifndef RAZ_PROFILER_HPP
+#define RAZ_PROFILER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Raz {
+
+/// ProfileCapture class, holding the profiling events recorded by all threads until the moment it has been made.
+class ProfileCapture {
+public:
+  struct Event {
+    std::uint32_t nameIndex;   ///< Index of the event's name in the capture's names.
+    std::uint32_t threadIndex; ///< Index of the thread which recorded the event in the capture's thread names.
+    std::uint64_t startTime;   ///< Time at which the event started, in nanoseconds since the profiler's start.
+    std::uint64_t duration;    ///< Duration of the event, in nanoseconds.
+  };
+
+  const std::vector<std::string>& getNames() const noexcept { return m_names; }
+  const std::vector<std::string>& getThreadNames() const noexcept { return m_threadNames; }
+  const std::vector<Event>& getEvents() const noexcept { return m_events; }
+  /// Gets the amount of events which couldn't be recorded because a thread's buffer was full.
+  /// \return Amount of lost events since the previous capture.
+  std::uint64_t getDroppedEventCount() const noexcept { return m_droppedEventCount; }
+
+  /// Loads a capture saved in the binary format.
+  /// \param filePath Path to the file to be loaded.
+  /// \return Loaded capture.
+  /// \see saveBinary()
+  static ProfileCapture loadBinary(const std::string& filePath);
+  /// Exports the capture as a JSON file in the Chrome trace event format, which can be opened by chrome://tracing or Perfetto.
+  /// \param filePath Path to the file to be written.
+  void exportChromeTrace(const std::string& filePath) const;
+  /// Saves the capture in a compact binary format, storing each name once & each event in 24 bytes.
+  /// Values are stored with the native endianness, the file thus having to be loaded on a machine with the same one.
+  /// \param filePath Path to the file to be written.
+  void saveBinary(const std::string& filePath) const;
+
+private:
+  friend class Profiler;
+
+  std::vector<std::string> m_names {};
+  std::vector<std::string> m_threadNames {};
+  std::vector<Event> m_events {};
+  std::uint64_t m_droppedEventCount {};
+};
+
+/// Profiler class, recording timed zones from any thread with a negligible overhead.
+/// Each thread records its events into its own fixed-size ring buffer, without any lock or allocation; these are then gathered by
+///  capture(), which should be called regularly (for instance once per frame or every few frames) so that the buffers never fill up.
+/// A thread gives its buffer back when it exits; it is then reused by a later thread once its remaining events have been captured.
+/// Zones should be declared with the RAZ_PROFILE_ZONE macro, which is compiled out unless RAZ_USE_PROFILER is defined.
+class Profiler {
+public:
+  /// Amount of events each thread can hold before they are captured; any event past this amount is dropped.
+  static constexpr std::size_t ThreadBufferCapacity = 16384;
+
+  Profiler() = delete;
+  Profiler(const Profiler&) = delete;
+  Profiler(Profiler&&) noexcept = delete;
+
+  static bool isEnabled() noexcept { return s_isEnabled.load(std::memory_order_relaxed); }
+  /// Enables or disables the recording of events; it is enabled by default.
+  /// \param enabled True if the events should be recorded, false otherwise.
+  static void enable(bool enabled = true) noexcept { s_isEnabled.store(enabled, std::memory_order_relaxed); }
+  static void disable() noexcept { enable(false); }
+  /// Gets the current time, in nanoseconds since the profiler's start.
+  /// \return Current time.
+  static std::uint64_t getTime() noexcept;
+  /// Names the calling thread, as displayed in the captures.
+  /// \param name Name of the thread.
+  static void setThreadName(std::string name);
+  /// Records a finished event on the calling thread.
+  /// \param name Name of the event; it must remain valid until the next capture, & should thus usually be a string literal.
+  /// \param startTime Time at which the event started.
+  /// \param endTime Time at which the event ended.
+  static void recordEvent(std::string_view name, std::uint64_t startTime, std::uint64_t endTime) noexcept;
+  /// Gathers all the events recorded by all threads since the previous capture.
+  /// This can be called from any thread, concurrently with the recording of events.
+  /// \return Capture holding the events.
+  static ProfileCapture capture();
+
+  Profiler& operator=(const Profiler&) = delete;
+  Profiler& operator=(Profiler&&) noexcept = delete;
+
+private:
+  static inline std::atomic<bool> s_isEnabled = true;
+};
+
+/// ProfileZone class, recording an event lasting for its whole lifetime. It should be used through the RAZ_PROFILE_ZONE macro.
+class ProfileZone {
+public:
+  explicit ProfileZone(std::string_view name) noexcept
+    : m_name{ name }, m_isRecorded{ Profiler::isEnabled() }, m_startTime{ m_isRecorded ? Profiler::getTime() : 0 } {}
+  ProfileZone(const ProfileZone&) = delete;
+  ProfileZone(ProfileZone&&) noexcept = delete;
+
+  ProfileZone& operator=(const ProfileZone&) = delete;
+  ProfileZone& operator=(ProfileZone&&) noexcept = delete;
+
+  ~ProfileZone() {
+    if (m_isRecorded)
+      Profiler::recordEvent(m_name, m_startTime, Profiler::getTime());
+  }
+
+private:
+  std::string_view m_name;
+  bool m_isRecorded;
+  std::uint64_t m_startTime;
+};
+
+} // namespace Raz
+
+#if defined(RAZ_USE_PROFILER)
+#define RAZ_PROFILE_CONCAT_IMPL(A, B) A##B
+#define RAZ_PROFILE_CONCAT(A, B) RAZ_PROFILE_CONCAT_IMPL(A, B)
+/// Records a profiling event lasting until the end of the current scope. The name must remain valid until the next capture.
+#define RAZ_PROFILE_ZONE(NAME) const ::Raz::ProfileZone RAZ_PROFILE_CONCAT(profileZone, __LINE__)(NAME)
+#else
+#define RAZ_PROFILE_ZONE(NAME) static_cast<void>(0)
+#endif
+
+#endif // RAZ_PROFILER_HPP
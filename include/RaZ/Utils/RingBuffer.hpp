@@ -0,0 +1,81 @@
+#pragma once
+
+#ifndef RAZ_RINGBUFFER_HPP
+#define RAZ_RINGBUFFER_HPP
+
+#include "RaZ/Utils/Threading.hpp"
+
+#ifdef RAZ_THREADS_AVAILABLE
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace Raz {
+
+/// RingBuffer class, a bounded lock-free circular buffer through which a single producer thread streams elements to a single consumer
+///  thread, both transferring them in batches.
+/// Contrary to SpscQueue, elements are copied in & out as contiguous blocks, a whole batch being published by a single atomic store;
+///  this makes it suited to large amounts of small elements, such as samples, log characters or commands.
+/// \tparam T Type of the elements to be stored; must be trivially copyable & default-constructible.
+template <typename T>
+class RingBuffer {
+  static_assert(std::is_trivially_copyable_v<T>, "Error: A ring buffer's elements must be trivially copyable.");
+
+public:
+  /// Creates a ring buffer able to hold at least the given amount of elements.
+  /// \param capacity Minimal amount of elements the buffer can hold; rounded up to the next power of two. Must not be 0.
+  explicit RingBuffer(std::size_t capacity);
+  RingBuffer(const RingBuffer&) = delete;
+  RingBuffer(RingBuffer&&) noexcept = delete;
+
+  std::size_t getCapacity() const noexcept { return m_capacity; }
+  /// Gets the amount of elements in the buffer.
+  /// \note If called while the buffer is being modified, the result may already be outdated when returned.
+  /// \return Amount of elements waiting to be popped.
+  std::size_t getSize() const noexcept;
+  bool isEmpty() const noexcept { return (getSize() == 0); }
+
+  /// Copies as many of the given elements as possible at the end of the buffer. Must only be called from the producer thread.
+  /// The elements are made available to the consumer all at once.
+  /// \param values Elements to be added.
+  /// \param count Amount of elements to be added.
+  /// \return Amount of elements actually added, which is lower than the given count if the buffer gets full.
+  std::size_t push(const T* values, std::size_t count) noexcept;
+  /// Copies the given element at the end of the buffer, if it is not full. Must only be called from the producer thread.
+  /// \param value Element to be added.
+  /// \return True if the element has been added, false if the buffer is full.
+  bool tryPush(const T& value) noexcept { return (push(&value, 1) == 1); }
+  /// Copies as many elements as possible from the front of the buffer, removing them. Must only be called from the consumer thread.
+  /// \param values Elements to be filled; must be able to hold at least the given maximal count.
+  /// \param maxCount Maximal amount of elements to be popped.
+  /// \return Amount of elements actually popped, which is lower than the given count if the buffer gets empty.
+  std::size_t pop(T* values, std::size_t maxCount) noexcept;
+  /// Copies the element at the front of the buffer, removing it, if it is not empty. Must only be called from the consumer thread.
+  /// \param value Element to be assigned the popped one.
+  /// \return True if an element has been popped, false if the buffer is empty.
+  bool tryPop(T& value) noexcept { return (pop(&value, 1) == 1); }
+
+  RingBuffer& operator=(const RingBuffer&) = delete;
+  RingBuffer& operator=(RingBuffer&&) noexcept = delete;
+
+private:
+  std::unique_ptr<T[]> m_elements {};
+  std::size_t m_capacity {};
+  std::size_t m_indexMask {};
+
+  alignas(Threading::CacheLineSize) std::atomic<std::size_t> m_writeIndex {};
+  std::size_t m_cachedReadIndex {}; ///< Last read index known by the producer.
+
+  alignas(Threading::CacheLineSize) std::atomic<std::size_t> m_readIndex {};
+  std::size_t m_cachedWriteIndex {}; ///< Last write index known by the consumer.
+};
+
+} // namespace Raz
+
+#include "RaZ/Utils/RingBuffer.inl"
+
+#endif // RAZ_THREADS_AVAILABLE
+
+#endif // RAZ_RINGBUFFER_HPP
@@ -0,0 +1,72 @@
+#include <algorithm>
+#include <cassert>
+
+namespace Raz {
+
+template <typename T>
+RingBuffer<T>::RingBuffer(std::size_t capacity) {
+  assert("Error: A ring buffer's capacity must not be 0." && capacity != 0);
+
+  m_capacity = 1;
+  while (m_capacity < capacity)
+    m_capacity *= 2;
+
+  m_indexMask = m_capacity - 1;
+  m_elements  = std::make_unique<T[]>(m_capacity);
+}
+
+template <typename T>
+std::size_t RingBuffer<T>::getSize() const noexcept {
+  const std::size_t readIndex = m_readIndex.load(std::memory_order_acquire);
+  return m_writeIndex.load(std::memory_order_acquire) - readIndex;
+}
+
+template <typename T>
+std::size_t RingBuffer<T>::push(const T* values, std::size_t count) noexcept {
+  const std::size_t writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+
+  // The consumer's index is only fetched if the free space last known isn't enough for all the elements
+  if (m_capacity - (writeIndex - m_cachedReadIndex) < count)
+    m_cachedReadIndex = m_readIndex.load(std::memory_order_acquire);
+
+  count = std::min(count, m_capacity - (writeIndex - m_cachedReadIndex));
+
+  if (count == 0)
+    return 0;
+
+  // The elements may wrap around the end of the buffer, in which case they are copied in two parts
+  const std::size_t firstIndex = writeIndex & m_indexMask;
+  const std::size_t firstCount = std::min(count, m_capacity - firstIndex);
+
+  std::copy(values, values + firstCount, m_elements.get() + firstIndex);
+  std::copy(values + firstCount, values + count, m_elements.get());
+
+  m_writeIndex.store(writeIndex + count, std::memory_order_release);
+
+  return count;
+}
+
+template <typename T>
+std::size_t RingBuffer<T>::pop(T* values, std::size_t maxCount) noexcept {
+  const std::size_t readIndex = m_readIndex.load(std::memory_order_relaxed);
+
+  if (m_cachedWriteIndex - readIndex < maxCount)
+    m_cachedWriteIndex = m_writeIndex.load(std::memory_order_acquire);
+
+  const std::size_t count = std::min(maxCount, m_cachedWriteIndex - readIndex);
+
+  if (count == 0)
+    return 0;
+
+  const std::size_t firstIndex = readIndex & m_indexMask;
+  const std::size_t firstCount = std::min(count, m_capacity - firstIndex);
+
+  std::copy(m_elements.get() + firstIndex, m_elements.get() + firstIndex + firstCount, values);
+  std::copy(m_elements.get(), m_elements.get() + (count - firstCount), values + firstCount);
+
+  m_readIndex.store(readIndex + count, std::memory_order_release);
+
+  return count;
+}
+
+} // namespace Raz
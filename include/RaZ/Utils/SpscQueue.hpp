@@ -0,0 +1,87 @@
+#pragma once
+
+#ifndef RAZ_SPSCQUEUE_HPP
+#define RAZ_SPSCQUEUE_HPP
+
+#include "RaZ/Utils/Threading.hpp"
+
+#ifdef RAZ_THREADS_AVAILABLE
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+namespace Raz {
+
+/// SpscQueue class, a bounded lock-free queue through which a single producer thread sends elements to a single consumer thread.
+/// The elements are stored in a circular buffer allocated once; pushing into a full queue or popping from an empty one fails instead
+///  of blocking. The producer's & consumer's indices are kept in separate cache lines, each thread also caching the other's index to
+///  avoid reading it while the queue is neither full nor empty.
+/// \tparam T Type of the elements to be stored.
+template <typename T>
+class SpscQueue {
+public:
+  /// Creates a queue able to hold at least the given amount of elements.
+  /// \param capacity Minimal amount of elements the queue can hold; rounded up to the next power of two. Must not be 0.
+  explicit SpscQueue(std::size_t capacity);
+  SpscQueue(const SpscQueue&) = delete;
+  SpscQueue(SpscQueue&&) noexcept = delete;
+
+  std::size_t getCapacity() const noexcept { return m_capacity; }
+  /// Gets the amount of elements in the queue.
+  /// \note If called while the queue is being modified, the result may already be outdated when returned.
+  /// \return Amount of elements waiting to be popped.
+  std::size_t getSize() const noexcept;
+  bool isEmpty() const noexcept { return (getSize() == 0); }
+
+  /// Constructs an element at the end of the queue, if it is not full. Must only be called from the producer thread.
+  /// \tparam Args Types of the arguments to be forwarded to the element.
+  /// \param args Arguments to be forwarded to the element.
+  /// \return True if the element has been added, false if the queue is full.
+  template <typename... Args> bool tryEmplace(Args&&... args);
+  /// Adds a copy of the given element at the end of the queue, if it is not full. Must only be called from the producer thread.
+  /// \param value Element to be added.
+  /// \return True if the element has been added, false if the queue is full.
+  bool tryPush(const T& value) { return tryEmplace(value); }
+  /// Moves the given element at the end of the queue, if it is not full. Must only be called from the producer thread.
+  /// \param value Element to be added; left untouched if the queue is full.
+  /// \return True if the element has been added, false if the queue is full.
+  bool tryPush(T&& value) { return tryEmplace(std::move(value)); }
+  /// Takes the element at the front of the queue, if it is not empty. Must only be called from the consumer thread.
+  /// \param value Element to be assigned the popped one.
+  /// \return True if an element has been popped, false if the queue is empty.
+  bool tryPop(T& value);
+
+  SpscQueue& operator=(const SpscQueue&) = delete;
+  SpscQueue& operator=(SpscQueue&&) noexcept = delete;
+
+  /// Destroys the elements remaining in the queue.
+  ~SpscQueue();
+
+private:
+  struct Slot {
+    alignas(T) std::byte data[sizeof(T)];
+  };
+
+  T& getElement(std::size_t index) noexcept { return *std::launder(reinterpret_cast<T*>(m_slots[index & m_indexMask].data)); }
+
+  std::unique_ptr<Slot[]> m_slots {};
+  std::size_t m_capacity {};
+  std::size_t m_indexMask {};
+
+  // The indices are only ever incremented, their position in the buffer being obtained by masking them
+  alignas(Threading::CacheLineSize) std::atomic<std::size_t> m_writeIndex {};
+  std::size_t m_cachedReadIndex {}; ///< Last read index known by the producer.
+
+  alignas(Threading::CacheLineSize) std::atomic<std::size_t> m_readIndex {};
+  std::size_t m_cachedWriteIndex {}; ///< Last write index known by the consumer.
+};
+
+} // namespace Raz
+
+#include "RaZ/Utils/SpscQueue.inl"
+
+#endif // RAZ_THREADS_AVAILABLE
+
+#endif // RAZ_SPSCQUEUE_HPP
@@ -0,0 +1,71 @@
+#include <cassert>
+
+namespace Raz {
+
+template <typename T>
+SpscQueue<T>::SpscQueue(std::size_t capacity) {
+  assert("Error: A queue's capacity must not be 0." && capacity != 0);
+
+  m_capacity = 1;
+  while (m_capacity < capacity)
+    m_capacity *= 2;
+
+  m_indexMask = m_capacity - 1;
+  m_slots     = std::make_unique<Slot[]>(m_capacity);
+}
+
+template <typename T>
+std::size_t SpscQueue<T>::getSize() const noexcept {
+  // Loading the read index first guarantees that it can't be ahead of the write index, the latter being the last to be incremented
+  const std::size_t readIndex = m_readIndex.load(std::memory_order_acquire);
+  return m_writeIndex.load(std::memory_order_acquire) - readIndex;
+}
+
+template <typename T>
+template <typename... Args>
+bool SpscQueue<T>::tryEmplace(Args&&... args) {
+  const std::size_t writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+
+  if (writeIndex - m_cachedReadIndex == m_capacity) {
+    // The queue seems full; the consumer's index is only fetched in that case, possibly having moved since it was last read
+    m_cachedReadIndex = m_readIndex.load(std::memory_order_acquire);
+
+    if (writeIndex - m_cachedReadIndex == m_capacity)
+      return false;
+  }
+
+  new (m_slots[writeIndex & m_indexMask].data) T(std::forward<Args>(args)...);
+  m_writeIndex.store(writeIndex + 1, std::memory_order_release);
+
+  return true;
+}
+
+template <typename T>
+bool SpscQueue<T>::tryPop(T& value) {
+  const std::size_t readIndex = m_readIndex.load(std::memory_order_relaxed);
+
+  if (readIndex == m_cachedWriteIndex) {
+    m_cachedWriteIndex = m_writeIndex.load(std::memory_order_acquire);
+
+    if (readIndex == m_cachedWriteIndex)
+      return false;
+  }
+
+  T& element = getElement(readIndex);
+  value = std::move(element);
+  element.~T();
+
+  m_readIndex.store(readIndex + 1, std::memory_order_release);
+
+  return true;
+}
+
+template <typename T>
+SpscQueue<T>::~SpscQueue() {
+  const std::size_t writeIndex = m_writeIndex.load(std::memory_order_acquire);
+
+  for (std::size_t readIndex = m_readIndex.load(std::memory_order_relaxed); readIndex != writeIndex; ++readIndex)
+    getElement(readIndex).~T();
+}
+
+} // namespace Raz
@@ -0,0 +1,122 @@
+#pragma once
+
+#ifndef RAZ_TASKGRAPH_HPP
+#define RAZ_TASKGRAPH_HPP
+
+#include "RaZ/Utils/Graph.hpp"
+
+#include <atomic>
+#include <functional>
+#include <vector>
+
+namespace Raz {
+
+class TaskGraph;
+
+/// TaskNode class, representing a task in a TaskGraph; its children are the tasks depending on it.
+class TaskNode final : public GraphNode<TaskNode> {
+  friend TaskGraph;
+
+public:
+  using Action = std::function<void()>;
+
+  /// Creates a task node.
+  /// \param action Action to be executed by the task; may be empty for a task only joining others.
+  /// \param waitsForAny True if the task must be executed as soon as any of its dependencies is done, false if it must wait for all of them.
+  explicit TaskNode(Action action, bool waitsForAny = false) : m_action{ std::move(action) }, m_waitsForAny{ waitsForAny } {}
+
+  std::size_t getDependencyCount() const noexcept { return m_dependencyCount; }
+  /// Tells if the task is executed as soon as any of its dependencies is done, instead of waiting for all of them.
+  /// \return True if the task waits for any of its dependencies, false if it waits for all of them.
+  bool waitsForAny() const noexcept { return m_waitsForAny; }
+  /// Tells if the task has thrown an exception during the graph's last execution.
+  /// \return True if the task has failed, false otherwise.
+  bool hasFailed() const noexcept { return m_hasFailed; }
+  /// Tells if the task has been skipped during the graph's last execution, its dependencies having failed or been canceled.
+  /// A task waiting for all its dependencies is canceled if any of them fails, while a task waiting for any of them is only canceled if
+  ///  all of them fail.
+  /// \return True if the task has been canceled, false otherwise.
+  bool isCanceled() const noexcept { return m_isCanceled; }
+
+  /// Makes the task depend on the given one, so that it is executed only after it.
+  /// \param task Task to depend on; must belong to the same graph.
+  void addDependency(TaskNode& task);
+  /// Makes the task depend on the given ones, so that it is executed only after them.
+  /// \tparam OtherTasksTs Types of the other tasks to depend on.
+  /// \param task First task to depend on.
+  /// \param otherTasks Other tasks to depend on.
+  template <typename... OtherTasksTs> void addDependencies(TaskNode& task, OtherTasksTs&... otherTasks) { addDependency(task); (addDependency(otherTasks), ...); }
+
+private:
+  Action m_action {};
+  bool m_waitsForAny {};
+  std::size_t m_dependencyCount {};
+
+  std::atomic<std::size_t> m_remainingDependencyCount {}; ///< Amount of dependencies still to be done during the current execution.
+  std::atomic<bool> m_isReleased {}; ///< True if the task has already been released by a dependency during the current execution.
+  std::atomic<bool> m_hasFailedDependency {}; ///< True if any dependency has failed or been canceled during the current execution.
+  bool m_hasFailed {};
+  bool m_isCanceled {};
+};
+
+/// TaskGraph class, executing tasks in a directed acyclic graph according to their dependencies.
+/// A task is executed on the default thread pool once its dependencies are done; the tasks which don't depend on each other can thus
+///  be executed concurrently. The calling thread takes part in the execution instead of blocking until it is over.
+/// The graph is kept after its execution, & can be executed again as many times as needed.
+class TaskGraph {
+public:
+  TaskGraph() = default;
+  TaskGraph(const TaskGraph&) = delete;
+  TaskGraph(TaskGraph&&) noexcept = default;
+
+  const Graph<TaskNode>& getGraph() const noexcept { return m_graph; }
+
+  /// Adds a task into the graph, executed without waiting for any other unless dependencies are added afterward.
+  /// \param action Action to be executed by the task.
+  /// \return Reference to the newly added task.
+  TaskNode& addTask(TaskNode::Action action) { return m_graph.addNode(std::move(action)); }
+  /// Adds a task executed once the given one is done.
+  /// \param task Task to be continued.
+  /// \param action Action to be executed by the continuation.
+  /// \return Reference to the newly added continuation.
+  TaskNode& addContinuation(TaskNode& task, TaskNode::Action action);
+  /// Adds a task executed once all the given ones are done.
+  /// \param tasks Tasks to be waited for.
+  /// \param action Action to be executed by the join; may be empty for the join only to be depended on.
+  /// \return Reference to the newly added join.
+  TaskNode& addWhenAll(const std::vector<TaskNode*>& tasks, TaskNode::Action action = {});
+  /// Adds a task executed as soon as any of the given ones is done, without waiting for the others.
+  /// \param tasks Tasks to be waited for.
+  /// \param action Action to be executed by the join; may be empty for the join only to be depended on.
+  /// \return Reference to the newly added join.
+  TaskNode& addWhenAny(const std::vector<TaskNode*>& tasks, TaskNode::Action action = {});
+  /// Executes all the tasks, each once its dependencies are done, & waits for all of them to be finished.
+  /// If a task throws an exception, the tasks depending on it are canceled, & the first exception thrown is rethrown once all the others
+  ///  are finished. No task must be added nor dependency modified during the execution.
+  /// \note If the graph contains a cycle, an exception is thrown before executing any task.
+  void execute();
+
+  TaskGraph& operator=(const TaskGraph&) = delete;
+  TaskGraph& operator=(TaskGraph&&) noexcept = default;
+
+private:
+  struct ExecutionState;
+
+  /// Executes the given task, then releases its children; the first released child is executed right away on the current thread, the
+  ///  others being scheduled.
+  /// \param task Task to be executed.
+  /// \param isCanceled True if the task must be skipped, its dependencies having failed.
+  /// \param state State of the current execution.
+  static void executeTask(TaskNode& task, bool isCanceled, ExecutionState& state);
+  /// Schedules the given task to be executed by the thread pool, or by the thread executing the graph if threads are not available.
+  /// \param task Task to be scheduled.
+  /// \param isCanceled True if the task must be skipped, its dependencies having failed.
+  /// \param state State of the current execution.
+  static void scheduleTask(TaskNode& task, bool isCanceled, ExecutionState& state);
+
+  Graph<TaskNode> m_graph {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_TASKGRAPH_HPP
@@ -0,0 +1,94 @@
+#pragma once
+
+#ifndef RAZ_THREADPOOL_HPP
+#define RAZ_THREADPOOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Raz {
+
+/// Indices of the logical processors on which a thread is allowed to run.
+using ProcessorSet = std::vector<unsigned int>;
+
+/// ThreadPool class, holding persistent worker threads to which tasks can be submitted.
+/// Each worker owns a queue of tasks, from which it takes the most recently added one; when empty, it steals the oldest task from the
+///  other workers' queues, and parks itself if none has any task left.
+/// The workers' threads are named after their index ("Worker 0", "Worker 1", ...), so that they can be told apart in profilers.
+class ThreadPool {
+public:
+  using Task = std::function<void()>;
+
+  /// Creates a thread pool with the given amount of workers.
+  /// \param workerCount Amount of worker threads to be started; must not be 0.
+  explicit ThreadPool(std::size_t workerCount);
+  /// Creates a thread pool with one worker per given processor set, each worker being pinned to the processors of its own.
+  /// If a worker can't be pinned, for example if the platform doesn't allow it, it is left free to run on any processor.
+  /// \param workerAffinities Logical processors on which each worker is allowed to run; an empty set leaves the corresponding worker
+  ///  free to run anywhere. There must be at least one set.
+  explicit ThreadPool(std::vector<ProcessorSet> workerAffinities);
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool(ThreadPool&&) noexcept = delete;
+
+  std::size_t getWorkerCount() const noexcept { return m_workers.size(); }
+  const ProcessorSet& getWorkerAffinity(std::size_t workerIndex) const noexcept { return m_workers[workerIndex]->affinity; }
+
+  /// Submits a task to be executed by any of the workers.
+  /// If called from a worker of this pool, the task is added to its own queue; otherwise, queues are chosen in turn.
+  /// \note The task must not throw; if it does, std::terminate() is called.
+  /// \param task Task to be executed.
+  void addTask(Task task);
+  /// Executes on the calling thread one of the tasks waiting to be picked up by a worker, if any.
+  /// \return True if a task has been executed, false otherwise.
+  bool runPendingTask();
+  /// Executes the given action the given amount of times in parallel & waits for all of them to be finished.
+  /// The calling thread takes part in the execution; it can thus safely be used from within a task.
+  /// If any execution throws an exception, the first one thrown is rethrown once all executions are finished.
+  /// \param executionCount Amount of times to execute the action.
+  /// \param action Action to be executed, taking the index of the current execution.
+  void run(std::size_t executionCount, const std::function<void(std::size_t)>& action);
+
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ThreadPool& operator=(ThreadPool&&) noexcept = delete;
+
+  /// Waits for the remaining tasks to be executed & stops the workers.
+  ~ThreadPool();
+
+private:
+  struct Worker {
+    std::deque<Task> tasks {};
+    std::mutex mutex {};
+    std::thread thread {};
+    ProcessorSet affinity {};
+  };
+
+  /// Takes the most recently added task from the given worker's queue.
+  /// \param workerIndex Index of the worker to take the task from.
+  /// \param task Task to be filled.
+  /// \return True if a task has been taken, false otherwise.
+  bool popTask(std::size_t workerIndex, Task& task);
+  /// Takes the oldest task from any worker's queue, starting with the one following the given index.
+  /// \param firstWorkerIndex Index of the first worker to take the task from.
+  /// \param task Task to be filled.
+  /// \return True if a task has been taken, false otherwise.
+  bool stealTask(std::size_t firstWorkerIndex, Task& task);
+  void runWorker(std::size_t workerIndex);
+
+  std::vector<std::unique_ptr<Worker>> m_workers {};
+  std::atomic<std::size_t> m_pendingTaskCount {};
+  std::atomic<std::size_t> m_nextWorkerIndex {};
+
+  std::mutex m_parkingMutex {};
+  std::condition_variable m_parkingCondition {};
+  bool m_isStopping {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_THREADPOOL_HPP
@@ -10,12 +10,20 @@
 
 #ifdef RAZ_THREADS_AVAILABLE
 
+#include "RaZ/Utils/ThreadPool.hpp"
+
 #include <functional>
 #include <future>
+#include <string>
 #include <thread>
+#include <vector>
 
 namespace Raz::Threading {
 
+/// Assumed size in bytes of a cache line, by which the data written by different threads is separated to avoid false sharing.
+/// std::hardware_destructive_interference_size is not used, since it is not provided by all standard libraries.
+constexpr std::size_t CacheLineSize = 64;
+
 struct IndexRange {
   std::size_t beginIndex;
   std::size_t endIndex;
@@ -31,7 +39,7 @@ public:
 
   ContainerConstIter cbegin() const noexcept { return m_begin; }
   ContainerIter begin() { return m_begin; }
-  ContainerConstIter* cend() const noexcept { return m_end; }
+  ContainerConstIter cend() const noexcept { return m_end; }
   ContainerIter end() { return m_end; }
 
 private:
@@ -39,16 +47,83 @@ private:
   ContainerIter m_end;
 };
 
-/// Gets the number of concurrent threads available to the system.
-/// This number doesn't necessarily represent the CPU's actual number of threads.
+/// Logical processor available to the current process.
+struct LogicalProcessor {
+  unsigned int index;        ///< Index of the processor, as given by the system & used to set threads' affinity.
+  std::size_t coreIndex;     ///< Index of the physical core the processor belongs to; processors sharing a core are SMT siblings.
+  std::size_t numaNodeIndex; ///< Index of the NUMA node the processor belongs to.
+};
+
+/// Layout of the processors available to the current process.
+/// Cores & NUMA nodes are numbered contiguously from 0, only counting those on which the process can run; the cores are numbered
+///  node after node.
+struct CpuTopology {
+  std::vector<LogicalProcessor> logicalProcessors {}; ///< Available logical processors, sorted by core.
+  std::size_t coreCount {};
+  std::size_t numaNodeCount {};
+};
+
+/// Settings determining the default thread pool's workers & the processors they run on.
+struct SchedulingSettings {
+  /// Amount of physical cores left to the main & render threads, taken first from the first NUMA node. If every core is reserved, a
+  ///  single worker is created, sharing the last reserved core.
+  std::size_t reservedCoreCount = 1;
+  /// Amount of workers to be created on each NUMA node, which must exist if its count isn't 0. If empty, one worker is created per
+  ///  non-reserved core. If there are more workers than free cores on a node, several workers share the same core.
+  std::vector<std::size_t> workerCountsPerNumaNode {};
+  /// If true, each worker is pinned to its core's logical processors. Otherwise, workers created for a given NUMA node are allowed to
+  ///  run on all of its free processors, & are left free to run anywhere if no worker counts are given.
+  bool pinWorkers = true;
+  /// If true, the thread configuring the default pool is pinned to the first reserved core; ignored if no core is reserved.
+  bool pinCallingThread = false;
+};
+
+/// Gets the number of concurrent threads available to the current process.
+/// This number doesn't necessarily represent the CPU's actual number of threads, as the process may be restricted to some of them.
 /// \return Number of threads available.
 unsigned int getSystemThreadCount() noexcept;
 
+/// Gets the layout of the processors available to the current process, which is determined on first use.
+/// \note The cores & NUMA nodes are only detected on Linux. On other platforms, each logical processor is considered to be a core of
+///  its own, on a single NUMA node.
+/// \return Reference to the CPU topology.
+const CpuTopology& getCpuTopology();
+
+/// Computes the processors on which each worker of a thread pool should run.
+/// \param topology Layout of the available processors.
+/// \param settings Settings determining the workers' amount & placement.
+/// \return Processor set of each worker, to be given to a ThreadPool; a worker having an empty set is free to run anywhere.
+std::vector<ProcessorSet> computeWorkerAffinities(const CpuTopology& topology, const SchedulingSettings& settings);
+
+/// Sets the settings from which the default thread pool is to be created, its workers being placed according to the CPU topology.
+/// If not called, the default pool has as many workers as the system has threads available minus one, all free to run anywhere.
+/// \note This must be called before the default thread pool is used for the first time; an exception is thrown otherwise.
+/// \param settings Settings determining the default pool's workers & their placement.
+void configureDefaultThreadPool(const SchedulingSettings& settings);
+
+/// Gets the thread pool to which all the parallel operations are submitted.
+/// It is created on first use, either as configured with configureDefaultThreadPool(), or with as many workers as the system has
+///  threads available, minus one for the calling thread.
+/// \return Reference to the default thread pool.
+ThreadPool& getDefaultThreadPool();
+
+/// Sets the current thread's name, as displayed by debuggers & profilers.
+/// \note On Linux, names are truncated to 15 characters. Threads can't be named on Windows.
+/// \param name Name to be given to the thread.
+/// \return True if the name has been set, false otherwise.
+bool setCurrentThreadName(const std::string& name) noexcept;
+
+/// Restricts the current thread to run only on the given logical processors.
+/// \note Threads can't be pinned on macOS. On Windows, only the first 64 processors can be used.
+/// \param processors Indices of the logical processors on which the thread is allowed to run; must not be empty.
+/// \return True if the affinity has been set, false otherwise.
+bool setCurrentThreadAffinity(const ProcessorSet& processors) noexcept;
+
 /// Pauses the current thread for the specified amount of time.
 /// \param milliseconds Pause duration in milliseconds.
 inline void sleep(uint64_t milliseconds) { std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds)); }
 
-/// Calls a function asynchronously, to be executed without blocking the calling thread.
+/// Calls a function asynchronously, to be executed by the default thread pool without blocking the calling thread.
 /// \tparam Func Function to be called.
 /// \tparam Args Types of the arguments to be forwarded to the given function.
 /// \tparam ResultType Return type of the given function.
@@ -58,33 +133,47 @@ inline void sleep(uint64_t milliseconds) { std::this_thread::sleep_for(std::chro
 template <typename Func, typename... Args, typename ResultType = std::result_of_t<Func&&(Args&&...)>>
 std::future<ResultType> launchAsync(Func action, Args&&... args);
 
-/// Calls a function in parallel on a given number of separate threads of execution.
-/// \param action Action to be performed by each thread.
-/// \param threadCount Amount of threads to start an instance on.
+/// Calls a function in parallel a given number of times, each instance running on its own thread.
+/// Contrary to the functions using the default thread pool, all instances are guaranteed to run at the same time; they can thus wait
+///   for each other.
+/// \param action Action to be performed by each instance.
+/// \param threadCount Amount of instances to be executed.
 void parallelize(const std::function<void()>& action, std::size_t threadCount = getSystemThreadCount());
 
-/// Calls a function in parallel on a given number of separate threads of execution.
-/// The collection is automatically splitted by indices, giving a separate start/end range to each thread.
+/// Calls a function in parallel on the default thread pool & the calling thread.
+/// The collection is automatically split by indices into evenly sized ranges, giving a separate start/end range to each instance.
 /// \note The container must either be a constant-size C array or have a size() function.
+/// \note The action must not throw; an exception escaping it terminates the program.
 /// \tparam ContainerType Type of the collection to iterate over.
 /// \param collection Collection to iterate over on multiple threads.
-/// \param action Action to be performed by each thread, giving an index range as boundaries.
-/// \param threadCount Amount of threads to start an instance on.
+/// \param action Action to be performed by each instance, giving an index range as boundaries.
+/// \param threadCount Amount of ranges to split the collection into.
 template <typename ContainerType, typename Func, typename = std::enable_if_t<std::is_constructible_v<std::function<void(IndexRange)>, Func>>>
 void parallelize(const ContainerType& collection, Func&& action, std::size_t threadCount = getSystemThreadCount());
 
-/// Calls a function in parallel on a given number of separate threads of execution.
-/// The collection is automatically splitted by iterator ranges, giving a separate start/end range to each thread.
+/// Calls a function in parallel on the default thread pool & the calling thread.
+/// The collection is automatically split by iterators into evenly sized ranges, giving a separate start/end range to each instance.
 /// \note The container must either be a constant-size C array, or have a public ContainerType::iterator type and begin() & size() functions.
+/// \note The action must not throw; an exception escaping it terminates the program.
 /// \tparam ContainerType Type of the collection to iterate over.
 /// \param collection Collection to iterate over on multiple threads.
-/// \param action Action to be performed by each thread, giving an iterator range as boundaries.
-/// \param threadCount Amount of threads to start an instance on.
+/// \param action Action to be performed by each instance, giving an iterator range as boundaries.
+/// \param threadCount Amount of ranges to split the collection into.
 template <typename ContainerType,
           typename Func,
           typename = std::enable_if_t<std::is_constructible_v<std::function<void(IterRange<std::common_type_t<ContainerType>>)>, Func>>>
 void parallelize(ContainerType& collection, Func&& action, std::size_t threadCount = getSystemThreadCount());
 
+/// Calls a function in parallel over an index range, on the default thread pool & the calling thread.
+/// The range is split into chunks of at most grainSize indices, dynamically distributed so that faster executions process more chunks.
+/// \note The action must not throw; an exception escaping it terminates the program.
+/// \tparam Func Type of the action to be performed.
+/// \param range Range of indices to iterate over.
+/// \param grainSize Maximum amount of indices to be processed at once; must not be 0.
+/// \param action Action to be performed, taking either an index range (IndexRange) or a single index (std::size_t).
+template <typename Func>
+void parallelFor(IndexRange range, std::size_t grainSize, Func&& action);
+
 } // namespace Raz::Threading
 
 #include "Threading.inl"
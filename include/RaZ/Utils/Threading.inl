@@ -1,58 +1,102 @@
+#include <algorithm>
+#include <atomic>
 #include <cassert>
-#include <vector>
+#include <memory>
+#include <tuple>
 
 namespace Raz::Threading {
 
 template <typename Func, typename... Args, typename ResultType>
 std::future<ResultType> launchAsync(Func action, Args&&... args) {
-  return std::async(std::move(action), std::forward<Args>(args)...);
+  // A std::packaged_task can't be copied, while the pool's tasks must be; it is thus shared with the task executing it
+  auto task = std::make_shared<std::packaged_task<ResultType()>>([action = std::move(action),
+                                                                  arguments = std::make_tuple(std::forward<Args>(args)...)] () mutable
+                                                                 noexcept(std::is_nothrow_invocable_v<Func&&, std::decay_t<Args>&&...>) {
+    return std::apply(std::move(action), std::move(arguments));
+  });
+
+  std::future<ResultType> result = task->get_future();
+  // Any exception thrown by the action is stored in the future by the std::packaged_task, which never throws itself here
+  getDefaultThreadPool().addTask([task = std::move(task)] () noexcept { (*task)(); });
+
+  return result;
 }
 
 template <typename ContainerType, typename Func, typename>
 void parallelize(const ContainerType& collection, Func&& action, std::size_t threadCount) {
   assert("Error: The number of threads can't be 0." && threadCount != 0);
 
-  std::vector<std::thread> threads(std::min(threadCount, std::size(collection)));
+  const std::size_t elementCount = std::size(collection);
 
-  // This performs a mathematical round: if the result of the division gives a number below X.5, ceil it; otherwise, round it
-  const std::size_t rangeCount = (std::size(collection) + threadCount / 2) / threadCount;
+  if (elementCount == 0)
+    return;
 
-  std::size_t beginIndex = 0;
-  std::size_t endIndex   = rangeCount;
+  // The collection is split into ranges of equal size, the first ones getting one more element if the size is indivisible
+  const std::size_t rangeCount     = std::min(threadCount, elementCount);
+  const std::size_t rangeSize      = elementCount / rangeCount;
+  const std::size_t remainderCount = elementCount % rangeCount;
 
-  // Creating one thread per slice, minus one to avoid getting one more element in the last thread if the size is indivisible
-  for (std::size_t threadIndex = 0; threadIndex < threads.size() - 1; ++threadIndex) {
-    threads[threadIndex] = std::thread(action, IndexRange{ beginIndex, endIndex });
+  getDefaultThreadPool().run(rangeCount, [&action, rangeSize, remainderCount] (std::size_t rangeIndex) noexcept {
+    const std::size_t beginIndex = rangeIndex * rangeSize + std::min(rangeIndex, remainderCount);
+    const std::size_t endIndex   = beginIndex + rangeSize + (rangeIndex < remainderCount ? 1 : 0);
 
-    beginIndex = endIndex;
-    endIndex  += rangeCount;
-  }
-
-  // The last thread is created independently with just the remaining number of elements
-  threads.back() = std::thread(action, IndexRange{ beginIndex, std::min(endIndex, std::size(collection)) });
-
-  for (std::thread& thread : threads)
-    thread.join();
+    action(IndexRange{ beginIndex, endIndex });
+  });
 }
 
 template <typename ContainerType, typename Func, typename>
 void parallelize(ContainerType& collection, Func&& action, std::size_t threadCount) {
   assert("Error: The number of threads can't be 0." && threadCount != 0);
 
-  std::vector<std::thread> threads(std::min(threadCount, std::size(collection)));
+  const std::size_t elementCount = std::size(collection);
+
+  if (elementCount == 0)
+    return;
 
-  // This performs a mathematical round: if the result of the division gives a number below X.5, ceil it; otherwise, round it
-  const std::size_t rangeCount = (std::size(collection) + threadCount / 2) / threadCount;
+  // The collection is split into ranges of equal size, the first ones getting one more element if the size is indivisible
+  const std::size_t rangeCount     = std::min(threadCount, elementCount);
+  const std::size_t rangeSize      = elementCount / rangeCount;
+  const std::size_t remainderCount = elementCount % rangeCount;
 
-  for (std::size_t threadIndex = 0; threadIndex < threads.size(); ++threadIndex) {
-    typename ContainerType::iterator beginIter = std::begin(collection) + rangeCount * threadIndex;
-    typename ContainerType::iterator endIter   = beginIter + rangeCount;
+  getDefaultThreadPool().run(rangeCount, [&collection, &action, rangeSize, remainderCount] (std::size_t rangeIndex) noexcept {
+    const std::size_t beginIndex = rangeIndex * rangeSize + std::min(rangeIndex, remainderCount);
+    const std::size_t endIndex   = beginIndex + rangeSize + (rangeIndex < remainderCount ? 1 : 0);
 
-    threads[threadIndex] = std::thread(action, IterRange<ContainerType>(beginIter, endIter));
-  }
+    const auto beginIter = std::begin(collection) + static_cast<std::ptrdiff_t>(beginIndex);
+    const auto endIter   = std::begin(collection) + static_cast<std::ptrdiff_t>(endIndex);
+
+    action(IterRange<ContainerType>(beginIter, endIter));
+  });
+}
 
-  for (std::thread& thread : threads)
-    thread.join();
+template <typename Func>
+void parallelFor(IndexRange range, std::size_t grainSize, Func&& action) {
+  assert("Error: The grain size can't be 0." && grainSize != 0);
+
+  if (range.endIndex <= range.beginIndex)
+    return;
+
+  const std::size_t indexCount = range.endIndex - range.beginIndex;
+  const std::size_t chunkCount = (indexCount + grainSize - 1) / grainSize;
+
+  ThreadPool& threadPool = getDefaultThreadPool();
+  std::atomic<std::size_t> nextChunkIndex {};
+
+  // Only as many instances as can run concurrently are executed, each of them processing chunks until there are none left
+  threadPool.run(std::min(chunkCount, threadPool.getWorkerCount() + 1),
+                 [&range, grainSize, chunkCount, &action, &nextChunkIndex] (std::size_t) noexcept {
+    for (std::size_t chunkIndex = nextChunkIndex++; chunkIndex < chunkCount; chunkIndex = nextChunkIndex++) {
+      const std::size_t beginIndex = range.beginIndex + chunkIndex * grainSize;
+      const std::size_t endIndex   = std::min(beginIndex + grainSize, range.endIndex);
+
+      if constexpr (std::is_invocable_v<Func, IndexRange>) {
+        action(IndexRange{ beginIndex, endIndex });
+      } else {
+        for (std::size_t index = beginIndex; index < endIndex; ++index)
+          action(index);
+      }
+    }
+  });
 }
 
 } // namespace Raz::Threading
@@ -132,9 +132,19 @@ public:
   /// \param formattedLabel Text with a formatting placeholder to display the FPS (%.Xf, X being the precision after the comma).
   void addOverlayFpsCounter(std::string formattedLabel);
   /// Runs the window, refreshing its state by displaying the rendered scene, drawing the overlay, etc.
+  /// This processes the inputs (see processInputs()), then displays the frame (see display()).
   /// \param deltaTime Amount of time elapsed since the last frame.
   /// \return True if the window hasn't been required to close, false otherwise.
   bool run(float deltaTime);
+  /// Polls the window's events & executes the actions associated to the pressed keys & mouse buttons.
+  /// \param deltaTime Amount of time elapsed since the last frame.
+  /// \return True if the window hasn't been required to close, false otherwise.
+  bool processInputs(float deltaTime);
+  /// Draws the overlay, displays the rendered frame & clears the next one.
+  void display();
+  /// Tells if the window has been required to close.
+  /// \return True if the window should close, false otherwise.
+  bool shouldClose() const;
   /// Fetches the mouse position onto the window.
   /// \return 2D vector representing the mouse's position relative to the window.
   Vec2f recoverMousePosition() const;
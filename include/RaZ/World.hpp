@@ -4,21 +4,61 @@
 #define RAZ_WORLD_HPP
 
 #include "RaZ/Entity.hpp"
+#include "RaZ/EntityCommandBuffer.hpp"
+#include "RaZ/Prefab.hpp"
 #include "RaZ/System.hpp"
+#include "RaZ/SystemGraph.hpp"
+
+#include <array>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 namespace Raz {
 
+/// Report of a system whose update took longer than its time budget (see System::setTimeBudget()).
+struct BudgetOverrun {
+  const System* system {};
+  float updateDuration {}; ///< Time taken by the system's update, in seconds.
+  float timeBudget {}; ///< Time budget of the system, in seconds.
+};
+
 /// World class handling systems & entities.
 class World {
 public:
   World() = default;
-  explicit World(std::size_t entityCount) { m_entities.reserve(entityCount); }
+  /// Creates a world, preallocating everything needed to hold the given amount of entities.
+  /// \param entityCount Amount of entities to allocate memory for.
+  explicit World(std::size_t entityCount);
   World(const World&) = delete;
   World(World&&) noexcept = default;
 
   const std::vector<SystemPtr>& getSystems() const { return m_systems; }
+  /// Gets the graph ordering the updates of all the systems; it is only rebuilt on the next update after the systems have changed.
+  /// \return Constant reference to the systems' graph.
+  const SystemGraph& getSystemGraph() const noexcept { return m_systemGraphs[static_cast<std::size_t>(UpdateStep::ALL)]; }
   const std::vector<EntityPtr>& getEntities() const { return m_entities; }
+  /// Gets the pool in which the entities are allocated, giving access to its occupancy & fragmentation.
+  /// \return Constant reference to the entities' pool.
+  const ObjectPool<Entity>& getEntityPool() const noexcept { return *m_entityPool; }
+  const ComponentRegistry& getComponentRegistry() const { return *m_registry; }
+  const std::vector<ArchetypePtr>& getArchetypes() const { return m_registry->getArchetypes(); }
+  /// Gets the systems which exceeded their time budget during the last frame, which includes all the fixed steps made before the
+  ///  last call to update() or updateVariableStep().
+  /// \return Budget overruns of the last frame, ordered by step & by system ID.
+  const std::vector<BudgetOverrun>& getBudgetOverruns() const noexcept { return m_budgetOverruns; }
+  bool isRefreshDeferred() const noexcept { return m_isRefreshDeferred; }
 
+  /// Defers the structural changes: the command buffers are then not played back anymore, nor the world refreshed, at the beginning of
+  ///  each update, but only when explicitly requested (see playbackCommandBuffers() & refresh()).
+  /// This allows applying them at a chosen point, for instance on the main thread while the world is otherwise updated on another one.
+  /// \param deferred True if the structural changes should be deferred, false otherwise.
+  void deferRefresh(bool deferred = true) noexcept { m_isRefreshDeferred = deferred; }
+
+  /// Tells if any of the world's systems has explicitly required to be updated on the main thread, for instance to make graphics API calls.
+  /// If not, the world can be updated on any thread.
+  /// \return True if the world must be updated on the main thread, false otherwise.
+  bool isMainThreadRequired() const noexcept;
   /// Tells if a given system exists within the world.
   /// \tparam Sys Type of the system to be checked.
   /// \return True if the given system is present, false otherwise.
@@ -52,23 +92,133 @@ public:
   /// \param enabled True if the entity should be active immediately, false otherwise.
   /// \return Reference to the newly added entity.
   template <typename... Comps> Entity& addEntityWithComponents(bool enabled = true);
+  /// Adds several entities into the world at once, each holding copies of the given prefab's components.
+  /// This is much faster than adding the entities & their components one by one: the memory of all the entities & components is
+  ///  allocated beforehand, each type of component is copied in turn into contiguous slots, & all the entities are moved into their
+  ///  archetype at once. They are linked to the systems on the next refresh, like any other new entity.
+  /// \param prefab Prefab to create the entities from.
+  /// \param count Amount of entities to be created.
+  /// \param enabled True if the entities should be active immediately, false otherwise.
+  /// \return Pointers to the newly created entities.
+  std::vector<Entity*> instantiate(const Prefab& prefab, std::size_t count, bool enabled = true);
+  /// Tells if the entity referenced by the given handle still exists within the world.
+  /// \param handle Handle to the entity to be checked.
+  /// \return True if the entity exists, false if it has been destroyed or has never existed.
+  bool isValid(EntityHandle handle) const noexcept { return (getEntity(handle) != nullptr); }
+  /// Gets the entity referenced by the given handle.
+  /// \param handle Handle to the entity to be fetched.
+  /// \return Pointer to the entity, or nullptr if it doesn't exist anymore.
+  const Entity* getEntity(EntityHandle handle) const noexcept;
+  /// Gets the entity referenced by the given handle.
+  /// \param handle Handle to the entity to be fetched.
+  /// \return Pointer to the entity, or nullptr if it doesn't exist anymore.
+  Entity* getEntity(EntityHandle handle) noexcept { return const_cast<Entity*>(static_cast<const World*>(this)->getEntity(handle)); }
+  /// Destroys the given entity along with its components.
+  /// The destruction is deferred until the next refresh, so that it can safely be requested during an update, even from systems updated
+  ///  concurrently. The entity's index is then reused by future entities, its handles being invalidated.
+  /// \param entity Entity to be destroyed; must belong to the world.
+  void destroyEntity(Entity& entity) { m_registry->markDestroyed(entity); }
+  /// Destroys the entity referenced by the given handle, if it still exists.
+  /// \param handle Handle to the entity to be destroyed.
+  /// \see destroyEntity(Entity&)
+  void destroyEntity(EntityHandle handle);
+  /// Gets the command buffer of the calling thread, recording structural changes to be applied on the next update.
+  /// Each thread gets its own buffer, so that systems updated concurrently can record commands without contending on the world; the
+  ///  returned reference stays valid for the world's whole lifetime, even if the world is moved.
+  /// \return Reference to the calling thread's command buffer.
+  EntityCommandBuffer& getCommandBuffer();
+  /// Plays back all the threads' command buffers, applying their commands to the world.
+  /// The buffers are played back one after the other, in the order in which their threads have first requested them, & each in the order
+  ///  its commands have been recorded. If a command throws, all the buffers are cleared before the exception is propagated.
+  /// This is automatically done at the beginning of each update unless deferred (see deferRefresh()), and must not be called while
+  ///  systems are being updated.
+  void playbackCommandBuffers();
+  /// Gets a query giving a direct access to the components of all the enabled entities holding the given ones.
+  /// The query is cached: the returned reference stays valid for the world's whole lifetime, even if the world is moved.
+  /// \tparam Comps Types of the components to be queried.
+  /// \tparam ExcludedComps Types of the components that matched entities must not hold.
+  /// \param excluded Tag listing the excluded components, if any (Raz::exclude<ExcludedComps...>).
+  /// \return Reference to the query.
+  template <typename... Comps, typename... ExcludedComps> Query<Comps...>& query(Exclude<ExcludedComps...> excluded = {}) {
+    return m_registry->query<Comps...>(excluded);
+  }
   /// Updates the world, updating all the systems it contains.
+  /// The commands recorded in the command buffers are played back beforehand, then the world is refreshed.
+  /// Systems which don't conflict with each other, according to the components they declare reading & writing, are updated concurrently;
+  ///  the others are updated in the order of their IDs. Structural changes (adding or removing entities & components) must thus only
+  ///  be made directly by systems which haven't declared their accesses, as these are always updated alone; the others must record them
+  ///  into a command buffer (see getCommandBuffer()).
   /// \param deltaTime Time elapsed since the last update.
   /// \return True if the world still has active systems, false otherwise.
-  bool update(float deltaTime);
+  bool update(float deltaTime) { return updateSystems(UpdateStep::ALL, deltaTime); }
+  /// Updates the world, updating only the systems requiring a fixed step (see System::isFixedStepRequired()).
+  /// \param timeStep Fixed duration of a simulation step.
+  /// \return True if the world still has active systems, false otherwise.
+  /// \see update()
+  bool updateFixedStep(float timeStep) { return updateSystems(UpdateStep::FIXED, timeStep); }
+  /// Updates the world, updating only the systems which don't require a fixed step.
+  /// \param deltaTime Time elapsed since the last update.
+  /// \param stepInterpolation Progression of the current frame between the last two fixed steps, given to the systems.
+  /// \return True if the world still has active systems, false otherwise.
+  /// \see update()
+  bool updateVariableStep(float deltaTime, float stepInterpolation);
   /// Refreshes the world, reorganizing its entities to optimize caching by moving the active entities in front.
+  /// Only the entities which have been structurally modified since the last refresh are linked to or unlinked from the systems.
+  /// The entities which have been requested to be destroyed are so at this moment.
   void refresh();
 
   World& operator=(const World&) = delete;
-  World& operator=(World&&) noexcept = default;
+  World& operator=(World&& world) noexcept;
 
 private:
+  /// Systems updated by an update of the world.
+  enum class UpdateStep : uint8_t {
+    ALL,      ///< All the systems.
+    FIXED,    ///< Only the systems requiring a fixed step.
+    VARIABLE, ///< Only the systems not requiring a fixed step.
+
+    COUNT
+  };
+
+  struct EntitySlot {
+    Entity* entity {};
+    std::uint32_t generation {};
+  };
+
+  /// Destroys all the entities marked to be so, unlinking them from the systems & releasing their index.
+  void destroyMarkedEntities();
+  /// Creates an entity in the world, without moving it into any archetype.
+  /// \param enabled True if the entity should be active immediately, false otherwise.
+  /// \return Reference to the newly created entity.
+  Entity& createEntity(bool enabled);
+  /// Plays back the command buffers, refreshes the world & updates the systems matching the given step.
+  /// \param step Systems to be updated.
+  /// \param deltaTime Time elapsed since the last update.
+  /// \return True if the world still has active systems, false otherwise.
+  bool updateSystems(UpdateStep step, float deltaTime);
+
   std::vector<SystemPtr> m_systems {};
   Bitset m_activeSystems {};
+  std::array<SystemGraph, static_cast<std::size_t>(UpdateStep::COUNT)> m_systemGraphs {}; ///< Graphs of the systems, indexed by step.
+  std::array<bool, static_cast<std::size_t>(UpdateStep::COUNT)> m_areSystemGraphsDirty {};
 
+  // The registry & the entities' pool must be declared before the entities, so that these are destroyed first & can give their memory back
+  std::unique_ptr<ComponentRegistry> m_registry = std::make_unique<ComponentRegistry>();
+  std::unique_ptr<ObjectPool<Entity>> m_entityPool = std::make_unique<ObjectPool<Entity>>();
   std::vector<EntityPtr> m_entities {};
   std::size_t m_activeEntityCount = 0;
-  std::size_t m_maxEntityIndex = 0;
+
+  std::vector<EntitySlot> m_entitySlots {}; ///< Entities indexed by their ID, along with the generation of their index.
+  std::vector<std::size_t> m_freeEntityIndices {}; ///< Indices of destroyed entities, to be reused by the next ones.
+
+  std::vector<BudgetOverrun> m_budgetOverruns {};
+  bool m_isFrameEnded {}; ///< True if the last update ended a frame, in which case the budget overruns are reset on the next one.
+  std::uint64_t m_fixedStepCount {}; ///< Amount of fixed steps made since the World has last been updated without any.
+  bool m_isRefreshDeferred {};
+
+  std::vector<std::unique_ptr<EntityCommandBuffer>> m_commandBuffers {}; ///< Threads' command buffers, in the order of their first request.
+  std::unordered_map<std::thread::id, EntityCommandBuffer*> m_threadCommandBuffers {};
+  std::unique_ptr<std::mutex> m_commandBuffersMutex = std::make_unique<std::mutex>();
 };
 
 } // namespace Raz
@@ -1,3 +1,5 @@
+#include "RaZ/Utils/TypeUtils.hpp"
+
 #include <algorithm>
 
 namespace Raz {
@@ -30,7 +32,14 @@ Sys& World::addSystem(Args&&... args) {
     m_systems.resize(sysId + 1);
 
   m_systems[sysId] = std::make_unique<Sys>(std::forward<Args>(args)...);
+  m_systems[sysId]->m_typeName = TypeUtils::getTypeStr<Sys>();
+  m_systems[sysId]->linkComponentRegistry(*m_registry);
   m_activeSystems.setBit(sysId);
+  m_areSystemGraphsDirty.fill(true);
+
+  // The refresh only relinks dirty entities; the existing ones must be checked against the new system on the next one
+  for (const EntityPtr& entity : m_entities)
+    m_registry->markDirty(*entity);
 
   return static_cast<Sys&>(*m_systems[sysId]);
 }
@@ -39,8 +48,14 @@ template <typename Sys>
 void World::removeSystem() {
   static_assert(std::is_base_of_v<System, Sys>, "Error: Removed system must be derived from System.");
 
-  if (hasSystem<Sys>())
-    m_systems[System::getId<Sys>()].reset();
+  if (!hasSystem<Sys>())
+    return;
+
+  const std::size_t sysId = System::getId<Sys>();
+
+  m_systems[sysId].reset();
+  m_activeSystems.setBit(sysId, false);
+  m_areSystemGraphsDirty.fill(true);
 }
 
 template <typename Comp, typename... Args>
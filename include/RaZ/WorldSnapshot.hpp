@@ -0,0 +1,160 @@
+#pragma once
+
+#ifndef RAZ_WORLDSNAPSHOT_HPP
+#define RAZ_WORLDSNAPSHOT_HPP
+
+#include "RaZ/Component.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Raz {
+
+class Entity;
+class World;
+
+/// SnapshotWriter class, appending raw values to a contiguous byte buffer.
+/// Values are written with the native endianness & layout; they must thus be read back on a machine with the same ones.
+class SnapshotWriter {
+public:
+  /// Creates a writer, appending values to the given buffer; its content is discarded, but its memory is reused.
+  /// \param data Buffer to write into.
+  explicit SnapshotWriter(std::vector<std::byte> data = {}) noexcept : m_data{ std::move(data) } { m_data.clear(); }
+
+  const std::vector<std::byte>& getData() const noexcept { return m_data; }
+  std::vector<std::byte>& getData() noexcept { return m_data; }
+  std::size_t getSize() const noexcept { return m_data.size(); }
+
+  /// Writes a value byte for byte.
+  /// \tparam T Type of the value to be written; must be trivially copyable.
+  /// \param value Value to be written.
+  template <typename T> void write(const T& value) { writeArray(&value, 1); }
+  /// Writes several contiguous values byte for byte, all at once.
+  /// \tparam T Type of the values to be written; must be trivially copyable.
+  /// \param values Values to be written.
+  /// \param count Amount of values to be written.
+  template <typename T> void writeArray(const T* values, std::size_t count);
+  /// Writes a string, preceded by its length.
+  /// \param text String to be written.
+  void writeString(std::string_view text);
+
+private:
+  std::vector<std::byte> m_data {};
+};
+
+/// SnapshotReader class, reading raw values from a contiguous byte buffer which it doesn't own, such as a memory-mapped file.
+/// Any attempt to read past the end of the buffer throws an exception.
+class SnapshotReader {
+public:
+  SnapshotReader(const std::byte* data, std::size_t size) noexcept : m_data{ data }, m_size{ size } {}
+
+  std::size_t getPosition() const noexcept { return m_position; }
+  std::size_t getRemainingSize() const noexcept { return m_size - m_position; }
+
+  /// Reads a value written by SnapshotWriter::write().
+  /// \tparam T Type of the value to be read; must be trivially copyable.
+  /// \return Value read.
+  template <typename T> T read();
+  /// Reads several contiguous values written by SnapshotWriter::writeArray().
+  /// \tparam T Type of the values to be read; must be trivially copyable.
+  /// \param values Values to be filled.
+  /// \param count Amount of values to be read.
+  template <typename T> void readArray(T* values, std::size_t count);
+  /// Reads a string written by SnapshotWriter::writeString().
+  /// \return String read.
+  std::string readString();
+  /// Gives a direct access to the next bytes, then skips them.
+  /// \param size Amount of bytes to be accessed.
+  /// \return Pointer to the first byte.
+  const std::byte* readBytes(std::size_t size);
+
+private:
+  const std::byte* m_data {};
+  std::size_t m_size {};
+  std::size_t m_position {};
+};
+
+/// WorldSnapshot class, saving the entities of a World & their components into a binary snapshot, & restoring them.
+/// Only the components whose type has been registered are saved; Transform & RigidBody are registered by default.
+/// A snapshot is made of a versioned header & of the entities' enabled states, followed by a block per component type. Each block is
+///  identified by the component's registered name & version, & holds the indices of the entities holding the component, then all the
+///  components' data stored contiguously; blocks of unknown components are skipped when loading.
+class WorldSnapshot {
+public:
+  /// Function writing a component's data.
+  template <typename Comp> using SaveFunc = std::function<void(const Comp&, SnapshotWriter&)>;
+  /// Function reading a component's data & adding the component to the given entity, according to the version it has been saved with.
+  using LoadFunc = std::function<void(Entity&, SnapshotReader&, std::uint32_t)>;
+
+  /// Format version of the snapshots, changed whenever their layout is.
+  static constexpr std::uint32_t FormatVersion = 1;
+
+  /// Creates a snapshot serializer, in which Transform & RigidBody are registered.
+  WorldSnapshot();
+
+  /// Tells if the given component's type has been registered.
+  /// \tparam Comp Type of the component to be checked.
+  /// \return True if the component is saved in the snapshots, false otherwise.
+  template <typename Comp> bool isComponentRegistered() const noexcept;
+  /// Registers a component's type, so that it is saved in the snapshots. If it already was, its functions are replaced.
+  /// \tparam Comp Type of the component to be registered.
+  /// \param name Name identifying the component in the snapshots; it must remain the same across executions.
+  /// \param version Version of the component's data, given to the load function so that older snapshots can still be read.
+  /// \param save Function writing a component's data.
+  /// \param load Function reading a component's data & adding it to an entity.
+  template <typename Comp> void registerComponent(std::string name, std::uint32_t version, SaveFunc<Comp> save, LoadFunc load);
+  /// Saves all the entities of the given world, except those pending destruction, along with their registered components.
+  /// \param world World to be saved.
+  /// \return Bytes of the snapshot.
+  std::vector<std::byte> save(const World& world) const;
+  /// Saves all the entities of the given world into an existing buffer, whose memory is reused; this avoids reallocating it when
+  ///  snapshots are taken regularly.
+  /// \param world World to be saved.
+  /// \param snapshot Buffer to be filled with the bytes of the snapshot; its previous content is discarded.
+  void save(const World& world, std::vector<std::byte>& snapshot) const;
+  /// Saves all the entities of the given world into a file, written all at once.
+  /// \param world World to be saved.
+  /// \param filePath Path to the file to be written.
+  void save(const World& world, const std::string& filePath) const;
+  /// Loads a snapshot, adding its entities to the given world; the world's existing entities are kept.
+  /// The snapshot is read in place, & can thus be a memory-mapped file.
+  /// If the snapshot is invalid, an exception is thrown without any entity being added; if only a component's data turns out to be, the
+  ///  entities already created are destroyed on the world's next refresh.
+  /// \param world World to add the entities to.
+  /// \param data Bytes of the snapshot.
+  /// \param size Amount of bytes.
+  /// \return Created entities, in the order they were saved.
+  std::vector<Entity*> load(World& world, const std::byte* data, std::size_t size) const;
+  /// Loads a snapshot, adding its entities to the given world; the world's existing entities are kept.
+  /// \param world World to add the entities to.
+  /// \param snapshot Bytes of the snapshot.
+  /// \return Created entities, in the order they were saved.
+  std::vector<Entity*> load(World& world, const std::vector<std::byte>& snapshot) const { return load(world, snapshot.data(), snapshot.size()); }
+  /// Loads a snapshot from a file, read all at once, adding its entities to the given world.
+  /// \param world World to add the entities to.
+  /// \param filePath Path to the file to be read.
+  /// \return Created entities, in the order they were saved.
+  std::vector<Entity*> load(World& world, const std::string& filePath) const;
+
+private:
+  struct ComponentSerializer {
+    std::size_t componentId;
+    std::string name;
+    std::uint32_t version;
+    std::function<void(const Component&, SnapshotWriter&)> save;
+    LoadFunc load;
+  };
+
+  std::vector<ComponentSerializer> m_serializers {};
+};
+
+} // namespace Raz
+
+#include "RaZ/WorldSnapshot.inl"
+
+#endif // RAZ_WORLDSNAPSHOT_HPP
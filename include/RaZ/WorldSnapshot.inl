@@ -0,0 +1,70 @@
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+namespace Raz {
+
+template <typename T>
+void SnapshotWriter::writeArray(const T* values, std::size_t count) {
+  static_assert(std::is_trivially_copyable_v<T>, "Error: Written values must be trivially copyable.");
+
+  if (count == 0)
+    return;
+
+  const std::size_t position = m_data.size();
+  m_data.resize(position + sizeof(T) * count);
+  std::memcpy(m_data.data() + position, values, sizeof(T) * count);
+}
+
+template <typename T>
+T SnapshotReader::read() {
+  T value {};
+  readArray(&value, 1);
+  return value;
+}
+
+template <typename T>
+void SnapshotReader::readArray(T* values, std::size_t count) {
+  static_assert(std::is_trivially_copyable_v<T>, "Error: Read values must be trivially copyable.");
+
+  if (count == 0)
+    return;
+
+  std::memcpy(values, readBytes(sizeof(T) * count), sizeof(T) * count);
+}
+
+template <typename Comp>
+bool WorldSnapshot::isComponentRegistered() const noexcept {
+  const std::size_t compId = Component::getId<Comp>();
+
+  return std::any_of(m_serializers.cbegin(), m_serializers.cend(), [compId] (const ComponentSerializer& serializer) {
+    return (serializer.componentId == compId);
+  });
+}
+
+template <typename Comp>
+void WorldSnapshot::registerComponent(std::string name, std::uint32_t version, SaveFunc<Comp> save, LoadFunc load) {
+  static_assert(std::is_base_of_v<Component, Comp>, "Error: Registered component must be derived from Component.");
+
+  const std::size_t compId = Component::getId<Comp>();
+
+  auto saveComponent = [save = std::move(save)] (const Component& component, SnapshotWriter& writer) {
+    save(static_cast<const Comp&>(component), writer);
+  };
+
+  for (ComponentSerializer& serializer : m_serializers) {
+    if (serializer.componentId != compId && serializer.name != name)
+      continue;
+
+    if (serializer.componentId != compId)
+      throw std::invalid_argument("Error: The component name '" + name + "' is already registered for another component");
+
+    serializer = ComponentSerializer{ compId, std::move(name), version, std::move(saveComponent), std::move(load) };
+    return;
+  }
+
+  m_serializers.emplace_back(ComponentSerializer{ compId, std::move(name), version, std::move(saveComponent), std::move(load) });
+}
+
+} // namespace Raz
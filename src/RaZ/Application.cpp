@@ -1,25 +1,292 @@
 #include "RaZ/Application.hpp"
+#include "RaZ/Render/RenderSystem.hpp"
+#include "RaZ/Utils/Profiler.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <utility>
 
 namespace Raz {
 
+namespace {
+
+/// Calls the given function when going out of scope, whether normally or because an exception has been thrown.
+/// \tparam FuncT Type of the function to be called; must not throw.
+template <typename FuncT>
+class ScopeGuard {
+public:
+  explicit ScopeGuard(FuncT func) : m_func{ std::move(func) } {}
+  ScopeGuard(const ScopeGuard&) = delete;
+  ScopeGuard(ScopeGuard&&) noexcept = delete;
+
+  ScopeGuard& operator=(const ScopeGuard&) = delete;
+  ScopeGuard& operator=(ScopeGuard&&) noexcept = delete;
+
+  ~ScopeGuard() { m_func(); }
+
+private:
+  FuncT m_func;
+};
+
+} // namespace
+
 World& Application::addWorld(World world) {
   m_worlds.emplace_back(std::move(world));
   m_activeWorlds.setBit(m_worlds.size() - 1);
+  m_worldUpdateTimes.emplace_back(0.f);
 
   return m_worlds.back();
 }
 
+void Application::setMaxFrameRate(float frameRate) {
+  assert("Error: The maximum frame rate must not be negative." && frameRate >= 0.f);
+
+  if (frameRate == 0.f) {
+    m_minFrameDuration = std::chrono::steady_clock::duration::zero();
+    return;
+  }
+
+  m_minFrameDuration = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float>(1.f / frameRate));
+}
+
 bool Application::run() {
-  const auto currentTime = std::chrono::system_clock::now();
-  m_deltaTime            = std::chrono::duration_cast<std::chrono::duration<float>>(currentTime - m_lastFrameTime).count();
+  if (m_minFrameDuration != std::chrono::steady_clock::duration::zero())
+    std::this_thread::sleep_until(m_lastFrameTime + m_minFrameDuration);
+
+  const auto currentTime = std::chrono::steady_clock::now();
+  const float deltaTime  = std::chrono::duration_cast<std::chrono::duration<float>>(currentTime - m_lastFrameTime).count();
   m_lastFrameTime        = currentTime;
 
+  return run(deltaTime);
+}
+
+bool Application::run(float deltaTime) {
+  RAZ_PROFILE_ZONE("Application::run");
+
+  m_deltaTime = deltaTime;
+
+  std::fill(m_worldUpdateTimes.begin(), m_worldUpdateTimes.end(), 0.f);
+
+  std::vector<PipelinedSystem> pipelinedSystems;
+
   for (std::size_t worldIndex = 0; worldIndex < m_worlds.size(); ++worldIndex) {
-    if (!m_worlds[worldIndex].update(m_deltaTime))
-      m_activeWorlds.setBit(worldIndex, false);
+    for (const SystemPtr& system : m_worlds[worldIndex].getSystems()) {
+      if (system && system->isPipelined())
+        pipelinedSystems.push_back(PipelinedSystem{ system.get(), worldIndex });
+    }
   }
 
+  if (pipelinedSystems.empty())
+    simulate();
+  else
+    simulateAndRender(pipelinedSystems);
+
   return m_isRunning && !m_activeWorlds.isEmpty();
 }
 
+void Application::simulate() {
+  if (m_fixedTimeStep == 0.f) {
+    m_stepInterpolation = 0.f;
+    updateWorlds([this] (World& world) { return world.update(m_deltaTime); });
+
+    return;
+  }
+
+  m_timeAccumulator += m_deltaTime;
+
+  std::size_t stepCount = 0;
+
+  while (m_timeAccumulator >= m_fixedTimeStep && stepCount < m_maxStepCount) {
+    updateWorlds([this] (World& world) { return world.updateFixedStep(m_fixedTimeStep); });
+
+    m_timeAccumulator -= m_fixedTimeStep;
+    ++stepCount;
+  }
+
+  // If the simulation couldn't keep up, the late steps are dropped instead of being accumulated, which would make it fall further behind
+  if (m_timeAccumulator >= m_fixedTimeStep)
+    m_timeAccumulator = std::fmod(m_timeAccumulator, m_fixedTimeStep);
+
+  m_stepInterpolation = m_timeAccumulator / m_fixedTimeStep;
+
+  updateWorlds([this] (World& world) { return world.updateVariableStep(m_deltaTime, m_stepInterpolation); });
+}
+
+void Application::simulateAndRender(const std::vector<PipelinedSystem>& pipelinedSystems) {
+  // The structural changes & the inputs' actions may modify any entity or make graphics API calls (such as loading meshes); they are
+  //  thus all applied on the main thread before the simulation starts, & deferred until the next frame during it
+  std::vector<World*> deferredWorlds;
+
+  for (World& world : m_worlds) {
+    world.playbackCommandBuffers();
+    world.refresh();
+
+    if (!world.isRefreshDeferred()) {
+      world.deferRefresh();
+      deferredWorlds.emplace_back(&world);
+    }
+
+    if (world.hasSystem<RenderSystem>()) {
+      RenderSystem& renderSystem = world.getSystem<RenderSystem>();
+
+      if (renderSystem.isPipelined() && renderSystem.hasWindow())
+        renderSystem.getWindow().processInputs(m_deltaTime);
+    }
+  }
+
+  const auto restoreRefresh = [&deferredWorlds] () noexcept {
+    for (World* world : deferredWorlds)
+      world->deferRefresh(false);
+  };
+
+  // The results are only applied once the simulation is over, as it also deactivates the worlds
+  std::vector<std::uint8_t> renderResults(pipelinedSystems.size(), true);
+
+  const auto render = [&pipelinedSystems, &renderResults] () {
+    for (std::size_t systemIndex = 0; systemIndex < pipelinedSystems.size(); ++systemIndex)
+      renderResults[systemIndex] = pipelinedSystems[systemIndex].system->render();
+  };
+
+  const auto applyRenderResults = [this, &pipelinedSystems, &renderResults] () {
+    for (std::size_t systemIndex = 0; systemIndex < pipelinedSystems.size(); ++systemIndex) {
+      if (!renderResults[systemIndex])
+        m_activeWorlds.setBit(pipelinedSystems[systemIndex].worldIndex, false);
+    }
+  };
+
+#if defined(RAZ_THREADS_AVAILABLE)
+  const bool isMainThreadRequired = std::any_of(m_worlds.cbegin(), m_worlds.cend(), [] (const World& world) {
+    return world.isMainThreadRequired();
+  });
+
+  // A frame referencing components which may be modified during the simulation can't be drawn meanwhile
+  const bool isRenderingExclusive = std::any_of(pipelinedSystems.cbegin(), pipelinedSystems.cend(), [this] (const PipelinedSystem& pipelined) {
+    const Bitset& renderedComponents = pipelined.system->getRenderedComponents();
+
+    if (renderedComponents.isEmpty())
+      return false;
+
+    const std::vector<SystemPtr>& systems = m_worlds[pipelined.worldIndex].getSystems();
+
+    return std::any_of(systems.cbegin(), systems.cend(), [&renderedComponents] (const SystemPtr& system) {
+      return (system && (!system->hasDeclaredAccesses() || system->getWrittenComponents().intersects(renderedComponents)));
+    });
+  });
+
+  if (!isMainThreadRequired && !isRenderingExclusive) {
+    // The frame prepared by the previous simulation is rendered while the next one is being simulated
+    std::future<void> simulation = Threading::launchAsync([this] () { simulate(); });
+
+    {
+      // Even if the rendering throws, the simulation, which uses the application & its worlds, must be over before leaving
+      const ScopeGuard simulationGuard([&simulation, &restoreRefresh] () noexcept {
+        ThreadPool& threadPool = Threading::getDefaultThreadPool();
+
+        while (simulation.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+          if (!threadPool.runPendingTask())
+            std::this_thread::yield();
+        }
+
+        restoreRefresh();
+      });
+
+      render();
+    }
+
+    simulation.get();
+    applyRenderResults();
+
+    return;
+  }
+#endif
+
+  // If any world must be updated on the main thread or any frame can't be drawn during the simulation, both are made one after the other
+  {
+    const ScopeGuard refreshGuard(restoreRefresh);
+    simulate();
+  }
+
+  render();
+  applyRenderResults();
+}
+
+void Application::updateWorlds(const std::function<bool(World&)>& update) {
+  // Worlds are updated regardless of their activity, their result being only used to know if the application is still running
+  const auto updateWorld = [this, &update] (std::size_t worldIndex) {
+    const auto startTime = std::chrono::steady_clock::now();
+    const bool isActive  = update(m_worlds[worldIndex]);
+    m_worldUpdateTimes[worldIndex] += std::chrono::duration_cast<std::chrono::duration<float>>(std::chrono::steady_clock::now() - startTime).count();
+
+    return isActive;
+  };
+
+#if defined(RAZ_THREADS_AVAILABLE)
+  if (m_isParallelWorldUpdateEnabled && m_worlds.size() > 1) {
+    // Bits of the same word can't be written concurrently; the results are thus gathered before being reported
+    std::vector<std::uint8_t> worldResults(m_worlds.size(), true);
+    std::atomic<std::size_t> remainingWorldCount = 0;
+
+    std::mutex exceptionMutex;
+    std::exception_ptr exception;
+
+    // If any world throws, the others are still updated, after which the first exception thrown is rethrown
+    const auto tryUpdateWorld = [&] (std::size_t worldIndex) noexcept {
+      try {
+        worldResults[worldIndex] = updateWorld(worldIndex);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(exceptionMutex);
+
+        if (!exception)
+          exception = std::current_exception();
+      }
+    };
+
+    ThreadPool& threadPool = Threading::getDefaultThreadPool();
+
+    for (std::size_t worldIndex = 0; worldIndex < m_worlds.size(); ++worldIndex) {
+      if (m_worlds[worldIndex].isMainThreadRequired())
+        continue;
+
+      ++remainingWorldCount;
+
+      threadPool.addTask([&tryUpdateWorld, &remainingWorldCount, worldIndex] () noexcept {
+        tryUpdateWorld(worldIndex);
+        --remainingWorldCount;
+      });
+    }
+
+    // The worlds requiring the main thread are updated by the calling thread while the others are being updated by the thread pool
+    for (std::size_t worldIndex = 0; worldIndex < m_worlds.size(); ++worldIndex) {
+      if (m_worlds[worldIndex].isMainThreadRequired())
+        tryUpdateWorld(worldIndex);
+    }
+
+    while (remainingWorldCount > 0) {
+      if (!threadPool.runPendingTask())
+        std::this_thread::yield();
+    }
+
+    for (std::size_t worldIndex = 0; worldIndex < m_worlds.size(); ++worldIndex) {
+      if (!worldResults[worldIndex])
+        m_activeWorlds.setBit(worldIndex, false);
+    }
+
+    if (exception)
+      std::rethrow_exception(exception);
+
+    return;
+  }
+#endif
+
+  for (std::size_t worldIndex = 0; worldIndex < m_worlds.size(); ++worldIndex) {
+    if (!updateWorld(worldIndex))
+      m_activeWorlds.setBit(worldIndex, false);
+  }
+}
+
 } // namespace Raz
@@ -0,0 +1,68 @@
+#include "RaZ/Archetype.hpp"
+#include "RaZ/Entity.hpp"
+
+#include <cassert>
+
+namespace Raz {
+
+Archetype::Archetype(Bitset signature) : m_signature{ std::move(signature) }, m_columns(m_signature.getSize()) {
+  assert("Error: An archetype's signature must not have trailing disabled bits." && (m_signature.isEmpty() || m_signature[m_signature.getSize() - 1]));
+
+  m_componentIds.reserve(m_signature.getEnabledBitCount());
+  m_signature.forEachEnabledBit([this] (std::size_t compId) { m_componentIds.emplace_back(compId); });
+}
+
+void Archetype::addEntity(Entity& entity) {
+  assert("Error: The entity already belongs to an archetype." && entity.m_archetype == nullptr);
+
+  entity.m_archetype      = this;
+  entity.m_archetypeIndex = m_entities.size();
+
+  m_entities.emplace_back(&entity);
+
+  for (std::size_t compId : m_componentIds)
+    m_columns[compId].emplace_back(entity.getComponents()[compId].get());
+}
+
+void Archetype::addEntities(const std::vector<Entity*>& entities) {
+  // Filling each column in turn, rather than entity by entity, keeps the accesses sequential
+  const std::size_t firstIndex = m_entities.size();
+  m_entities.insert(m_entities.end(), entities.cbegin(), entities.cend());
+
+  for (std::size_t entityIndex = firstIndex; entityIndex < m_entities.size(); ++entityIndex) {
+    Entity& entity = *m_entities[entityIndex];
+    assert("Error: The entity already belongs to an archetype." && entity.m_archetype == nullptr);
+
+    entity.m_archetype      = this;
+    entity.m_archetypeIndex = entityIndex;
+  }
+
+  for (std::size_t compId : m_componentIds) {
+    std::vector<Component*>& column = m_columns[compId];
+
+    for (const Entity* entity : entities)
+      column.emplace_back(entity->getComponents()[compId].get());
+  }
+}
+
+void Archetype::removeEntity(Entity& entity) {
+  assert("Error: The entity doesn't belong to this archetype." && entity.m_archetype == this);
+
+  const std::size_t entityIndex = entity.m_archetypeIndex;
+
+  // Moving the last entity & its components' pointers in place of the removed ones, so that no column has any gap
+  Entity* lastEntity = m_entities.back();
+  lastEntity->m_archetypeIndex = entityIndex;
+  m_entities[entityIndex]      = lastEntity;
+  m_entities.pop_back();
+
+  for (std::size_t compId : m_componentIds) {
+    std::vector<Component*>& column = m_columns[compId];
+    column[entityIndex] = column.back();
+    column.pop_back();
+  }
+
+  entity.m_archetype = nullptr;
+}
+
+} // namespace Raz
@@ -0,0 +1,13 @@
+#include "RaZ/Component.hpp"
+#include "RaZ/ComponentStorage.hpp"
+
+namespace Raz {
+
+void ComponentDeleter::operator()(Component* component) const noexcept {
+  if (storage)
+    storage->destroy(*component);
+  else
+    delete component;
+}
+
+} // namespace Raz
@@ -0,0 +1,98 @@
+#include "RaZ/ComponentRegistry.hpp"
+#include "RaZ/Entity.hpp"
+
+namespace Raz {
+
+namespace {
+
+/// Computes the signature of the archetype matching the given entity's components.
+/// \param entity Entity to compute the signature of.
+/// \return Signature of the entity's archetype.
+Bitset computeSignature(const Entity& entity) {
+  // The signature is stripped from its trailing disabled bits, so that equivalent sets of components always lead to the same archetype
+  const Bitset& enabledComponents = entity.getEnabledComponents();
+  const std::size_t lastCompId    = enabledComponents.findLastEnabledBit();
+
+  Bitset signature = enabledComponents;
+  signature.resize(lastCompId < enabledComponents.getSize() ? lastCompId + 1 : 0);
+
+  return signature;
+}
+
+} // namespace
+
+void ComponentRegistry::updateEntity(Entity& entity) {
+  markDirty(entity);
+  removeEntity(entity);
+
+  if (!entity.isEnabled())
+    return;
+
+  recoverArchetype(computeSignature(entity)).addEntity(entity);
+}
+
+void ComponentRegistry::addEntities(const std::vector<Entity*>& entities) {
+  for (Entity* entity : entities)
+    markDirty(*entity);
+
+  if (entities.empty() || !entities.front()->isEnabled())
+    return;
+
+  recoverArchetype(computeSignature(*entities.front())).addEntities(entities);
+}
+
+void ComponentRegistry::markDirty(Entity& entity) {
+  if (entity.m_isDirty)
+    return;
+
+  entity.m_isDirty = true;
+  m_dirtyEntities.emplace_back(&entity);
+}
+
+void ComponentRegistry::clearDirtyEntities() {
+  for (Entity* entity : m_dirtyEntities)
+    entity->m_isDirty = false;
+
+  m_dirtyEntities.clear();
+}
+
+void ComponentRegistry::markDestroyed(Entity& entity) {
+  std::lock_guard<std::mutex> lock(m_destroyedEntitiesMutex);
+
+  if (entity.m_isPendingDestruction)
+    return;
+
+  entity.m_isPendingDestruction = true;
+  m_destroyedEntities.emplace_back(&entity);
+}
+
+void ComponentRegistry::removeEntity(Entity& entity) {
+  if (entity.m_archetype)
+    entity.m_archetype->removeEntity(entity);
+}
+
+std::size_t ComponentRegistry::QueryKeyHasher::operator()(const QueryKey& key) const noexcept {
+  std::size_t hash = key.constComponents.hash(key.excludedComponents.hash());
+
+  for (std::size_t compId : key.componentIds)
+    hash ^= std::hash<std::size_t>()(compId) + 0x9e3779b9 + (hash << 6u) + (hash >> 2u);
+
+  return hash;
+}
+
+Archetype& ComponentRegistry::recoverArchetype(const Bitset& signature) {
+  const auto archetypeIt = m_archetypesBySignature.find(signature);
+
+  if (archetypeIt != m_archetypesBySignature.end())
+    return *archetypeIt->second;
+
+  Archetype& archetype = *m_archetypes.emplace_back(std::make_unique<Archetype>(signature));
+  m_archetypesBySignature.emplace(signature, &archetype);
+
+  for (const std::unique_ptr<BaseQuery>& query : m_queries)
+    query->addArchetype(archetype);
+
+  return archetype;
+}
+
+} // namespace Raz
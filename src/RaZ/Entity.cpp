@@ -0,0 +1,26 @@
+#include "RaZ/Entity.hpp"
+
+namespace Raz {
+
+void EntityDeleter::operator()(Entity* entity) const noexcept {
+  if (pool)
+    pool->destroy(*entity);
+  else
+    delete entity;
+}
+
+Entity::Entity(std::size_t index, ComponentRegistry& registry, bool enabled) : m_id{ index }, m_enabled{ enabled }, m_registry{ &registry } {
+  m_registry->updateEntity(*this);
+}
+
+void Entity::enable(bool enabled) {
+  if (m_enabled == enabled)
+    return;
+
+  m_enabled = enabled;
+
+  if (m_registry)
+    m_registry->updateEntity(*this);
+}
+
+} // namespace Raz
@@ -0,0 +1,62 @@
+#include "RaZ/EntityCommandBuffer.hpp"
+#include "RaZ/World.hpp"
+
+namespace Raz {
+
+DeferredEntity EntityCommandBuffer::createEntity(bool enabled) {
+  const DeferredEntity entity { m_deferredEntityCount++ };
+  m_commands.emplace_back(Command{ CommandType::CREATE, Target(entity), enabled });
+
+  return entity;
+}
+
+void EntityCommandBuffer::playback(World& world) {
+  std::vector<EntityHandle> createdEntities;
+  createdEntities.reserve(m_deferredEntityCount);
+
+  try {
+    for (Command& command : m_commands) {
+      if (command.type == CommandType::CREATE) {
+        createdEntities.emplace_back(world.addEntity(command.enabled).getHandle());
+        continue;
+      }
+
+      const EntityHandle handle = (command.target.isDeferred ? createdEntities[command.target.handle.index] : command.target.handle);
+      Entity* entity = world.getEntity(handle);
+
+      // An entity may have been destroyed since the command has been recorded, either by another command or directly from the world
+      if (entity == nullptr || entity->isPendingDestruction())
+        continue;
+
+      switch (command.type) {
+        case CommandType::DESTROY:
+          world.destroyEntity(*entity);
+          break;
+
+        case CommandType::ENABLE:
+          entity->enable(command.enabled);
+          break;
+
+        case CommandType::MODIFY:
+          command.modification(*entity);
+          break;
+
+        default:
+          break;
+      }
+    }
+  } catch (...) {
+    // The remaining commands may depend on the failed one, such as those targeting an entity it was meant to create; none of them is kept
+    clear();
+    throw;
+  }
+
+  clear();
+}
+
+void EntityCommandBuffer::clear() noexcept {
+  m_commands.clear();
+  m_deferredEntityCount = 0;
+}
+
+} // namespace Raz
@@ -0,0 +1,139 @@
+#include "RaZ/ComponentRegistry.hpp"
+#include "RaZ/Math/SceneGraphSystem.hpp"
+#include "RaZ/Math/SceneNode.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace Raz {
+
+SceneGraphSystem::SceneGraphSystem() {
+  m_acceptedComponents.setBit(Component::getId<SceneNode>());
+
+  registerReadComponents<Transform>();
+  registerWrittenComponents<SceneNode>();
+}
+
+void SceneGraphSystem::linkEntity(Entity& entity) {
+  System::linkEntity(entity);
+  m_isOrderDirty = true;
+}
+
+void SceneGraphSystem::unlinkEntity(Entity& entity) {
+  System::unlinkEntity(entity);
+  m_isOrderDirty = true;
+}
+
+bool SceneGraphSystem::update(float) {
+  const std::uint64_t hierarchyRevision = SceneNode::getHierarchyRevision();
+  const bool forceUpdate = (m_isOrderDirty || isHierarchyModified());
+
+  if (forceUpdate) {
+    rebuildOrder();
+
+    m_hierarchyRevision = hierarchyRevision;
+    m_isOrderDirty      = false;
+  }
+
+  const std::size_t hierarchyCount = getHierarchyCount();
+
+#if defined(RAZ_THREADS_AVAILABLE)
+  if (m_nodes.size() >= m_parallelThreshold && hierarchyCount > 1) {
+    // Several small chunks are given to each thread, so that the work stays balanced even if the hierarchies have very different sizes
+    const std::size_t chunkCount = static_cast<std::size_t>(Threading::getSystemThreadCount()) * 4;
+    const std::size_t grainSize  = std::max<std::size_t>(hierarchyCount / chunkCount, 1);
+
+    Threading::parallelFor(Threading::IndexRange{ 0, hierarchyCount }, grainSize, [this, forceUpdate] (Threading::IndexRange range) {
+      updateHierarchies(range.beginIndex, range.endIndex, forceUpdate);
+    });
+
+    return true;
+  }
+#endif
+
+  updateHierarchies(0, hierarchyCount, forceUpdate);
+
+  return true;
+}
+
+bool SceneGraphSystem::isHierarchyModified() const {
+  // Only the linked nodes can change the hierarchies processed by the system; those of other worlds are thus left out
+  return std::any_of(m_entities.cbegin(), m_entities.cend(), [this] (const Entity* entity) {
+    return (entity->getComponent<SceneNode>().m_parentRevision > m_hierarchyRevision);
+  });
+}
+
+void SceneGraphSystem::rebuildOrder() {
+  m_nodes.clear();
+  m_hierarchyOffsets.clear();
+
+  std::unordered_map<const SceneNode*, const Entity*> nodeEntities;
+  nodeEntities.reserve(m_entities.size());
+
+  for (const Entity* entity : m_entities)
+    nodeEntities.emplace(&entity->getComponent<SceneNode>(), entity);
+
+  m_nodes.reserve(m_entities.size());
+
+  for (Entity* entity : m_entities) {
+    // Nodes attached to a parent are reached from their root; those whose root isn't linked to the system are ignored
+    auto& root = entity->getComponent<SceneNode>();
+
+    if (!root.isRoot())
+      continue;
+
+    const std::size_t rootIndex = m_nodes.size();
+    m_hierarchyOffsets.emplace_back(rootIndex);
+    m_nodes.push_back(NodeEntry{ entity, &root, rootIndex, false, false });
+
+    // The entries being added in breadth-first order, a node's children are appended after all the nodes of the previous depths
+    for (std::size_t nodeIndex = rootIndex; nodeIndex < m_nodes.size(); ++nodeIndex) {
+      for (SceneNode* child : m_nodes[nodeIndex].node->getChildren()) {
+        const auto childEntity = nodeEntities.find(child);
+
+        if (childEntity == nodeEntities.cend())
+          continue;
+
+        m_nodes.push_back(NodeEntry{ childEntity->second, child, nodeIndex, false, false });
+      }
+    }
+  }
+
+  m_hierarchyOffsets.emplace_back(m_nodes.size());
+}
+
+void SceneGraphSystem::updateHierarchies(std::size_t firstHierarchyIndex, std::size_t lastHierarchyIndex, bool forceUpdate) {
+  const std::uint64_t lastUpdateVersion = getLastUpdateVersion();
+
+  for (std::size_t nodeIndex = m_hierarchyOffsets[firstHierarchyIndex]; nodeIndex < m_hierarchyOffsets[lastHierarchyIndex]; ++nodeIndex) {
+    NodeEntry& entry = m_nodes[nodeIndex];
+
+    const bool hasTransform = entry.entity->hasComponent<Transform>();
+    const Transform* transform = (hasTransform ? &entry.entity->getComponent<Transform>() : nullptr);
+    const bool isLocalMatrixUpdated = (forceUpdate || hasTransform != entry.hasTransform
+                                    || (transform && transform->hasChangedSince(lastUpdateVersion)));
+
+    if (isLocalMatrixUpdated)
+      entry.node->m_localMatrix = (transform ? transform->computeTransformMatrix() : Mat4f::identity());
+
+    entry.hasTransform = hasTransform;
+
+    const bool isRoot = (entry.parentIndex == nodeIndex);
+    const NodeEntry& parentEntry = m_nodes[entry.parentIndex];
+    entry.isWorldMatrixUpdated = (isLocalMatrixUpdated || (!isRoot && parentEntry.isWorldMatrixUpdated));
+
+    if (!entry.isWorldMatrixUpdated)
+      continue;
+
+    // Matrices being applied to row vectors, the parent's transformation comes after the node's own one
+    entry.node->m_worldMatrix = (isRoot ? entry.node->m_localMatrix : entry.node->m_localMatrix * parentEntry.node->m_worldMatrix);
+
+    // Flagging the node lets the systems depending on its world matrix, like the SpatialIndexSystem, only process those that moved
+    if (m_componentRegistry)
+      entry.node->markChanged(m_componentRegistry->getChangeVersion());
+  }
+}
+
+} // namespace Raz
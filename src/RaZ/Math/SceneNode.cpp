@@ -0,0 +1,48 @@
+#include "RaZ/Math/SceneNode.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace Raz {
+
+void SceneNode::setParent(SceneNode& parent) {
+  assert("Error: A SceneNode cannot be its own parent." && &parent != this);
+
+#if defined(RAZ_CONFIG_DEBUG)
+  for (const SceneNode* ancestor = parent.m_parent; ancestor; ancestor = ancestor->m_parent)
+    assert("Error: A SceneNode cannot be a child of one of its descendants." && ancestor != this);
+#endif
+
+  if (m_parent == &parent)
+    return;
+
+  detach();
+
+  parent.m_children.emplace_back(this);
+  m_parent = &parent;
+
+  markParentChanged();
+}
+
+void SceneNode::detach() {
+  if (m_parent == nullptr)
+    return;
+
+  std::vector<SceneNode*>& siblings = m_parent->m_children;
+  siblings.erase(std::find(siblings.begin(), siblings.end(), this));
+
+  m_parent = nullptr;
+
+  markParentChanged();
+}
+
+SceneNode::~SceneNode() {
+  detach();
+
+  for (SceneNode* child : m_children) {
+    child->m_parent = nullptr;
+    child->markParentChanged();
+  }
+}
+
+} // namespace Raz
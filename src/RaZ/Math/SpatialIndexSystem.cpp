@@ -0,0 +1,151 @@
+#include "RaZ/Math/SceneNode.hpp"
+#include "RaZ/Math/SpatialIndexSystem.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Raz {
+
+namespace {
+
+constexpr std::size_t ParallelQueryThreshold = 64; ///< Minimal amount of batched queries for them to be made in parallel.
+
+template <typename ShapeT>
+std::vector<std::vector<Entity*>> queryBatch(const AABBTree<Entity*>& tree, const std::vector<ShapeT>& shapes) {
+  std::vector<std::vector<Entity*>> results(shapes.size());
+
+  const auto queryRange = [&tree, &shapes, &results] (std::size_t beginIndex, std::size_t endIndex) {
+    for (std::size_t shapeIndex = beginIndex; shapeIndex < endIndex; ++shapeIndex) {
+      std::vector<Entity*>& entities = results[shapeIndex];
+      tree.query(shapes[shapeIndex], [&entities] (Entity* entity) { entities.emplace_back(entity); });
+    }
+  };
+
+#if defined(RAZ_THREADS_AVAILABLE)
+  if (shapes.size() >= ParallelQueryThreshold) {
+    // Queries never modify the tree, & each one fills its own result; they can thus be freely made from several threads
+    const std::size_t chunkCount = static_cast<std::size_t>(Threading::getSystemThreadCount()) * 4;
+    const std::size_t grainSize  = std::max<std::size_t>(shapes.size() / chunkCount, 1);
+
+    Threading::parallelFor(Threading::IndexRange{ 0, shapes.size() }, grainSize, [&queryRange] (Threading::IndexRange range) {
+      queryRange(range.beginIndex, range.endIndex);
+    });
+
+    return results;
+  }
+#endif
+
+  queryRange(0, shapes.size());
+
+  return results;
+}
+
+} // namespace
+
+SpatialIndexSystem::SpatialIndexSystem(float margin) : m_tree(margin) {
+  m_acceptedComponents.setBit(Component::getId<Mesh>());
+}
+
+std::vector<std::vector<Entity*>> SpatialIndexSystem::query(const std::vector<AABB>& boxes) const {
+  return queryBatch(m_tree, boxes);
+}
+
+std::vector<std::vector<Entity*>> SpatialIndexSystem::query(const std::vector<Sphere>& spheres) const {
+  return queryBatch(m_tree, spheres);
+}
+
+std::vector<std::vector<Entity*>> SpatialIndexSystem::query(const std::vector<Frustum>& frustums) const {
+  return queryBatch(m_tree, frustums);
+}
+
+std::vector<std::vector<Entity*>> SpatialIndexSystem::query(const std::vector<Ray>& rays) const {
+  return queryBatch(m_tree, rays);
+}
+
+std::vector<std::pair<Entity*, float>> SpatialIndexSystem::raycast(const Ray& ray, float maxDistance) const {
+  std::vector<std::pair<Entity*, float>> hits;
+  m_tree.raycast(ray, maxDistance, [&hits] (Entity* entity, float distance) { hits.emplace_back(entity, distance); });
+
+  std::sort(hits.begin(), hits.end(), [] (const auto& hit1, const auto& hit2) { return hit1.second < hit2.second; });
+
+  return hits;
+}
+
+void SpatialIndexSystem::linkEntity(Entity& entity) {
+  if (containsEntity(entity))
+    return;
+
+  System::linkEntity(entity);
+
+  if (entity.getId() >= m_entries.size())
+    m_entries.resize(entity.getId() + 1);
+
+  EntityEntry& entry = m_entries[entity.getId()];
+  entry.proxyId = m_tree.insert(computeWorldBox(entity, entry), &entity);
+}
+
+void SpatialIndexSystem::unlinkEntity(Entity& entity) {
+  if (!containsEntity(entity))
+    return;
+
+  System::unlinkEntity(entity);
+
+  EntityEntry& entry = m_entries[entity.getId()];
+  m_tree.remove(entry.proxyId);
+  entry = EntityEntry{};
+}
+
+bool SpatialIndexSystem::update(float) {
+  const std::uint64_t lastUpdateVersion = getLastUpdateVersion();
+
+  for (const Entity* entity : m_entities) {
+    EntityEntry& entry = m_entries[entity->getId()];
+
+    const bool hasTransform = entity->hasComponent<Transform>();
+    const bool hasSceneNode = entity->hasComponent<SceneNode>();
+
+    const bool isBoxUpdated = (hasTransform != entry.hasTransform || hasSceneNode != entry.hasSceneNode
+                            || entity->getComponent<Mesh>().hasChangedSince(lastUpdateVersion)
+                            || (hasTransform && entity->getComponent<Transform>().hasChangedSince(lastUpdateVersion))
+                            || (hasSceneNode && entity->getComponent<SceneNode>().hasChangedSince(lastUpdateVersion)));
+
+    if (isBoxUpdated)
+      m_tree.update(entry.proxyId, computeWorldBox(*entity, entry));
+  }
+
+  return true;
+}
+
+AABB SpatialIndexSystem::computeWorldBox(const Entity& entity, EntityEntry& entry) {
+  entry.hasTransform = entity.hasComponent<Transform>();
+  entry.hasSceneNode = entity.hasComponent<SceneNode>();
+
+  const AABB& localBox = entity.getComponent<Mesh>().getBoundingBox();
+
+  if (!entry.hasTransform && !entry.hasSceneNode)
+    return localBox;
+
+  const Mat4f worldMatrix = (entry.hasSceneNode ? entity.getComponent<SceneNode>().getWorldMatrix()
+                                                : entity.getComponent<Transform>().computeTransformMatrix());
+
+  const Vec3f localCenter = (localBox.getLeftBottomBackPos() + localBox.getRightTopFrontPos()) * 0.5f;
+  const Vec3f localExtent = (localBox.getRightTopFrontPos() - localBox.getLeftBottomBackPos()) * 0.5f;
+
+  // Points being row vectors, the transformed center is the point multiplied by the matrix; the transformed box's half extent on each
+  //  axis is the sum of the local extents projected onto it, which is given by the absolute values of the matrix's upper 3x3 part
+  const Vec4f worldCenter = Vec4f(localCenter, 1.f) * worldMatrix;
+  Vec3f worldExtent;
+
+  for (std::size_t columnIndex = 0; columnIndex < 3; ++columnIndex) {
+    for (std::size_t rowIndex = 0; rowIndex < 3; ++rowIndex)
+      worldExtent[columnIndex] += std::abs(worldMatrix[rowIndex * 4 + columnIndex]) * localExtent[rowIndex];
+  }
+
+  const Vec3f center(worldCenter[0], worldCenter[1], worldCenter[2]);
+  return AABB(center - worldExtent, center + worldExtent);
+}
+
+} // namespace Raz
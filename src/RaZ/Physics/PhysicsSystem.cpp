@@ -6,22 +6,38 @@ namespace Raz {
 
 PhysicsSystem::PhysicsSystem() {
   m_acceptedComponents.setBit(Component::getId<RigidBody>());
+
+  registerWrittenComponents<Transform, RigidBody>();
+  requireFixedStep();
+}
+
+void PhysicsSystem::linkComponentRegistry(ComponentRegistry& registry) {
+  System::linkComponentRegistry(registry);
+  m_bodies = &registry.query<Transform, RigidBody>();
 }
 
 bool PhysicsSystem::update(float deltaTime) {
-  for (Entity* entity : m_entities) {
-    if (entity->isEnabled()) {
-      auto& rigidBody = entity->getComponent<RigidBody>();
-      rigidBody.applyForces(m_gravity);
+  const auto simulateBody = [this, deltaTime] (Transform& transform, RigidBody& rigidBody) {
+    rigidBody.applyForces(m_gravity);
 
-      const Vec3f acceleration = rigidBody.getForces() * rigidBody.getInvMass();
-      const Vec3f oldVelocity  = rigidBody.getVelocity();
+    const Vec3f acceleration = rigidBody.getForces() * rigidBody.getInvMass();
+    const Vec3f oldVelocity  = rigidBody.getVelocity();
 
-      const Vec3f velocity = oldVelocity * m_friction + acceleration * deltaTime;
-      rigidBody.setVelocity(velocity);
+    const Vec3f velocity = oldVelocity * m_friction + acceleration * deltaTime;
+    rigidBody.setVelocity(velocity);
 
-      entity->getComponent<Transform>().translate((oldVelocity + velocity) * 0.5f * deltaTime);
-    }
+    transform.translate((oldVelocity + velocity) * 0.5f * deltaTime);
+  };
+
+  if (m_bodies) {
+    m_bodies->forEach(simulateBody);
+    return true;
+  }
+
+  // Without any World, no query is available; the linked entities are checked one by one instead
+  for (Entity* entity : m_entities) {
+    if (entity->isEnabled())
+      simulateBody(entity->getMutableComponent<Transform>(), entity->getMutableComponent<RigidBody>());
   }
 
   return true;
@@ -0,0 +1,14 @@
+#include "RaZ/Prefab.hpp"
+
+#include <cassert>
+
+namespace Raz {
+
+std::vector<ComponentPtr> Prefab::copyComponent(std::size_t compId, ComponentRegistry& registry, std::size_t count) const {
+  assert("Error: The prefab doesn't hold the component to be copied." && compId < m_signature.getSize() && m_signature[compId]);
+
+  const ComponentTemplate& compTemplate = m_components[compId];
+  return compTemplate.copy(*compTemplate.prototype, registry, count);
+}
+
+} // namespace Raz
@@ -0,0 +1,28 @@
+#include "RaZ/Query.hpp"
+
+namespace Raz {
+
+std::size_t BaseQuery::computeEntityCount() const noexcept {
+  std::size_t entityCount = 0;
+
+  for (const Archetype* archetype : m_archetypes)
+    entityCount += archetype->getEntityCount();
+
+  return entityCount;
+}
+
+bool BaseQuery::matches(const Archetype& archetype) const noexcept {
+  for (std::size_t compId : m_componentIds) {
+    if (!archetype.hasComponent(compId))
+      return false;
+  }
+
+  return !m_excludedComponents.intersects(archetype.getSignature());
+}
+
+void BaseQuery::addArchetype(const Archetype& archetype) {
+  if (matches(archetype))
+    m_archetypes.emplace_back(&archetype);
+}
+
+} // namespace Raz
@@ -134,7 +134,7 @@ void Cubemap::unbind() const {
   Renderer::unbindTexture(TextureType::CUBEMAP);
 }
 
-void Cubemap::draw(const Camera& camera) const {
+void Cubemap::draw(const Mat4f& viewMat, const Mat4f& projMat) const {
   Renderer::setDepthFunction(DepthFunction::LESS_EQUAL);
   Renderer::setFaceCulling(FaceOrientation::FRONT);
 
@@ -144,7 +144,7 @@ void Cubemap::draw(const Camera& camera) const {
   bind();
 
   m_viewProjUbo.bind();
-  sendViewProjectionMatrix(Mat4f(Mat3f(camera.getViewMatrix())) * camera.getProjectionMatrix());
+  sendViewProjectionMatrix(Mat4f(Mat3f(viewMat)) * projMat);
 
   Mesh::drawUnitCube();
 
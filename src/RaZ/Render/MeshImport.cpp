@@ -1,5 +1,6 @@
 #include "RaZ/Render/Mesh.hpp"
 #include "RaZ/Utils/FileUtils.hpp"
+#include "RaZ/Utils/Profiler.hpp"
 #include "RaZ/Utils/StrUtils.hpp"
 
 #include <fstream>
@@ -7,6 +8,8 @@
 namespace Raz {
 
 void Mesh::import(const std::string& filePath) {
+  RAZ_PROFILE_ZONE("Mesh::import");
+
   // Resetting the mesh to an empty state before importing
   m_submeshes.clear();
   m_submeshes.resize(1);
@@ -1,4 +1,5 @@
 #include "RaZ/Render/Mesh.hpp"
+#include "RaZ/Utils/Profiler.hpp"
 
 namespace Raz {
 
@@ -76,6 +77,8 @@ void Mesh::setMaterial(MaterialPreset materialPreset, float roughnessFactor) {
 }
 
 void Mesh::load() const {
+  RAZ_PROFILE_ZONE("Mesh::load");
+
   for (const Submesh& submesh : m_submeshes)
     submesh.load();
 }
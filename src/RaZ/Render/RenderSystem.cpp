@@ -1,9 +1,13 @@
+#include "RaZ/Math/SceneNode.hpp"
 #include "RaZ/Math/Transform.hpp"
 #include "RaZ/Render/Camera.hpp"
 #include "RaZ/Render/Light.hpp"
 #include "RaZ/Render/Mesh.hpp"
 #include "RaZ/Render/Renderer.hpp"
 #include "RaZ/Render/RenderSystem.hpp"
+#include "RaZ/Utils/Profiler.hpp"
+
+#include <algorithm>
 
 namespace Raz {
 
@@ -49,19 +53,89 @@ void RenderSystem::enableSSRPass(FragmentShader fragShader) {
   m_renderPasses[static_cast<std::size_t>(RenderPassType::SSR)] = std::make_unique<SSRPass>(m_sceneWidth, m_sceneHeight, std::move(fragShader));
 }
 
-void RenderSystem::linkEntity(const EntityPtr& entity) {
+void RenderSystem::enablePipelining(bool enabled) {
+  if (enabled == m_isPipelined)
+    return;
+
+  m_isPipelined = enabled;
+
+  // Once pipelined, the updates don't make any graphics API call anymore, & can thus be made from any thread
+  m_isMainThreadRequired = !enabled;
+
+  for (RenderState& state : m_renderStates)
+    state.clear();
+
+  m_hasReadyState = false;
+  m_sentLights.clear();
+  m_removedMeshes.clear();
+
+  if (!enabled) {
+    // The lights have been sent from the states until now, & may not match the entities' anymore
+    updateLights();
+    sendCameraMatrices();
+  }
+}
+
+void RenderSystem::linkComponentRegistry(ComponentRegistry& registry) {
+  System::linkComponentRegistry(registry);
+  m_meshes     = &registry.query<const Transform, const Mesh>(exclude<SceneNode>);
+  m_nodeMeshes = &registry.query<const SceneNode, const Mesh>();
+}
+
+void RenderSystem::linkEntity(Entity& entity) {
   System::linkEntity(entity);
 
-  if (entity->hasComponent<Mesh>())
-    entity->getComponent<Mesh>().load(m_renderPasses.front()->getProgram());
+  if (recordEntityMesh(entity))
+    entity.getComponent<Mesh>().load(m_renderPasses.front()->getProgram());
+
+  // When pipelined, the lights are sent along with each drawn state
+  if (entity.hasComponent<Light>() && !m_isPipelined)
+    updateLights();
+}
+
+void RenderSystem::unlinkEntity(Entity& entity) {
+  if (!containsEntity(entity))
+    return;
+
+  System::unlinkEntity(entity);
+
+  // The entity's mesh may already be or be about to be destroyed, while the states extracted beforehand still reference it
+  const Mesh*& entityMesh = m_entityMeshes[entity.getId()];
+
+  if (entityMesh && m_isPipelined)
+    m_removedMeshes.emplace_back(entityMesh);
+
+  entityMesh = nullptr;
+  m_modelMatrices[entity.getId()].isRecorded = false;
+}
+
+void RenderSystem::relinkEntity(Entity& entity) {
+  // The entity may have gained or lost a mesh while holding a light
+  if (recordEntityMesh(entity))
+    entity.getComponent<Mesh>().load(m_renderPasses.front()->getProgram());
 
-  if (entity->hasComponent<Light>())
+  if (entity.hasComponent<Light>() && !m_isPipelined)
     updateLights();
 }
 
 bool RenderSystem::update(float deltaTime) {
   assert("Error: Geometry pass must be enabled for the RenderSystem to be updated." && m_renderPasses.front());
 
+  if (m_isPipelined) {
+    RAZ_PROFILE_ZONE("Render state extraction");
+
+    extractRenderState(m_renderStates[m_extractedStateIndex]);
+
+    {
+      // The freshly extracted state becomes the one to be drawn next, replacing any state that the rendering didn't pick up in time
+      std::lock_guard<std::mutex> lock(m_stateMutex);
+      std::swap(m_extractedStateIndex, m_readyStateIndex);
+      m_hasReadyState = true;
+    }
+
+    return !(m_window && m_window->shouldClose());
+  }
+
   m_renderPasses.front()->getProgram().use();
 
   auto& camera       = m_cameraEntity.getComponent<Camera>();
@@ -89,23 +163,39 @@ bool RenderSystem::update(float deltaTime) {
     viewProjMat = camera.getViewMatrix() * camera.getProjectionMatrix();
   }
 
-  for (auto& entity : m_entities) {
-    if (entity->isEnabled()) {
-      if (entity->hasComponent<Mesh>() && entity->hasComponent<Transform>()) {
-        const Mat4f modelMat = entity->getComponent<Transform>().computeTransformMatrix();
+  {
+    RAZ_PROFILE_ZONE("Geometry pass");
+
+    const ShaderProgram& geometryProgram = m_renderPasses.front()->getProgram();
+
+    if (m_meshes) {
+      m_meshes->forEach([this, &geometryProgram, &viewProjMat] (const Entity& entity, const Transform& transform, const Mesh& mesh) {
+        const Mat4f modelMat = interpolateModelMatrix(entity.getId(), transform.computeTransformMatrix());
 
-        const ShaderProgram& geometryProgram = m_renderPasses.front()->getProgram();
+        geometryProgram.sendUniform("uniModelMatrix", modelMat);
+        geometryProgram.sendUniform("uniMvpMatrix", modelMat * viewProjMat);
+
+        mesh.draw(geometryProgram);
+      });
+    }
+
+    if (m_nodeMeshes) {
+      // The world matrices of the nodes are computed beforehand by the SceneGraphSystem
+      m_nodeMeshes->forEach([this, &geometryProgram, &viewProjMat] (const Entity& entity, const SceneNode& node, const Mesh& mesh) {
+        const Mat4f modelMat = interpolateModelMatrix(entity.getId(), node.getWorldMatrix());
 
         geometryProgram.sendUniform("uniModelMatrix", modelMat);
         geometryProgram.sendUniform("uniMvpMatrix", modelMat * viewProjMat);
 
-        entity->getComponent<Mesh>().draw(geometryProgram);
-      }
+        mesh.draw(geometryProgram);
+      });
     }
   }
 
-  if (m_cubemap)
+  if (m_cubemap) {
+    RAZ_PROFILE_ZONE("Cubemap pass");
     m_cubemap->draw(camera);
+  }
 
 #if defined(RAZ_CONFIG_DEBUG)
   Renderer::printErrors();
@@ -117,6 +207,83 @@ bool RenderSystem::update(float deltaTime) {
   return true;
 }
 
+bool RenderSystem::render() {
+  assert("Error: The RenderSystem must be pipelined to be rendered separately." && m_isPipelined);
+  assert("Error: Geometry pass must be enabled for the RenderSystem to be rendered." && m_renderPasses.front());
+
+  {
+    std::lock_guard<std::mutex> lock(m_stateMutex);
+
+    // The states may have been extracted before the latest structural changes; the meshes destroyed since must not be drawn
+    purgeRemovedMeshes();
+
+    if (m_hasReadyState) {
+      std::swap(m_renderedStateIndex, m_readyStateIndex);
+      m_hasReadyState = false;
+    }
+  }
+
+  RenderState& state = m_renderStates[m_renderedStateIndex];
+
+  const ShaderProgram& geometryProgram = m_renderPasses.front()->getProgram();
+  geometryProgram.use();
+
+  const Mat4f viewProjMat = state.viewMatrix * state.projectionMatrix;
+
+  m_cameraUbo.bind();
+  sendViewMatrix(state.viewMatrix);
+  sendInverseViewMatrix(state.inverseViewMatrix);
+  sendProjectionMatrix(state.projectionMatrix);
+  sendInverseProjectionMatrix(state.inverseProjectionMatrix);
+  sendViewProjectionMatrix(viewProjMat);
+  sendCameraPosition(state.cameraPosition);
+
+  if (state.lights != m_sentLights) {
+    for (std::size_t lightIndex = 0; lightIndex < state.lights.size(); ++lightIndex) {
+      const RenderState::LightInstance& light = state.lights[lightIndex];
+      const std::string strBase = "uniLights[" + std::to_string(lightIndex) + "].";
+
+      if (light.homogeneousPosition[3] == 0.f)
+        geometryProgram.sendUniform(strBase + "direction", light.direction);
+
+      geometryProgram.sendUniform(strBase + "position", light.homogeneousPosition);
+      geometryProgram.sendUniform(strBase + "color",    light.color);
+      geometryProgram.sendUniform(strBase + "energy",   light.energy);
+      geometryProgram.sendUniform(strBase + "angle",    light.angle);
+    }
+
+    geometryProgram.sendUniform("uniLightCount", static_cast<unsigned int>(state.lights.size()));
+    m_sentLights = state.lights;
+  }
+
+  {
+    RAZ_PROFILE_ZONE("Geometry pass");
+
+    for (const RenderState::MeshInstance& instance : state.meshes) {
+      geometryProgram.sendUniform("uniModelMatrix", instance.modelMatrix);
+      geometryProgram.sendUniform("uniMvpMatrix", instance.modelMatrix * viewProjMat);
+
+      instance.mesh->draw(geometryProgram);
+    }
+  }
+
+  if (m_cubemap) {
+    RAZ_PROFILE_ZONE("Cubemap pass");
+    m_cubemap->draw(state.viewMatrix, state.projectionMatrix);
+  }
+
+#if defined(RAZ_CONFIG_DEBUG)
+  Renderer::printErrors();
+#endif
+
+  if (m_window) {
+    m_window->display();
+    return !m_window->shouldClose();
+  }
+
+  return true;
+}
+
 void RenderSystem::sendCameraMatrices(const Mat4f& viewProjMat) const {
   const auto& camera = m_cameraEntity.getComponent<Camera>();
 
@@ -231,6 +398,10 @@ void RenderSystem::initialize() {
   m_acceptedComponents.setBit(Component::getId<Mesh>());
   m_acceptedComponents.setBit(Component::getId<Light>());
 
+  registerReadComponents<Transform, SceneNode, Mesh, Light>();
+  registerRenderedComponents<Mesh>(); // The extracted states reference the meshes, which are drawn on the main thread once pipelined
+  requireMainThread(); // Rendering requires the graphics context, which is bound to the main thread
+
   m_cameraUbo.bindBufferBase(0);
 
   for (std::size_t passIndex = 1; passIndex < m_renderPasses.size(); ++passIndex) {
@@ -247,6 +418,130 @@ void RenderSystem::initialize() {
   sendCameraMatrices();
 }
 
+void RenderSystem::extractRenderState(RenderState& state) {
+  state.clear();
+
+  auto& camera       = m_cameraEntity.getComponent<Camera>();
+  auto& camTransform = m_cameraEntity.getComponent<Transform>();
+
+  if (camTransform.hasUpdated()) {
+    if (camera.getCameraType() == CameraType::LOOK_AT) {
+      camera.computeLookAt(camTransform.getPosition());
+    } else {
+      camera.computeViewMatrix(camTransform.computeTranslationMatrix(true),
+                               camTransform.getRotation().inverse());
+    }
+
+    camera.computeInverseViewMatrix();
+    camTransform.setUpdated(false);
+  }
+
+  state.viewMatrix              = camera.getViewMatrix();
+  state.inverseViewMatrix       = camera.getInverseViewMatrix();
+  state.projectionMatrix        = camera.getProjectionMatrix();
+  state.inverseProjectionMatrix = camera.getInverseProjectionMatrix();
+  state.cameraPosition          = camTransform.getPosition();
+
+  if (m_meshes) {
+    m_meshes->forEach([this, &state] (const Entity& entity, const Transform& transform, const Mesh& mesh) {
+      state.meshes.push_back(RenderState::MeshInstance{ &mesh, interpolateModelMatrix(entity.getId(), transform.computeTransformMatrix()) });
+    });
+  }
+
+  if (m_nodeMeshes) {
+    m_nodeMeshes->forEach([this, &state] (const Entity& entity, const SceneNode& node, const Mesh& mesh) {
+      state.meshes.push_back(RenderState::MeshInstance{ &mesh, interpolateModelMatrix(entity.getId(), node.getWorldMatrix()) });
+    });
+  }
+
+  for (const Entity* entity : m_entities) {
+    if (!entity->hasComponent<Light>())
+      continue;
+
+    const auto& lightComp = entity->getComponent<Light>();
+
+    RenderState::LightInstance& light = state.lights.emplace_back();
+    light.homogeneousPosition = Vec4f(entity->getComponent<Transform>().getPosition(), 1.f);
+    light.color               = lightComp.getColor();
+    light.energy              = lightComp.getEnergy();
+    light.angle               = lightComp.getAngle();
+
+    if (lightComp.getType() == LightType::DIRECTIONAL) {
+      light.homogeneousPosition[3] = 0.f;
+      light.direction              = lightComp.getDirection();
+    }
+  }
+}
+
+bool RenderSystem::recordEntityMesh(const Entity& entity) {
+  if (entity.getId() >= m_entityMeshes.size()) {
+    m_entityMeshes.resize(entity.getId() + 1);
+    m_modelMatrices.resize(entity.getId() + 1);
+  }
+
+  const Mesh* mesh        = (entity.hasComponent<Mesh>() ? &entity.getComponent<Mesh>() : nullptr);
+  const Mesh*& entityMesh = m_entityMeshes[entity.getId()];
+
+  if (mesh == entityMesh)
+    return false;
+
+  if (entityMesh && m_isPipelined)
+    m_removedMeshes.emplace_back(entityMesh);
+
+  entityMesh = mesh;
+  m_modelMatrices[entity.getId()].isRecorded = false;
+
+  return (mesh != nullptr);
+}
+
+Mat4f RenderSystem::interpolateModelMatrix(std::size_t entityId, const Mat4f& modelMatrix) {
+  // The queries may give entities which aren't linked, such as disabled ones
+  if (entityId >= m_modelMatrices.size())
+    m_modelMatrices.resize(entityId + 1);
+
+  ModelMatrices& matrices            = m_modelMatrices[entityId];
+  const std::uint64_t fixedStepCount = getFixedStepCount();
+
+  // Without any fixed step, the simulated state is always the one to be drawn
+  if (fixedStepCount == 0) {
+    matrices.isRecorded = false;
+    return modelMatrix;
+  }
+
+  if (matrices.isRecorded && fixedStepCount == matrices.fixedStepCount + 1) {
+    matrices.previous = matrices.current;
+    matrices.current  = modelMatrix;
+  } else if (!matrices.isRecorded || fixedStepCount != matrices.fixedStepCount || modelMatrix != matrices.current) {
+    matrices.previous = modelMatrix;
+    matrices.current  = modelMatrix;
+  }
+
+  matrices.fixedStepCount = fixedStepCount;
+  matrices.isRecorded     = true;
+
+  return matrices.previous + (matrices.current - matrices.previous) * getStepInterpolation();
+}
+
+void RenderSystem::purgeRemovedMeshes() {
+  if (m_removedMeshes.empty())
+    return;
+
+  // The removals are made while no state is being drawn or extracted (see World::refresh()); the states extracted afterward can't
+  //  reference the removed meshes, & only the ready & the rendered states may thus still do so
+  std::sort(m_removedMeshes.begin(), m_removedMeshes.end());
+
+  const auto isRemoved = [this] (const RenderState::MeshInstance& instance) {
+    return std::binary_search(m_removedMeshes.cbegin(), m_removedMeshes.cend(), instance.mesh);
+  };
+
+  for (const std::size_t stateIndex : { m_readyStateIndex, m_renderedStateIndex }) {
+    std::vector<RenderState::MeshInstance>& meshes = m_renderStates[stateIndex].meshes;
+    meshes.erase(std::remove_if(meshes.begin(), meshes.end(), isRemoved), meshes.end());
+  }
+
+  m_removedMeshes.clear();
+}
+
 void RenderSystem::initialize(unsigned int sceneWidth, unsigned int sceneHeight) {
   initialize();
   resizeViewport(sceneWidth, sceneHeight);
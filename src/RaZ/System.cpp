@@ -1,27 +1,87 @@
 #include "RaZ/System.hpp"
 
+#include <cassert>
+#include <limits>
+
 namespace Raz {
 
-bool System::containsEntity(const EntityPtr& entity) {
-  for (const auto& entityPtr : m_entities) {
-    if (entityPtr->getId() == entity->getId())
-      return true;
-  }
+void System::setUpdateInterval(std::size_t updateCount) noexcept {
+  assert("Error: The update interval must not be 0." && updateCount > 0);
+  m_updateInterval = updateCount;
+}
+
+void System::setUpdateFrequency(float frequency) noexcept {
+  assert("Error: The update frequency must not be negative." && frequency >= 0.f);
+  m_updateFrequency = frequency;
+}
+
+void System::setTimeBudget(float budget) noexcept {
+  assert("Error: The time budget must not be negative." && budget >= 0.f);
+  m_timeBudget = budget;
+}
+
+bool System::acceptsEntity(const Entity& entity) const noexcept {
+  return (entity.isEnabled() && m_acceptedComponents.intersects(entity.getEnabledComponents()));
+}
+
+bool System::conflictsWith(const System& system) const noexcept {
+  if (!hasDeclaredAccesses() || !system.hasDeclaredAccesses())
+    return true;
+
+  return (m_writtenComponents.intersects(system.getWrittenComponents())
+       || m_writtenComponents.intersects(system.getReadComponents())
+       || system.getWrittenComponents().intersects(m_readComponents));
+}
+
+bool System::containsEntity(const Entity& entity) const noexcept {
+  // The stored position may be outdated if the entity has been unlinked; it is only valid if it effectively leads to the same entity
+  const std::size_t entityId = entity.getId();
 
-  return false;
+  if (entityId >= m_entityIndices.size())
+    return false;
+
+  const std::size_t entityIndex = m_entityIndices[entityId];
+  return (entityIndex < m_entities.size() && m_entities[entityIndex] == &entity);
+}
+
+void System::linkEntity(Entity& entity) {
+  if (containsEntity(entity))
+    return;
+
+  const std::size_t entityId = entity.getId();
+
+  if (entityId >= m_entityIndices.size())
+    m_entityIndices.resize(entityId + 1);
+
+  m_entityIndices[entityId] = m_entities.size();
+  m_entities.emplace_back(&entity);
 }
 
-void System::linkEntity(const EntityPtr& entity) {
-  m_entities.emplace_back(entity.get());
+void System::unlinkEntity(Entity& entity) {
+  if (!containsEntity(entity))
+    return;
+
+  const std::size_t entityIndex = m_entityIndices[entity.getId()];
+
+  Entity* lastEntity = m_entities.back();
+  m_entityIndices[lastEntity->getId()] = entityIndex;
+  m_entities[entityIndex]              = lastEntity;
+  m_entities.pop_back();
+}
+
+float System::computeRemainingTimeBudget() const noexcept {
+  if (m_timeBudget == 0.f)
+    return std::numeric_limits<float>::infinity();
+
+  const auto elapsedTime = std::chrono::duration_cast<std::chrono::duration<float>>(std::chrono::steady_clock::now() - m_updateStartTime);
+  return m_timeBudget - elapsedTime.count();
 }
 
-void System::unlinkEntity(const EntityPtr& entity) {
-  for (std::size_t entityIndex = 0; entityIndex < m_entities.size(); ++entityIndex) {
-    if (m_entities[entityIndex]->getId() == entity->getId()) {
-      m_entities.erase(m_entities.begin() + static_cast<std::ptrdiff_t>(entityIndex));
-      break;
-    }
-  }
+bool System::accumulateUpdate(float deltaTime) noexcept {
+  ++m_skippedUpdateCount;
+  m_elapsedTime += deltaTime;
+
+  return (m_skippedUpdateCount >= m_updateInterval && (m_updateFrequency == 0.f || m_elapsedTime * m_updateFrequency >= 1.f));
 }
 
 } // namespace Raz
@@ -0,0 +1,169 @@
+#include "RaZ/SystemGraph.hpp"
+#include "RaZ/Utils/Profiler.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <deque>
+#include <exception>
+#include <mutex>
+
+namespace Raz {
+
+struct SystemGraph::UpdateState {
+  float deltaTime {};
+  std::atomic<std::size_t> remainingNodeCount {};
+
+  std::mutex mainThreadMutex {};
+  std::deque<SystemNode*> mainThreadNodes {}; ///< Nodes ready to be updated, whose systems require to be so by the calling thread.
+
+  std::mutex exceptionMutex {};
+  std::exception_ptr exception {};
+};
+
+void SystemGraph::build(const std::vector<SystemPtr>& systems, const Bitset& activeSystems) {
+  m_graph = Graph<SystemNode>(systems.size());
+
+  for (std::size_t systemIndex = 0; systemIndex < systems.size(); ++systemIndex) {
+    if (systems[systemIndex] && systemIndex < activeSystems.getSize() && activeSystems[systemIndex])
+      m_graph.addNode(*systems[systemIndex], systemIndex);
+  }
+
+  const std::vector<std::unique_ptr<SystemNode>>& nodes = m_graph.getNodes();
+
+  // Each system depends on all the previous ones it conflicts with, so that these are always updated in the same order
+  for (std::size_t nodeIndex = 1; nodeIndex < nodes.size(); ++nodeIndex) {
+    SystemNode& node = *nodes[nodeIndex];
+
+    for (std::size_t prevNodeIndex = 0; prevNodeIndex < nodeIndex; ++prevNodeIndex) {
+      SystemNode& prevNode = *nodes[prevNodeIndex];
+
+      if (prevNode.getSystem().conflictsWith(node.getSystem())) {
+        prevNode.addChildren(node);
+        ++node.m_parentCount;
+      }
+    }
+  }
+}
+
+bool SystemGraph::update(float deltaTime, Bitset& activeSystems) {
+  const std::vector<std::unique_ptr<SystemNode>>& nodes = m_graph.getNodes();
+
+  if (nodes.empty())
+    return false;
+
+  UpdateState state;
+  state.deltaTime          = deltaTime;
+  state.remainingNodeCount = nodes.size();
+
+  for (const std::unique_ptr<SystemNode>& node : nodes)
+    node->m_remainingParentCount = node->m_parentCount;
+
+  for (const std::unique_ptr<SystemNode>& node : nodes) {
+    if (node->m_parentCount == 0)
+      scheduleNode(*node, state);
+  }
+
+  // The calling thread updates the systems requiring it as they become ready, & helps the thread pool otherwise
+  while (state.remainingNodeCount > 0) {
+    SystemNode* node = nullptr;
+
+    {
+      std::lock_guard<std::mutex> lock(state.mainThreadMutex);
+
+      if (!state.mainThreadNodes.empty()) {
+        node = state.mainThreadNodes.front();
+        state.mainThreadNodes.pop_front();
+      }
+    }
+
+    if (node) {
+      updateNode(*node, state, true);
+      continue;
+    }
+
+#if defined(RAZ_THREADS_AVAILABLE)
+    if (!Threading::getDefaultThreadPool().runPendingTask())
+      std::this_thread::yield();
+#endif
+  }
+
+  bool hasInactiveSystems = false;
+
+  for (const std::unique_ptr<SystemNode>& node : nodes) {
+    if (!node->m_isActive) {
+      activeSystems.setBit(node->m_systemIndex, false);
+      hasInactiveSystems = true;
+    }
+  }
+
+  if (state.exception)
+    std::rethrow_exception(state.exception);
+
+  return hasInactiveSystems;
+}
+
+void SystemGraph::updateNode(SystemNode& node, UpdateState& state, bool isMainThread) {
+  SystemNode* currentNode = &node;
+
+  while (currentNode) {
+    try {
+      System& system = *currentNode->m_system;
+      currentNode->m_isUpdated = system.accumulateUpdate(state.deltaTime);
+
+      // A skipped system keeps its last update version, so that it still gets all the components modified since then on its next update
+      if (currentNode->m_isUpdated) {
+        const float elapsedTime = system.m_elapsedTime;
+        system.m_skippedUpdateCount = 0;
+        system.m_elapsedTime        = 0.f;
+        system.m_updateStartTime    = std::chrono::steady_clock::now();
+
+        {
+          RAZ_PROFILE_ZONE(system.getTypeName());
+          currentNode->m_isActive = system.update(elapsedTime);
+        }
+
+        const auto updateDuration = std::chrono::steady_clock::now() - system.m_updateStartTime;
+        system.m_lastUpdateDuration = std::chrono::duration_cast<std::chrono::duration<float>>(updateDuration).count();
+
+        // The components modified by the next systems are then distinguished from the ones modified until now
+        if (system.m_componentRegistry)
+          system.m_lastUpdateVersion = system.m_componentRegistry->incrementChangeVersion();
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(state.exceptionMutex);
+
+      if (!state.exception)
+        state.exception = std::current_exception();
+    }
+
+    SystemNode* nextNode = nullptr;
+
+    for (SystemNode* child : currentNode->getChildren()) {
+      if (--child->m_remainingParentCount != 0)
+        continue;
+
+      if (nextNode == nullptr && (isMainThread || !child->m_system->isMainThreadRequired()))
+        nextNode = child;
+      else
+        scheduleNode(*child, state);
+    }
+
+    currentNode = nextNode;
+
+    // Once the last node is marked as updated, the state may be destroyed at any moment & must not be accessed anymore
+    --state.remainingNodeCount;
+  }
+}
+
+void SystemGraph::scheduleNode(SystemNode& node, UpdateState& state) {
+#if defined(RAZ_THREADS_AVAILABLE)
+  if (!node.m_system->isMainThreadRequired()) {
+    Threading::getDefaultThreadPool().addTask([&node, &state] () { updateNode(node, state, false); });
+    return;
+  }
+#endif
+
+  std::lock_guard<std::mutex> lock(state.mainThreadMutex);
+  state.mainThreadNodes.emplace_back(&node);
+}
+
+} // namespace Raz
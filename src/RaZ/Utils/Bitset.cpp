@@ -4,52 +4,206 @@
 
 namespace Raz {
 
-bool Bitset::isEmpty() const {
-  for (bool bit : m_bits) {
-    if (bit)
+Bitset::Bitset(std::size_t bitCount, bool initVal) : m_bitCount{ bitCount } {
+  const std::size_t wordCount = getWordCount();
+  reserveWords(wordCount);
+
+  if (!initVal)
+    return;
+
+  std::fill_n(getMutableWords(), wordCount, ~WordType(0));
+  clearTrailingBits();
+}
+
+Bitset::Bitset(std::initializer_list<bool> values) : m_bitCount{ values.size() } {
+  reserveWords(getWordCount());
+
+  WordType* words = getMutableWords();
+  std::size_t bitIndex = 0;
+
+  for (bool value : values) {
+    if (value)
+      words[bitIndex / WordBitCount] |= WordType(1) << (bitIndex % WordBitCount);
+
+    ++bitIndex;
+  }
+}
+
+bool Bitset::isEmpty() const noexcept {
+  const WordType* words = getWords();
+  return std::all_of(words, words + getWordCount(), [] (WordType word) { return word == 0; });
+}
+
+std::size_t Bitset::getEnabledBitCount() const noexcept {
+  const WordType* words       = getWords();
+  const std::size_t wordCount = getWordCount();
+
+  std::size_t count = 0;
+
+  for (std::size_t wordIndex = 0; wordIndex < wordCount; ++wordIndex)
+    count += countEnabledBits(words[wordIndex]);
+
+  return count;
+}
+
+std::size_t Bitset::findNextEnabledBit(std::size_t startPos) const noexcept {
+  if (startPos >= m_bitCount)
+    return m_bitCount;
+
+  const WordType* words       = getWords();
+  const std::size_t wordCount = getWordCount();
+
+  std::size_t wordIndex = startPos / WordBitCount;
+  WordType word         = words[wordIndex] & (~WordType(0) << (startPos % WordBitCount)); // Ignoring the bits before the start position
+
+  while (word == 0) {
+    if (++wordIndex == wordCount)
+      return m_bitCount;
+
+    word = words[wordIndex];
+  }
+
+  return wordIndex * WordBitCount + countTrailingZeros(word);
+}
+
+std::size_t Bitset::findLastEnabledBit() const noexcept {
+  const WordType* words = getWords();
+
+  for (std::size_t wordIndex = getWordCount(); wordIndex > 0; --wordIndex) {
+    const WordType word = words[wordIndex - 1];
+
+    if (word != 0)
+      return wordIndex * WordBitCount - 1 - countLeadingZeros(word);
+  }
+
+  return m_bitCount;
+}
+
+bool Bitset::intersects(const Bitset& bitset) const noexcept {
+  const WordType* words       = getWords();
+  const WordType* otherWords  = bitset.getWords();
+  const std::size_t wordCount = std::min(getWordCount(), bitset.getWordCount());
+
+  for (std::size_t wordIndex = 0; wordIndex < wordCount; ++wordIndex) {
+    if ((words[wordIndex] & otherWords[wordIndex]) != 0)
+      return true;
+  }
+
+  return false;
+}
+
+bool Bitset::isSubsetOf(const Bitset& bitset) const noexcept {
+  const WordType* words            = getWords();
+  const WordType* otherWords       = bitset.getWords();
+  const std::size_t wordCount      = getWordCount();
+  const std::size_t otherWordCount = bitset.getWordCount();
+
+  for (std::size_t wordIndex = 0; wordIndex < wordCount; ++wordIndex) {
+    const WordType otherWord = (wordIndex < otherWordCount ? otherWords[wordIndex] : 0);
+
+    if ((words[wordIndex] & ~otherWord) != 0)
       return false;
   }
 
   return true;
 }
 
+std::size_t Bitset::hash(std::size_t seed) const noexcept {
+  // Bits beyond the size being always disabled, equal bitsets have equal words
+  seed ^= std::hash<std::size_t>()(m_bitCount) + 0x9e3779b9 + (seed << 6u) + (seed >> 2u);
+
+  const WordType* words = getWords();
+  for (std::size_t wordIndex = 0; wordIndex < getWordCount(); ++wordIndex)
+    seed ^= std::hash<WordType>()(words[wordIndex]) + 0x9e3779b9 + (seed << 6u) + (seed >> 2u);
+
+  return seed;
+}
+
 void Bitset::setBit(std::size_t position, bool value) {
-  if (position >= m_bits.size())
-    m_bits.resize(position + 1);
+  if (position >= m_bitCount)
+    resize(position + 1);
+
+  const WordType mask = WordType(1) << (position % WordBitCount);
+  WordType& word      = getMutableWords()[position / WordBitCount];
+
+  if (value)
+    word |= mask;
+  else
+    word &= ~mask;
+}
+
+void Bitset::resize(std::size_t newSize) {
+  const std::size_t wordCount    = getWordCount();
+  const std::size_t newWordCount = computeWordCount(newSize);
+
+  if (newSize > m_bitCount) {
+    // Bits beyond the current size are always disabled, so that nothing has to be done but to make room for the new ones
+    reserveWords(newWordCount);
+    m_bitCount = newSize;
+    return;
+  }
+
+  std::fill(getMutableWords() + newWordCount, getMutableWords() + wordCount, 0);
+  m_bitCount = newSize;
+  clearTrailingBits();
+}
 
-  m_bits[position] = value;
+void Bitset::reset() noexcept {
+  std::fill_n(getMutableWords(), getWordCount(), 0);
 }
 
 Bitset Bitset::operator~() const {
-  Bitset res = *this;
+  Bitset res(m_bitCount);
 
-  for (auto bit : res.getBits())
-    bit = !bit;
+  const WordType* words = getWords();
+  WordType* resWords    = res.getMutableWords();
 
+  for (std::size_t wordIndex = 0; wordIndex < getWordCount(); ++wordIndex)
+    resWords[wordIndex] = ~words[wordIndex];
+
+  res.clearTrailingBits();
   return res;
 }
 
 Bitset Bitset::operator&(const Bitset& bitset) const {
-  Bitset res(std::min(m_bits.size(), bitset.getSize()));
-  std::copy(m_bits.cbegin(), m_bits.cbegin() + res.getSize(), res.getBits().begin());
+  Bitset res(std::min(m_bitCount, bitset.getSize()));
+
+  const WordType* words      = getWords();
+  const WordType* otherWords = bitset.getWords();
+  WordType* resWords         = res.getMutableWords();
 
-  res &= bitset;
+  for (std::size_t wordIndex = 0; wordIndex < res.getWordCount(); ++wordIndex)
+    resWords[wordIndex] = words[wordIndex] & otherWords[wordIndex];
+
+  res.clearTrailingBits();
   return res;
 }
 
 Bitset Bitset::operator|(const Bitset& bitset) const {
-  Bitset res(std::min(m_bits.size(), bitset.getSize()));
-  std::copy(m_bits.cbegin(), m_bits.cbegin() + res.getSize(), res.getBits().begin());
+  Bitset res(std::min(m_bitCount, bitset.getSize()));
+
+  const WordType* words      = getWords();
+  const WordType* otherWords = bitset.getWords();
+  WordType* resWords         = res.getMutableWords();
+
+  for (std::size_t wordIndex = 0; wordIndex < res.getWordCount(); ++wordIndex)
+    resWords[wordIndex] = words[wordIndex] | otherWords[wordIndex];
 
-  res |= bitset;
+  res.clearTrailingBits();
   return res;
 }
 
 Bitset Bitset::operator^(const Bitset& bitset) const {
-  Bitset res(std::min(m_bits.size(), bitset.getSize()));
-  std::copy(m_bits.cbegin(), m_bits.cbegin() + res.getSize(), res.getBits().begin());
+  Bitset res(std::min(m_bitCount, bitset.getSize()));
 
-  res ^= bitset;
+  const WordType* words      = getWords();
+  const WordType* otherWords = bitset.getWords();
+  WordType* resWords         = res.getMutableWords();
+
+  for (std::size_t wordIndex = 0; wordIndex < res.getWordCount(); ++wordIndex)
+    resWords[wordIndex] = words[wordIndex] ^ otherWords[wordIndex];
+
+  res.clearTrailingBits();
   return res;
 }
 
@@ -65,31 +219,115 @@ Bitset Bitset::operator>>(std::size_t shift) const {
   return res;
 }
 
-Bitset& Bitset::operator&=(const Bitset& bitset) {
-  for (std::size_t bitIndex = 0; bitIndex < std::min(m_bits.size(), bitset.getSize()); ++bitIndex)
-    m_bits[bitIndex] = m_bits[bitIndex] & bitset[bitIndex];
+// The in-place operations only affect the bits common to both bitsets; the last common word may be partial, in which case its
+//  remaining bits must be left untouched
+
+Bitset& Bitset::operator&=(const Bitset& bitset) noexcept {
+  const std::size_t commonBitCount = std::min(m_bitCount, bitset.getSize());
+  const std::size_t fullWordCount  = commonBitCount / WordBitCount;
+  const std::size_t remainingBits  = commonBitCount % WordBitCount;
+
+  WordType* words            = getMutableWords();
+  const WordType* otherWords = bitset.getWords();
+
+  for (std::size_t wordIndex = 0; wordIndex < fullWordCount; ++wordIndex)
+    words[wordIndex] &= otherWords[wordIndex];
+
+  if (remainingBits > 0)
+    words[fullWordCount] &= otherWords[fullWordCount] | (~WordType(0) << remainingBits);
+
   return *this;
 }
 
-Bitset& Bitset::operator|=(const Bitset& bitset) {
-  for (std::size_t bitIndex = 0; bitIndex < std::min(m_bits.size(), bitset.getSize()); ++bitIndex)
-    m_bits[bitIndex] = m_bits[bitIndex] | bitset[bitIndex];
+Bitset& Bitset::operator|=(const Bitset& bitset) noexcept {
+  const std::size_t commonBitCount = std::min(m_bitCount, bitset.getSize());
+  const std::size_t fullWordCount  = commonBitCount / WordBitCount;
+  const std::size_t remainingBits  = commonBitCount % WordBitCount;
+
+  WordType* words            = getMutableWords();
+  const WordType* otherWords = bitset.getWords();
+
+  for (std::size_t wordIndex = 0; wordIndex < fullWordCount; ++wordIndex)
+    words[wordIndex] |= otherWords[wordIndex];
+
+  if (remainingBits > 0)
+    words[fullWordCount] |= otherWords[fullWordCount] & ~(~WordType(0) << remainingBits);
+
   return *this;
 }
 
-Bitset& Bitset::operator^=(const Bitset& bitset) {
-  for (std::size_t bitIndex = 0; bitIndex < std::min(m_bits.size(), bitset.getSize()); ++bitIndex)
-    m_bits[bitIndex] = m_bits[bitIndex] ^ bitset[bitIndex];
+Bitset& Bitset::operator^=(const Bitset& bitset) noexcept {
+  const std::size_t commonBitCount = std::min(m_bitCount, bitset.getSize());
+  const std::size_t fullWordCount  = commonBitCount / WordBitCount;
+  const std::size_t remainingBits  = commonBitCount % WordBitCount;
+
+  WordType* words            = getMutableWords();
+  const WordType* otherWords = bitset.getWords();
+
+  for (std::size_t wordIndex = 0; wordIndex < fullWordCount; ++wordIndex)
+    words[wordIndex] ^= otherWords[wordIndex];
+
+  if (remainingBits > 0)
+    words[fullWordCount] ^= otherWords[fullWordCount] & ~(~WordType(0) << remainingBits);
+
   return *this;
 }
 
 Bitset& Bitset::operator<<=(std::size_t shift) {
-  m_bits.resize(m_bits.size() + shift);
+  resize(m_bitCount + shift);
   return *this;
 }
 
 Bitset& Bitset::operator>>=(std::size_t shift) {
-  m_bits.resize(m_bits.size() - shift);
+  resize(m_bitCount - std::min(shift, m_bitCount));
+  return *this;
+}
+
+bool Bitset::operator==(const Bitset& bitset) const noexcept {
+  return (m_bitCount == bitset.getSize() && std::equal(getWords(), getWords() + getWordCount(), bitset.getWords()));
+}
+
+Bitset& Bitset::operator=(const Bitset& bitset) {
+  if (this == &bitset)
+    return *this;
+
+  const std::size_t wordCount      = getWordCount();
+  const std::size_t otherWordCount = bitset.getWordCount();
+
+  reserveWords(otherWordCount);
+
+  WordType* words = getMutableWords();
+  std::copy_n(bitset.getWords(), otherWordCount, words);
+
+  if (wordCount > otherWordCount)
+    std::fill(words + otherWordCount, words + wordCount, 0);
+
+  m_bitCount = bitset.getSize();
+
+  return *this;
+}
+
+Bitset& Bitset::operator=(Bitset&& bitset) noexcept {
+  if (this == &bitset)
+    return *this;
+
+  if (bitset.m_heapWords) {
+    m_heapWords    = std::move(bitset.m_heapWords);
+    m_wordCapacity = bitset.m_wordCapacity;
+    m_inlineWords  = {};
+  } else {
+    // The inline words can't be stolen; they are copied instead, the current heap storage (if any) being released
+    m_heapWords.reset();
+    m_wordCapacity = InlineWordCount;
+    m_inlineWords  = bitset.m_inlineWords;
+  }
+
+  m_bitCount = bitset.m_bitCount;
+
+  bitset.m_bitCount     = 0;
+  bitset.m_wordCapacity = InlineWordCount;
+  bitset.m_inlineWords  = {};
+
   return *this;
 }
 
@@ -104,4 +342,26 @@ std::ostream& operator<<(std::ostream& stream, const Bitset& bitset) {
   return stream;
 }
 
+void Bitset::reserveWords(std::size_t wordCount) {
+  if (wordCount <= m_wordCapacity)
+    return;
+
+  const std::size_t newCapacity = std::max(wordCount, m_wordCapacity * 2);
+  auto newWords = std::make_unique<WordType[]>(newCapacity); // Value-initialized, hence zeroed
+
+  // The whole current storage is copied, as the size may already have been set beyond the current capacity
+  std::copy_n(getWords(), m_wordCapacity, newWords.get());
+
+  m_heapWords    = std::move(newWords);
+  m_wordCapacity = newCapacity;
+  m_inlineWords  = {};
+}
+
+void Bitset::clearTrailingBits() noexcept {
+  const std::size_t remainingBits = m_bitCount % WordBitCount;
+
+  if (remainingBits > 0)
+    getMutableWords()[m_bitCount / WordBitCount] &= ~(~WordType(0) << remainingBits);
+}
+
 } // namespace Raz
@@ -0,0 +1,71 @@
+#include "RaZ/Utils/Frustum.hpp"
+
+#include <algorithm>
+
+namespace Raz {
+
+namespace {
+
+/// Computes the signed distance between a point & a plane, positive on the side its normal points to.
+/// \param plane Plane to compute the distance to.
+/// \param point Point to compute the distance from.
+/// \return Signed distance between the point & the plane.
+float computeSignedDistance(const Plane& plane, const Vec3f& point) noexcept {
+  return plane.getNormal().dot(point) - plane.getDistance();
+}
+
+/// Creates a plane from the coefficients of its equation ax + by + cz + d = 0, normalizing them.
+/// \param coefficients Equation's coefficients (a, b, c, d).
+/// \return Created plane.
+Plane createPlane(const Vec4f& coefficients) {
+  const Vec3f normal(coefficients[0], coefficients[1], coefficients[2]);
+  const float invLength = 1.f / normal.computeLength();
+
+  return Plane(-coefficients[3] * invLength, normal * invLength);
+}
+
+} // namespace
+
+Frustum::Frustum(const Mat4f& viewProjMatrix) {
+  // Points being row vectors, each column of the matrix gives one of the clip space coordinates; a point is inside the frustum if
+  //  -w <= x <= w, -w <= y <= w & 0 <= z <= w
+  const Vec4f xColumn = viewProjMatrix.recoverColumn(0);
+  const Vec4f yColumn = viewProjMatrix.recoverColumn(1);
+  const Vec4f zColumn = viewProjMatrix.recoverColumn(2);
+  const Vec4f wColumn = viewProjMatrix.recoverColumn(3);
+
+  m_planes = { createPlane(wColumn + xColumn),   // Left
+               createPlane(wColumn - xColumn),   // Right
+               createPlane(wColumn + yColumn),   // Bottom
+               createPlane(wColumn - yColumn),   // Top
+               createPlane(zColumn),             // Near
+               createPlane(wColumn - zColumn) }; // Far
+}
+
+bool Frustum::contains(const Vec3f& point) const noexcept {
+  return std::all_of(m_planes.cbegin(), m_planes.cend(), [&point] (const Plane& plane) { return computeSignedDistance(plane, point) >= 0.f; });
+}
+
+bool Frustum::intersects(const Sphere& sphere) const noexcept {
+  return std::all_of(m_planes.cbegin(), m_planes.cend(), [&sphere] (const Plane& plane) {
+    return computeSignedDistance(plane, sphere.getCenter()) >= -sphere.getRadius();
+  });
+}
+
+bool Frustum::intersects(const Vec3f& minPos, const Vec3f& maxPos) const noexcept {
+  for (const Plane& plane : m_planes) {
+    const Vec3f& normal = plane.getNormal();
+
+    // The box is outside if even its corner lying the furthest along the plane's normal is behind it
+    const Vec3f furthestCorner(normal[0] >= 0.f ? maxPos[0] : minPos[0],
+                               normal[1] >= 0.f ? maxPos[1] : minPos[1],
+                               normal[2] >= 0.f ? maxPos[2] : minPos[2]);
+
+    if (computeSignedDistance(plane, furthestCorner) < 0.f)
+      return false;
+  }
+
+  return true;
+}
+
+} // namespace Raz
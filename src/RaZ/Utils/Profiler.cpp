@@ -0,0 +1,332 @@
+#include "RaZ/Utils/Profiler.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace Raz {
+
+namespace {
+
+constexpr std::array<char, 8> binaryMagic = { 'R', 'A', 'Z', 'P', 'R', 'O', 'F', '\0' };
+constexpr std::uint32_t binaryVersion     = 1;
+
+const std::chrono::steady_clock::time_point profilerStartTime = std::chrono::steady_clock::now();
+
+struct RecordedEvent {
+  std::string_view name;
+  std::uint64_t startTime;
+  std::uint64_t endTime;
+};
+
+/// Ring buffer in which a single thread records its events, which are consumed by the captures.
+struct ThreadBuffer {
+  std::array<RecordedEvent, Profiler::ThreadBufferCapacity> events {};
+  std::atomic<std::uint64_t> writeIndex {}; ///< Total amount of events written; only modified by the owning thread.
+  std::atomic<std::uint64_t> readIndex {}; ///< Total amount of events captured; only modified by the captures.
+  std::atomic<std::uint64_t> droppedEventCount {};
+  std::string name {}; ///< Name of the thread, guarded by the registry's mutex.
+  bool isOwned {}; ///< True if a running thread records its events into the buffer, false otherwise; guarded by the registry's mutex.
+};
+
+struct ThreadRegistry {
+  std::mutex mutex {};
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers {};
+  std::vector<std::size_t> freeBufferIndices {}; ///< Indices of the buffers whose thread has exited, the last one being reused first.
+};
+
+ThreadRegistry& getThreadRegistry() {
+  // The registry is never destroyed, as threads may still record events during the static objects' destruction
+  static auto* registry = new ThreadRegistry();
+  return *registry;
+}
+
+/// Gives a buffer to a new thread, reusing one whose thread has exited if all its events have been captured.
+/// \param registry Registry holding the buffers, whose mutex must be locked.
+/// \return Index of the given buffer.
+std::size_t acquireThreadBuffer(ThreadRegistry& registry) {
+  // A buffer still holding events is only reused after the next capture, so that they are not attributed to the new thread
+  const auto freeIndexIter = std::find_if(registry.freeBufferIndices.rbegin(), registry.freeBufferIndices.rend(), [&registry] (std::size_t index) {
+    const ThreadBuffer& buffer = *registry.buffers[index];
+    return (buffer.readIndex.load(std::memory_order_relaxed) == buffer.writeIndex.load(std::memory_order_relaxed));
+  });
+
+  std::size_t bufferIndex {};
+
+  if (freeIndexIter != registry.freeBufferIndices.rend()) {
+    bufferIndex = *freeIndexIter;
+    registry.freeBufferIndices.erase(std::next(freeIndexIter).base());
+  } else {
+    bufferIndex = registry.buffers.size();
+    registry.buffers.emplace_back(std::make_unique<ThreadBuffer>());
+  }
+
+  ThreadBuffer& buffer = *registry.buffers[bufferIndex];
+  buffer.name    = "Thread " + std::to_string(bufferIndex);
+  buffer.isOwned = true;
+
+  return bufferIndex;
+}
+
+thread_local ThreadBuffer* currentThreadBuffer = nullptr;
+thread_local bool isCurrentThreadBufferReleased = false;
+
+/// Thread-local handle giving the calling thread's buffer back to the registry when the thread exits, so that it can be reused.
+struct ThreadBufferHandle {
+  ThreadBufferHandle() {
+    ThreadRegistry& registry = getThreadRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    bufferIndex         = acquireThreadBuffer(registry);
+    currentThreadBuffer = registry.buffers[bufferIndex].get();
+  }
+  ThreadBufferHandle(const ThreadBufferHandle&) = delete;
+  ThreadBufferHandle(ThreadBufferHandle&&) noexcept = delete;
+
+  ThreadBufferHandle& operator=(const ThreadBufferHandle&) = delete;
+  ThreadBufferHandle& operator=(ThreadBufferHandle&&) noexcept = delete;
+
+  ~ThreadBufferHandle() {
+    ThreadRegistry& registry = getThreadRegistry();
+
+    {
+      // The buffer keeps its events & its thread's name until they are captured
+      std::lock_guard<std::mutex> lock(registry.mutex);
+      currentThreadBuffer->isOwned = false;
+      registry.freeBufferIndices.emplace_back(bufferIndex);
+    }
+
+    currentThreadBuffer           = nullptr;
+    isCurrentThreadBufferReleased = true;
+  }
+
+  std::size_t bufferIndex {};
+};
+
+/// Gets the calling thread's buffer, acquiring one on first use.
+/// \return Buffer of the calling thread; null if the thread is exiting & has already given its buffer back.
+ThreadBuffer* getThreadBuffer() {
+  // The handle is not created again if events are recorded by the thread-local objects destroyed after it
+  if (currentThreadBuffer == nullptr && !isCurrentThreadBufferReleased) {
+    [[maybe_unused]] thread_local const ThreadBufferHandle threadBufferHandle;
+  }
+
+  return currentThreadBuffer;
+}
+
+void writeJsonString(std::ostream& stream, const std::string& text) {
+  stream << '"';
+
+  for (const char character : text) {
+    if (character == '"' || character == '\\')
+      stream << '\\' << character;
+    else if (static_cast<unsigned char>(character) < 0x20)
+      stream << ' ';
+    else
+      stream << character;
+  }
+
+  stream << '"';
+}
+
+template <typename T>
+void writeValue(std::ostream& stream, const T& value) {
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void writeString(std::ostream& stream, const std::string& text) {
+  writeValue(stream, static_cast<std::uint32_t>(text.size()));
+  stream.write(text.data(), static_cast<std::streamsize>(text.size()));
+}
+
+template <typename T>
+T readValue(std::istream& stream) {
+  T value {};
+  stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return value;
+}
+
+std::string readString(std::istream& stream) {
+  std::string text(readValue<std::uint32_t>(stream), '\0');
+  stream.read(text.data(), static_cast<std::streamsize>(text.size()));
+  return text;
+}
+
+} // namespace
+
+ProfileCapture ProfileCapture::loadBinary(const std::string& filePath) {
+  std::ifstream file(filePath, std::ios::binary);
+
+  if (!file)
+    throw std::runtime_error("Error: Couldn't open the file '" + filePath + "'");
+
+  if (readValue<std::array<char, binaryMagic.size()>>(file) != binaryMagic)
+    throw std::runtime_error("Error: The file '" + filePath + "' isn't a profile capture");
+
+  if (readValue<std::uint32_t>(file) != binaryVersion)
+    throw std::runtime_error("Error: The profile capture '" + filePath + "' has an unsupported version");
+
+  ProfileCapture capture;
+
+  capture.m_names.resize(readValue<std::uint32_t>(file));
+  for (std::string& name : capture.m_names)
+    name = readString(file);
+
+  capture.m_threadNames.resize(readValue<std::uint32_t>(file));
+  for (std::string& threadName : capture.m_threadNames)
+    threadName = readString(file);
+
+  capture.m_droppedEventCount = readValue<std::uint64_t>(file);
+  capture.m_events.resize(readValue<std::uint64_t>(file));
+
+  for (Event& event : capture.m_events) {
+    event.nameIndex   = readValue<std::uint32_t>(file);
+    event.threadIndex = readValue<std::uint32_t>(file);
+    event.startTime   = readValue<std::uint64_t>(file);
+    event.duration    = readValue<std::uint64_t>(file);
+  }
+
+  if (!file)
+    throw std::runtime_error("Error: The profile capture '" + filePath + "' is truncated");
+
+  return capture;
+}
+
+void ProfileCapture::exportChromeTrace(const std::string& filePath) const {
+  std::ofstream file(filePath);
+
+  if (!file)
+    throw std::runtime_error("Error: Unable to create a file as '" + filePath + "'; path to file must exist");
+
+  file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+  for (std::size_t threadIndex = 0; threadIndex < m_threadNames.size(); ++threadIndex) {
+    file << (threadIndex == 0 ? "\n" : ",\n") << R"({"name":"thread_name","ph":"M","pid":0,"tid":)" << threadIndex << R"(,"args":{"name":)";
+    writeJsonString(file, m_threadNames[threadIndex]);
+    file << "}}";
+  }
+
+  // Times are given in microseconds, keeping a nanosecond precision
+  file << std::fixed << std::setprecision(3);
+
+  for (const Event& event : m_events) {
+    file << ",\n{\"name\":";
+    writeJsonString(file, m_names[event.nameIndex]);
+    file << R"(,"ph":"X","pid":0,"tid":)" << event.threadIndex
+         << ",\"ts\":" << static_cast<double>(event.startTime) / 1000.0
+         << ",\"dur\":" << static_cast<double>(event.duration) / 1000.0 << '}';
+  }
+
+  file << "\n]}\n";
+}
+
+void ProfileCapture::saveBinary(const std::string& filePath) const {
+  std::ofstream file(filePath, std::ios::binary);
+
+  if (!file)
+    throw std::runtime_error("Error: Unable to create a file as '" + filePath + "'; path to file must exist");
+
+  writeValue(file, binaryMagic);
+  writeValue(file, binaryVersion);
+
+  writeValue(file, static_cast<std::uint32_t>(m_names.size()));
+  for (const std::string& name : m_names)
+    writeString(file, name);
+
+  writeValue(file, static_cast<std::uint32_t>(m_threadNames.size()));
+  for (const std::string& threadName : m_threadNames)
+    writeString(file, threadName);
+
+  writeValue(file, m_droppedEventCount);
+  writeValue(file, std::uint64_t{ m_events.size() });
+
+  for (const Event& event : m_events) {
+    writeValue(file, event.nameIndex);
+    writeValue(file, event.threadIndex);
+    writeValue(file, event.startTime);
+    writeValue(file, event.duration);
+  }
+}
+
+std::uint64_t Profiler::getTime() noexcept {
+  return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - profilerStartTime).count());
+}
+
+void Profiler::setThreadName(std::string name) {
+  ThreadBuffer* buffer = getThreadBuffer();
+
+  if (buffer == nullptr)
+    return;
+
+  std::lock_guard<std::mutex> lock(getThreadRegistry().mutex);
+  buffer->name = std::move(name);
+}
+
+void Profiler::recordEvent(std::string_view name, std::uint64_t startTime, std::uint64_t endTime) noexcept {
+  ThreadBuffer* threadBuffer = getThreadBuffer();
+
+  // The events recorded after the buffer has been given back, by the thread-local objects destroyed after its handle, are ignored
+  if (threadBuffer == nullptr)
+    return;
+
+  ThreadBuffer& buffer = *threadBuffer;
+
+  const std::uint64_t writeIndex = buffer.writeIndex.load(std::memory_order_relaxed);
+
+  // The events are never overwritten before having been captured; if the buffer is full, the new ones are dropped
+  if (writeIndex - buffer.readIndex.load(std::memory_order_acquire) >= ThreadBufferCapacity) {
+    buffer.droppedEventCount.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  buffer.events[writeIndex % ThreadBufferCapacity] = RecordedEvent{ name, startTime, endTime };
+  buffer.writeIndex.store(writeIndex + 1, std::memory_order_release);
+}
+
+ProfileCapture Profiler::capture() {
+  ProfileCapture capture;
+  std::unordered_map<std::string_view, std::uint32_t> nameIndices;
+
+  ThreadRegistry& registry = getThreadRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+
+  capture.m_threadNames.reserve(registry.buffers.size());
+
+  for (const std::unique_ptr<ThreadBuffer>& bufferPtr : registry.buffers) {
+    ThreadBuffer& buffer = *bufferPtr;
+
+    const std::uint64_t readIndex  = buffer.readIndex.load(std::memory_order_relaxed);
+    const std::uint64_t writeIndex = buffer.writeIndex.load(std::memory_order_acquire);
+
+    // The buffers of exited threads are only listed as long as they hold events which haven't been captured yet
+    if (!buffer.isOwned && readIndex == writeIndex && buffer.droppedEventCount.load(std::memory_order_relaxed) == 0)
+      continue;
+
+    const auto threadIndex = static_cast<std::uint32_t>(capture.m_threadNames.size());
+    capture.m_threadNames.emplace_back(buffer.name);
+
+    for (std::uint64_t eventIndex = readIndex; eventIndex < writeIndex; ++eventIndex) {
+      const RecordedEvent& event = buffer.events[eventIndex % ThreadBufferCapacity];
+      const auto [nameIter, isNewName] = nameIndices.try_emplace(event.name, static_cast<std::uint32_t>(capture.m_names.size()));
+
+      if (isNewName)
+        capture.m_names.emplace_back(event.name);
+
+      capture.m_events.push_back(ProfileCapture::Event{ nameIter->second, threadIndex, event.startTime, event.endTime - event.startTime });
+    }
+
+    // The slots are only given back once their events have been copied
+    buffer.readIndex.store(writeIndex, std::memory_order_release);
+    capture.m_droppedEventCount += buffer.droppedEventCount.exchange(0, std::memory_order_relaxed);
+  }
+
+  return capture;
+}
+
+} // namespace Raz
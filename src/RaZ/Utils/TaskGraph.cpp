@@ -0,0 +1,213 @@
+#include "RaZ/Utils/TaskGraph.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+
+namespace Raz {
+
+struct TaskGraph::ExecutionState {
+  std::atomic<std::size_t> remainingTaskCount {};
+
+  std::mutex pendingTasksMutex {};
+  std::deque<std::pair<TaskNode*, bool>> pendingTasks {}; ///< Tasks ready to be executed by the calling thread, if threads are not available.
+
+  std::mutex exceptionMutex {};
+  std::exception_ptr exception {};
+};
+
+void TaskNode::addDependency(TaskNode& task) {
+  assert("Error: A task cannot depend on itself." && &task != this);
+
+  const std::vector<TaskNode*>& taskChildren = task.getChildren();
+
+  if (std::find(taskChildren.cbegin(), taskChildren.cend(), this) != taskChildren.cend())
+    return;
+
+  task.addChildren(*this);
+  ++m_dependencyCount;
+}
+
+TaskNode& TaskGraph::addContinuation(TaskNode& task, TaskNode::Action action) {
+  TaskNode& continuation = m_graph.addNode(std::move(action));
+  continuation.addDependency(task);
+
+  return continuation;
+}
+
+TaskNode& TaskGraph::addWhenAll(const std::vector<TaskNode*>& tasks, TaskNode::Action action) {
+  TaskNode& join = m_graph.addNode(std::move(action));
+
+  for (TaskNode* task : tasks)
+    join.addDependency(*task);
+
+  return join;
+}
+
+TaskNode& TaskGraph::addWhenAny(const std::vector<TaskNode*>& tasks, TaskNode::Action action) {
+  TaskNode& join = m_graph.addNode(std::move(action), true);
+
+  for (TaskNode* task : tasks)
+    join.addDependency(*task);
+
+  return join;
+}
+
+void TaskGraph::execute() {
+  const std::vector<std::unique_ptr<TaskNode>>& nodes = m_graph.getNodes();
+
+  if (nodes.empty())
+    return;
+
+  // Checking that every task can be reached by releasing the tasks in order, which is only the case if the graph has no cycle
+  {
+    std::vector<TaskNode*> releasedTasks;
+    releasedTasks.reserve(nodes.size());
+
+    for (const std::unique_ptr<TaskNode>& node : nodes) {
+      node->m_remainingDependencyCount = node->m_dependencyCount;
+
+      if (node->m_dependencyCount == 0)
+        releasedTasks.emplace_back(node.get());
+    }
+
+    for (std::size_t taskIndex = 0; taskIndex < releasedTasks.size(); ++taskIndex) {
+      for (TaskNode* child : releasedTasks[taskIndex]->getChildren()) {
+        if (--child->m_remainingDependencyCount == 0)
+          releasedTasks.emplace_back(child);
+      }
+    }
+
+    if (releasedTasks.size() != nodes.size())
+      throw std::runtime_error("Error: The task graph contains a cycle.");
+  }
+
+  ExecutionState state;
+  state.remainingTaskCount = nodes.size();
+
+  for (const std::unique_ptr<TaskNode>& node : nodes) {
+    node->m_remainingDependencyCount = node->m_dependencyCount;
+    node->m_isReleased               = false;
+    node->m_hasFailedDependency      = false;
+    node->m_hasFailed                = false;
+    node->m_isCanceled               = false;
+  }
+
+  for (const std::unique_ptr<TaskNode>& node : nodes) {
+    if (node->m_dependencyCount == 0)
+      scheduleTask(*node, false, state);
+  }
+
+  // The calling thread executes tasks until all of them are done, instead of waiting idly
+  while (state.remainingTaskCount > 0) {
+    std::pair<TaskNode*, bool> pendingTask {};
+
+    {
+      std::lock_guard<std::mutex> lock(state.pendingTasksMutex);
+
+      if (!state.pendingTasks.empty()) {
+        pendingTask = state.pendingTasks.front();
+        state.pendingTasks.pop_front();
+      }
+    }
+
+    if (pendingTask.first) {
+      executeTask(*pendingTask.first, pendingTask.second, state);
+      continue;
+    }
+
+#if defined(RAZ_THREADS_AVAILABLE)
+    if (!Threading::getDefaultThreadPool().runPendingTask())
+      std::this_thread::yield();
+#endif
+  }
+
+  if (state.exception)
+    std::rethrow_exception(state.exception);
+}
+
+void TaskGraph::executeTask(TaskNode& task, bool isCanceled, ExecutionState& state) {
+  TaskNode* currentTask = &task;
+  bool isCurrentCanceled = isCanceled;
+
+  while (currentTask) {
+    currentTask->m_isCanceled = isCurrentCanceled;
+    bool isSucceeded = false;
+
+    if (!isCurrentCanceled) {
+      try {
+        if (currentTask->m_action)
+          currentTask->m_action();
+
+        isSucceeded = true;
+      } catch (...) {
+        currentTask->m_hasFailed = true;
+
+        std::lock_guard<std::mutex> lock(state.exceptionMutex);
+
+        if (!state.exception)
+          state.exception = std::current_exception();
+      }
+    }
+
+    TaskNode* nextTask = nullptr;
+    bool isNextCanceled = false;
+
+    for (TaskNode* child : currentTask->getChildren()) {
+      bool isReleased = false;
+      bool isChildCanceled = false;
+
+      if (child->m_waitsForAny) {
+        // The first succeeding dependency releases the task; if none succeeds, the last one to be done releases it to be canceled
+        if (isSucceeded)
+          isReleased = !child->m_isReleased.exchange(true);
+
+        const bool isLastDependency = (--child->m_remainingDependencyCount == 0);
+
+        if (!isSucceeded && isLastDependency && !child->m_isReleased.exchange(true)) {
+          isReleased      = true;
+          isChildCanceled = true;
+        }
+      } else {
+        if (!isSucceeded)
+          child->m_hasFailedDependency = true;
+
+        if (--child->m_remainingDependencyCount == 0) {
+          isReleased      = true;
+          isChildCanceled = child->m_hasFailedDependency;
+        }
+      }
+
+      if (!isReleased)
+        continue;
+
+      if (nextTask == nullptr) {
+        nextTask       = child;
+        isNextCanceled = isChildCanceled;
+      } else {
+        scheduleTask(*child, isChildCanceled, state);
+      }
+    }
+
+    currentTask       = nextTask;
+    isCurrentCanceled = isNextCanceled;
+
+    // Once the last task is marked as done, the state may be destroyed at any moment & must not be accessed anymore
+    --state.remainingTaskCount;
+  }
+}
+
+void TaskGraph::scheduleTask(TaskNode& task, bool isCanceled, ExecutionState& state) {
+#if defined(RAZ_THREADS_AVAILABLE)
+  Threading::getDefaultThreadPool().addTask([&task, isCanceled, &state] () { executeTask(task, isCanceled, state); });
+#else
+  std::lock_guard<std::mutex> lock(state.pendingTasksMutex);
+  state.pendingTasks.emplace_back(&task, isCanceled);
+#endif
+}
+
+} // namespace Raz
@@ -0,0 +1,188 @@
+#include "RaZ/Utils/Profiler.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#ifdef RAZ_THREADS_AVAILABLE
+
+#include <cassert>
+#include <exception>
+#include <string>
+
+namespace Raz {
+
+namespace {
+
+// Pool & index of the worker running on the current thread, if any; used to add tasks to & take them from the worker's own queue
+thread_local const ThreadPool* currentPool = nullptr;
+thread_local std::size_t currentWorkerIndex = 0;
+
+} // namespace
+
+ThreadPool::ThreadPool(std::size_t workerCount) : ThreadPool(std::vector<ProcessorSet>(workerCount)) {}
+
+ThreadPool::ThreadPool(std::vector<ProcessorSet> workerAffinities) {
+  assert("Error: A thread pool must have at least one worker." && !workerAffinities.empty());
+
+  m_workers.reserve(workerAffinities.size());
+
+  for (ProcessorSet& affinity : workerAffinities) {
+    m_workers.emplace_back(std::make_unique<Worker>());
+    m_workers.back()->affinity = std::move(affinity);
+  }
+
+  // The threads are started only once every worker exists, since they may try to steal from each other right away
+  for (std::size_t workerIndex = 0; workerIndex < m_workers.size(); ++workerIndex)
+    m_workers[workerIndex]->thread = std::thread(&ThreadPool::runWorker, this, workerIndex);
+}
+
+void ThreadPool::addTask(Task task) {
+  const std::size_t workerIndex = (currentPool == this ? currentWorkerIndex : m_nextWorkerIndex++ % m_workers.size());
+  Worker& worker = *m_workers[workerIndex];
+
+  // The task is counted before being queued; another worker popping it right away would otherwise decrement the count below 0
+  ++m_pendingTaskCount;
+
+  try {
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    worker.tasks.emplace_back(std::move(task));
+  } catch (...) {
+    --m_pendingTaskCount;
+    throw;
+  }
+
+  // Locking the parking mutex guarantees that a worker about to be parked either sees the new task or gets notified
+  { std::lock_guard<std::mutex> lock(m_parkingMutex); }
+  m_parkingCondition.notify_one();
+}
+
+bool ThreadPool::runPendingTask() {
+  Task task;
+
+  if (currentPool == this) {
+    if (!popTask(currentWorkerIndex, task) && !stealTask(currentWorkerIndex + 1, task))
+      return false;
+  } else if (!stealTask(0, task)) {
+    return false;
+  }
+
+  task();
+  return true;
+}
+
+void ThreadPool::run(std::size_t executionCount, const std::function<void(std::size_t)>& action) {
+  if (executionCount == 0)
+    return;
+
+  std::atomic<std::size_t> remainingCount = executionCount - 1;
+  std::exception_ptr exception;
+  std::mutex exceptionMutex;
+
+  const auto execute = [&action, &exception, &exceptionMutex] (std::size_t executionIndex) noexcept {
+    try {
+      action(executionIndex);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(exceptionMutex);
+
+      if (!exception)
+        exception = std::current_exception();
+    }
+  };
+
+  for (std::size_t executionIndex = 1; executionIndex < executionCount; ++executionIndex) {
+    addTask([&execute, &remainingCount, executionIndex] () noexcept {
+      execute(executionIndex);
+      --remainingCount;
+    });
+  }
+
+  // The calling thread executes the first instance itself, then helps with the pending tasks until all instances are done
+  execute(0);
+
+  while (remainingCount > 0) {
+    if (!runPendingTask())
+      std::this_thread::yield();
+  }
+
+  if (exception)
+    std::rethrow_exception(exception);
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(m_parkingMutex);
+    m_isStopping = true;
+  }
+
+  m_parkingCondition.notify_all();
+
+  for (const std::unique_ptr<Worker>& worker : m_workers)
+    worker->thread.join();
+}
+
+bool ThreadPool::popTask(std::size_t workerIndex, Task& task) {
+  Worker& worker = *m_workers[workerIndex];
+  std::lock_guard<std::mutex> lock(worker.mutex);
+
+  if (worker.tasks.empty())
+    return false;
+
+  task = std::move(worker.tasks.back());
+  worker.tasks.pop_back();
+  --m_pendingTaskCount;
+
+  return true;
+}
+
+bool ThreadPool::stealTask(std::size_t firstWorkerIndex, Task& task) {
+  for (std::size_t i = 0; i < m_workers.size(); ++i) {
+    Worker& worker = *m_workers[(firstWorkerIndex + i) % m_workers.size()];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+
+    if (worker.tasks.empty())
+      continue;
+
+    task = std::move(worker.tasks.front());
+    worker.tasks.pop_front();
+    --m_pendingTaskCount;
+
+    return true;
+  }
+
+  return false;
+}
+
+void ThreadPool::runWorker(std::size_t workerIndex) {
+  currentPool        = this;
+  currentWorkerIndex = workerIndex;
+
+  // Failing to name or pin the thread only affects diagnostics & performance; the worker runs either way
+  const std::string threadName = "Worker " + std::to_string(workerIndex);
+  Threading::setCurrentThreadName(threadName);
+
+  if (!m_workers[workerIndex]->affinity.empty())
+    Threading::setCurrentThreadAffinity(m_workers[workerIndex]->affinity);
+
+#if defined(RAZ_USE_PROFILER)
+  Profiler::setThreadName(threadName);
+#endif
+
+  Task task;
+
+  while (true) {
+    if (popTask(workerIndex, task) || stealTask(workerIndex + 1, task)) {
+      task();
+      task = nullptr; // Releasing the task's resources right away
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(m_parkingMutex);
+    m_parkingCondition.wait(lock, [this] () { return (m_pendingTaskCount > 0 || m_isStopping); });
+
+    // The remaining tasks are all executed before stopping
+    if (m_isStopping && m_pendingTaskCount == 0)
+      return;
+  }
+}
+
+} // namespace Raz
+
+#endif // RAZ_THREADS_AVAILABLE
@@ -1,17 +1,372 @@
+#include "RaZ/Utils/ParallelAlgorithms.hpp"
 #include "RaZ/Utils/Threading.hpp"
 
 #ifdef RAZ_THREADS_AVAILABLE
 
+#if defined(RAZ_PLATFORM_WINDOWS)
+#if !defined(NOMINMAX)
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(RAZ_PLATFORM_LINUX) || defined(RAZ_PLATFORM_MAC)
+#include <pthread.h>
+#endif
+
+#if defined(RAZ_PLATFORM_LINUX)
+#include <sched.h>
+#endif
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+
 namespace Raz::Threading {
 
+namespace {
+
+#if defined(RAZ_PLATFORM_LINUX)
+/// Reads a list of processors or NUMA nodes in the format used by sysfs, such as "0-3,8,10-11".
+/// \param filePath Path to the file containing the list.
+/// \return Indices contained in the list; empty if the file can't be read.
+std::vector<unsigned int> readIndexList(const std::string& filePath) {
+  std::ifstream file(filePath);
+  std::vector<unsigned int> indices;
+
+  unsigned int firstIndex {};
+  char separator {};
+
+  while (file >> firstIndex) {
+    unsigned int lastIndex = firstIndex;
+
+    if (file.peek() == '-')
+      file >> separator >> lastIndex;
+
+    for (unsigned int index = firstIndex; index <= lastIndex; ++index)
+      indices.emplace_back(index);
+
+    if (file.peek() != ',')
+      break;
+
+    file >> separator;
+  }
+
+  return indices;
+}
+
+/// Reads a single value from a sysfs file.
+/// \param filePath Path to the file containing the value.
+/// \param defaultValue Value to be returned if the file can't be read.
+/// \return Value read from the file, or the default value.
+unsigned int readValue(const std::string& filePath, unsigned int defaultValue) {
+  std::ifstream file(filePath);
+  unsigned int value {};
+  return (file >> value ? value : defaultValue);
+}
+#endif
+
+CpuTopology detectCpuTopology() {
+  CpuTopology topology;
+
+#if defined(RAZ_PLATFORM_LINUX)
+  struct ProcessorLocation {
+    unsigned int index;
+    unsigned int numaNodeId;
+    unsigned int packageId;
+    unsigned int coreId;
+  };
+
+  std::vector<ProcessorLocation> locations;
+  cpu_set_t availableProcessors;
+
+  if (sched_getaffinity(0, sizeof(cpu_set_t), &availableProcessors) == 0) {
+    for (unsigned int processorIndex = 0; processorIndex < CPU_SETSIZE; ++processorIndex) {
+      if (CPU_ISSET(processorIndex, &availableProcessors))
+        locations.push_back(ProcessorLocation{ processorIndex, 0, 0, processorIndex });
+    }
+  }
+
+  if (!locations.empty()) {
+    const std::string cpuPath = "/sys/devices/system/cpu/cpu";
+
+    for (ProcessorLocation& location : locations) {
+      const std::string topologyPath = cpuPath + std::to_string(location.index) + "/topology/";
+
+      // Without this information, each processor is considered to be a core of its own
+      location.packageId = readValue(topologyPath + "physical_package_id", 0);
+      location.coreId    = readValue(topologyPath + "core_id", location.index);
+    }
+
+    // Systems without NUMA support have no node directory, all their processors being on a single node
+    for (const unsigned int numaNodeId : readIndexList("/sys/devices/system/node/online")) {
+      for (const unsigned int processorIndex : readIndexList("/sys/devices/system/node/node" + std::to_string(numaNodeId) + "/cpulist")) {
+        const auto locationIt = std::find_if(locations.begin(), locations.end(), [processorIndex] (const ProcessorLocation& location) {
+          return (location.index == processorIndex);
+        });
+
+        if (locationIt != locations.end())
+          locationIt->numaNodeId = numaNodeId;
+      }
+    }
+
+    // Numbering the available nodes & cores contiguously, the cores being grouped by node
+    std::sort(locations.begin(), locations.end(), [] (const ProcessorLocation& location1, const ProcessorLocation& location2) {
+      return std::tie(location1.numaNodeId, location1.packageId, location1.coreId, location1.index)
+           < std::tie(location2.numaNodeId, location2.packageId, location2.coreId, location2.index);
+    });
+
+    std::map<unsigned int, std::size_t> numaNodeIndices;
+    std::map<std::pair<unsigned int, unsigned int>, std::size_t> coreIndices;
+
+    for (const ProcessorLocation& location : locations) {
+      const std::size_t numaNodeIndex = numaNodeIndices.try_emplace(location.numaNodeId, numaNodeIndices.size()).first->second;
+      const auto coreId               = std::make_pair(location.packageId, location.coreId);
+      const std::size_t coreIndex     = coreIndices.try_emplace(coreId, coreIndices.size()).first->second;
+
+      topology.logicalProcessors.push_back(LogicalProcessor{ location.index, coreIndex, numaNodeIndex });
+    }
+
+    topology.coreCount     = coreIndices.size();
+    topology.numaNodeCount = numaNodeIndices.size();
+
+    return topology;
+  }
+#endif
+
+  const unsigned int processorCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+  for (unsigned int processorIndex = 0; processorIndex < processorCount; ++processorIndex)
+    topology.logicalProcessors.push_back(LogicalProcessor{ processorIndex, processorIndex, 0 });
+
+  topology.coreCount     = processorCount;
+  topology.numaNodeCount = 1;
+
+  return topology;
+}
+
+struct DefaultThreadPoolState {
+  std::mutex mutex {};
+  std::optional<SchedulingSettings> settings {};
+  bool isCreated = false;
+};
+
+DefaultThreadPoolState& getDefaultThreadPoolState() {
+  static DefaultThreadPoolState state;
+  return state;
+}
+
+std::vector<ProcessorSet> computeDefaultWorkerAffinities() {
+  DefaultThreadPoolState& state = getDefaultThreadPoolState();
+
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.isCreated = true;
+
+  // The calling thread takes part in the parallel operations, thus not needing a worker of its own
+  if (!state.settings)
+    return std::vector<ProcessorSet>(std::max(getSystemThreadCount(), 2u) - 1);
+
+  return computeWorkerAffinities(getCpuTopology(), *state.settings);
+}
+
+} // namespace
+
 unsigned int getSystemThreadCount() noexcept {
+#if defined(RAZ_PLATFORM_LINUX)
+  // The process may be restricted to some of the processors, for example when running in a container
+  cpu_set_t availableProcessors;
+
+  if (sched_getaffinity(0, sizeof(cpu_set_t), &availableProcessors) == 0)
+    return std::max(static_cast<unsigned int>(CPU_COUNT(&availableProcessors)), 1u);
+#endif
+
   const unsigned int threadCount = std::thread::hardware_concurrency();
   return std::max(threadCount, 1u); // threadCount is 0 if undefined; returning 1 thread available in this case
 }
 
+const CpuTopology& getCpuTopology() {
+  static const CpuTopology topology = detectCpuTopology();
+  return topology;
+}
+
+std::vector<ProcessorSet> computeWorkerAffinities(const CpuTopology& topology, const SchedulingSettings& settings) {
+  std::vector<ProcessorSet> coreProcessors(topology.coreCount);
+  std::vector<std::vector<std::size_t>> numaNodeCores(topology.numaNodeCount);
+
+  for (const LogicalProcessor& processor : topology.logicalProcessors) {
+    if (coreProcessors[processor.coreIndex].empty())
+      numaNodeCores[processor.numaNodeIndex].emplace_back(processor.coreIndex);
+
+    coreProcessors[processor.coreIndex].emplace_back(processor.index);
+  }
+
+  // Removing the reserved cores, the first node's ones first
+  std::size_t remainingReservedCount = std::min(settings.reservedCoreCount, topology.coreCount);
+  std::size_t lastReservedCoreIndex  = 0;
+
+  for (std::vector<std::size_t>& cores : numaNodeCores) {
+    const std::size_t reservedCount = std::min(remainingReservedCount, cores.size());
+
+    if (reservedCount > 0)
+      lastReservedCoreIndex = cores[reservedCount - 1];
+
+    cores.erase(cores.begin(), cores.begin() + static_cast<std::ptrdiff_t>(reservedCount));
+    remainingReservedCount -= reservedCount;
+  }
+
+  std::vector<std::size_t> workerCounts = settings.workerCountsPerNumaNode;
+
+  if (workerCounts.empty()) {
+    for (const std::vector<std::size_t>& cores : numaNodeCores)
+      workerCounts.emplace_back(cores.size());
+  }
+
+  std::vector<ProcessorSet> workerAffinities;
+
+  for (std::size_t numaNodeIndex = 0; numaNodeIndex < workerCounts.size(); ++numaNodeIndex) {
+    const std::size_t workerCount = workerCounts[numaNodeIndex];
+
+    if (workerCount == 0)
+      continue;
+
+    if (numaNodeIndex >= topology.numaNodeCount)
+      throw std::runtime_error("Error: Workers can't be created on NUMA node " + std::to_string(numaNodeIndex) + ", which doesn't exist");
+
+    const std::vector<std::size_t>& cores = numaNodeCores[numaNodeIndex];
+
+    // If all of the node's cores are reserved, its workers share them all with the reserved threads
+    ProcessorSet numaNodeProcessors;
+
+    for (const LogicalProcessor& processor : topology.logicalProcessors) {
+      if (processor.numaNodeIndex != numaNodeIndex)
+        continue;
+
+      if (cores.empty() || std::find(cores.cbegin(), cores.cend(), processor.coreIndex) != cores.cend())
+        numaNodeProcessors.emplace_back(processor.index);
+    }
+
+    std::sort(numaNodeProcessors.begin(), numaNodeProcessors.end());
+
+    for (std::size_t workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
+      if (!settings.pinWorkers)
+        workerAffinities.emplace_back(settings.workerCountsPerNumaNode.empty() ? ProcessorSet() : numaNodeProcessors);
+      else if (cores.empty())
+        workerAffinities.emplace_back(numaNodeProcessors);
+      else
+        workerAffinities.emplace_back(coreProcessors[cores[workerIndex % cores.size()]]);
+    }
+  }
+
+  if (workerAffinities.empty()) {
+    if (!settings.workerCountsPerNumaNode.empty())
+      throw std::runtime_error("Error: A thread pool must have at least one worker");
+
+    // Every core is reserved; a single worker shares the last one
+    workerAffinities.emplace_back(settings.pinWorkers && topology.coreCount > 0 ? coreProcessors[lastReservedCoreIndex] : ProcessorSet());
+  }
+
+  return workerAffinities;
+}
+
+void configureDefaultThreadPool(const SchedulingSettings& settings) {
+  DefaultThreadPoolState& state = getDefaultThreadPoolState();
+
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    if (state.isCreated)
+      throw std::runtime_error("Error: The default thread pool must be configured before being used");
+
+    // Checking the settings right away, so that an invalid configuration is reported here rather than on the pool's first use
+    computeWorkerAffinities(getCpuTopology(), settings);
+    state.settings = settings;
+  }
+
+  if (!settings.pinCallingThread || settings.reservedCoreCount == 0)
+    return;
+
+  const CpuTopology& topology = getCpuTopology();
+  ProcessorSet firstCoreProcessors;
+
+  for (const LogicalProcessor& processor : topology.logicalProcessors) {
+    if (processor.coreIndex == 0)
+      firstCoreProcessors.emplace_back(processor.index);
+  }
+
+  if (!firstCoreProcessors.empty())
+    setCurrentThreadAffinity(firstCoreProcessors);
+}
+
+ThreadPool& getDefaultThreadPool() {
+  static ThreadPool threadPool(computeDefaultWorkerAffinities());
+  return threadPool;
+}
+
+bool setCurrentThreadName(const std::string& name) noexcept {
+#if defined(RAZ_PLATFORM_LINUX)
+  // Linux limits the names to 16 characters, including the null terminator
+  char truncatedName[16] {};
+  name.copy(truncatedName, sizeof(truncatedName) - 1);
+
+  return (pthread_setname_np(pthread_self(), truncatedName) == 0);
+#elif defined(RAZ_PLATFORM_MAC)
+  return (pthread_setname_np(name.c_str()) == 0);
+#else
+  static_cast<void>(name);
+  return false;
+#endif
+}
+
+bool setCurrentThreadAffinity(const ProcessorSet& processors) noexcept {
+  if (processors.empty())
+    return false;
+
+#if defined(RAZ_PLATFORM_LINUX)
+  cpu_set_t processorSet;
+  CPU_ZERO(&processorSet);
+
+  for (const unsigned int processorIndex : processors) {
+    if (processorIndex >= CPU_SETSIZE)
+      return false;
+
+    CPU_SET(processorIndex, &processorSet);
+  }
+
+  return (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &processorSet) == 0);
+#elif defined(RAZ_PLATFORM_WINDOWS)
+  DWORD_PTR processorMask = 0;
+
+  for (const unsigned int processorIndex : processors) {
+    if (processorIndex >= sizeof(DWORD_PTR) * 8)
+      return false;
+
+    processorMask |= static_cast<DWORD_PTR>(1) << processorIndex;
+  }
+
+  return (SetThreadAffinityMask(GetCurrentThread(), processorMask) != 0);
+#else
+  return false;
+#endif
+}
+
+std::size_t computeGrainSize(std::size_t elementCount, std::size_t elementSize, std::size_t minGrainSize) noexcept {
+  constexpr std::size_t ChunksPerThread = 4; // Several chunks per thread allow the faster threads to process more of them
+
+  const std::size_t threadCount = getDefaultThreadPool().getWorkerCount() + 1;
+  const std::size_t grainSize   = std::max((elementCount + threadCount * ChunksPerThread - 1) / (threadCount * ChunksPerThread), minGrainSize);
+
+  // Rounding the grain size up to a whole number of cache lines, so that the chunks' boundaries don't share any
+  const std::size_t cacheLineElementCount = std::max(CacheLineSize / std::max(elementSize, static_cast<std::size_t>(1)), static_cast<std::size_t>(1));
+  return (grainSize + cacheLineElementCount - 1) / cacheLineElementCount * cacheLineElementCount;
+}
+
 void parallelize(const std::function<void()>& action, std::size_t threadCount) {
   assert("Error: The number of threads can't be 0." && threadCount != 0);
 
+  // Each instance gets its own thread, so that they can all wait for each other; running them on the pool would make them wait for a
+  //  worker to be free, & instances synchronizing with each other would deadlock if there were more of them than workers
   std::vector<std::thread> threads(threadCount);
 
   for (std::thread& thread : threads)
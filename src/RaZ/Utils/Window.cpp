@@ -244,6 +244,15 @@ void Window::addOverlayFpsCounter(std::string formattedLabel) {
 }
 
 bool Window::run(float deltaTime) {
+  if (!processInputs(deltaTime))
+    return false;
+
+  display();
+
+  return true;
+}
+
+bool Window::processInputs(float deltaTime) {
   if (glfwWindowShouldClose(m_window))
     return false;
 
@@ -272,6 +281,10 @@ bool Window::run(float deltaTime) {
     }
   }
 
+  return true;
+}
+
+void Window::display() {
   if (m_overlay)
     m_overlay->render();
 
@@ -279,8 +292,10 @@ bool Window::run(float deltaTime) {
 
   Renderer::clearColor(m_clearColor[0], m_clearColor[1], m_clearColor[2], m_clearColor[3]);
   Renderer::clear(MaskType::COLOR, MaskType::DEPTH);
+}
 
-  return true;
+bool Window::shouldClose() const {
+  return glfwWindowShouldClose(m_window);
 }
 
 Vec2f Window::recoverMousePosition() const {
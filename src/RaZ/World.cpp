@@ -1,31 +1,234 @@
 #include "RaZ/World.hpp"
+#include "RaZ/Utils/Profiler.hpp"
 
 namespace Raz {
 
+namespace {
+
+/// Links the entity to the system if it should be, unlinks it if it shouldn't anymore, or relinks it if it stays linked.
+/// \param system System to link the entity to or unlink it from.
+/// \param entity Entity to be checked.
+void linkEntity(System& system, Entity& entity) {
+  // If the system doesn't contain the entity, check if it should (possesses the accepted components); if yes, link it
+  // Else, if the system contains the entity but shouldn't, unlink it; if it still should, let the system handle its modification
+  const bool isAccepted = system.acceptsEntity(entity);
+
+  if (!system.containsEntity(entity)) {
+    if (isAccepted)
+      system.linkEntity(entity);
+  } else {
+    if (!isAccepted)
+      system.unlinkEntity(entity);
+    else
+      system.relinkEntity(entity);
+  }
+}
+
+/// Makes sure the given vector can hold the given amount of additional elements without reallocating more than once.
+/// \param vector Vector to reserve memory in.
+/// \param count Amount of elements to be added.
+template <typename T>
+void reserveAdditional(std::vector<T>& vector, std::size_t count) {
+  const std::size_t requiredCapacity = vector.size() + count;
+
+  // Keeping a geometric growth, so that repeated instantiations don't lead to as many reallocations
+  if (requiredCapacity > vector.capacity())
+    vector.reserve(std::max(requiredCapacity, vector.capacity() * 2));
+}
+
+} // namespace
+
+World::World(std::size_t entityCount) {
+  m_entityPool->reserve(entityCount);
+  m_entities.reserve(entityCount);
+  m_entitySlots.reserve(entityCount);
+}
+
 Entity& World::addEntity(bool enabled) {
-  m_entities.emplace_back(Entity::create(m_maxEntityIndex++, enabled));
+  Entity& entity = createEntity(enabled);
+  m_registry->updateEntity(entity);
+
+  return entity;
+}
+
+std::vector<Entity*> World::instantiate(const Prefab& prefab, std::size_t count, bool enabled) {
+  RAZ_PROFILE_ZONE("World::instantiate");
+
+  std::vector<Entity*> entities;
+
+  if (count == 0)
+    return entities;
+
+  entities.reserve(count);
+
+  const std::size_t newSlotCount = count - std::min(count, m_freeEntityIndices.size());
+  reserveAdditional(m_entitySlots, newSlotCount);
+  reserveAdditional(m_entities, count);
+  m_entityPool->reserve(m_entityPool->getObjectCount() + count);
+
+  for (std::size_t entityIndex = 0; entityIndex < count; ++entityIndex)
+    entities.emplace_back(&createEntity(enabled));
+
+  const Bitset& signature = prefab.getSignature();
+
+  for (Entity* entity : entities) {
+    entity->m_components.resize(signature.getSize());
+    entity->m_enabledComponents = signature;
+  }
+
+  // Each type of component is copied at once, so that its copies end up contiguous in their storage
+  signature.forEachEnabledBit([this, &prefab, &entities] (std::size_t compId) {
+    std::vector<ComponentPtr> components = prefab.copyComponent(compId, *m_registry, entities.size());
+
+    for (std::size_t entityIndex = 0; entityIndex < entities.size(); ++entityIndex)
+      entities[entityIndex]->m_components[compId] = std::move(components[entityIndex]);
+  });
+
+  m_registry->addEntities(entities);
+
+  return entities;
+}
+
+Entity& World::createEntity(bool enabled) {
+  std::size_t entityIndex {};
+
+  if (!m_freeEntityIndices.empty()) {
+    entityIndex = m_freeEntityIndices.back();
+    m_freeEntityIndices.pop_back();
+  } else {
+    entityIndex = m_entitySlots.size();
+    m_entitySlots.emplace_back();
+  }
+
+  EntityPtr entityPtr(&m_entityPool->emplace(entityIndex, enabled), EntityDeleter{ m_entityPool.get() });
+  Entity& entity = *m_entities.emplace_back(std::move(entityPtr));
+  entity.m_registry = m_registry.get();
+
+  EntitySlot& slot    = m_entitySlots[entityIndex];
+  slot.entity         = &entity;
+  entity.m_generation = slot.generation;
 
   m_activeEntityCount += enabled;
 
-  return *m_entities.back();
+  return entity;
+}
+
+bool World::isMainThreadRequired() const noexcept {
+  // Systems which haven't declared their accesses are only updated on the world's thread to prevent conflicts within the world
+  return std::any_of(m_systems.cbegin(), m_systems.cend(), [] (const SystemPtr& system) { return (system && system->m_isMainThreadRequired); });
+}
+
+const Entity* World::getEntity(EntityHandle handle) const noexcept {
+  if (handle.index >= m_entitySlots.size())
+    return nullptr;
+
+  const EntitySlot& slot = m_entitySlots[handle.index];
+  return (slot.generation == handle.generation ? slot.entity : nullptr);
+}
+
+void World::destroyEntity(EntityHandle handle) {
+  Entity* entity = getEntity(handle);
+
+  if (entity)
+    destroyEntity(*entity);
 }
 
-bool World::update(float deltaTime) {
-  refresh();
+EntityCommandBuffer& World::getCommandBuffer() {
+  std::lock_guard<std::mutex> lock(*m_commandBuffersMutex);
+
+  EntityCommandBuffer*& commandBuffer = m_threadCommandBuffers[std::this_thread::get_id()];
 
-  for (std::size_t systemIndex = 0; systemIndex < m_systems.size(); ++systemIndex) {
-    if (m_activeSystems[systemIndex]) {
-      if (!m_systems[systemIndex]->update(deltaTime))
-        m_activeSystems.setBit(systemIndex, false);
+  if (commandBuffer == nullptr)
+    commandBuffer = m_commandBuffers.emplace_back(std::make_unique<EntityCommandBuffer>()).get();
+
+  return *commandBuffer;
+}
+
+void World::playbackCommandBuffers() {
+  // Playing back a buffer may add entities or components, but doesn't record any command; the buffers can't be modified in the meantime.
+  //  They are played back in a fixed order, so that the entities are created in the same order, & get the same IDs, from a run to another
+  try {
+    for (const std::unique_ptr<EntityCommandBuffer>& commandBuffer : m_commandBuffers) {
+      if (!commandBuffer->isEmpty())
+        commandBuffer->playback(*this);
     }
+  } catch (...) {
+    // The commands following the one that threw would otherwise be played back on the next update, out of their context
+    for (const std::unique_ptr<EntityCommandBuffer>& commandBuffer : m_commandBuffers)
+      commandBuffer->clear();
+
+    throw;
   }
+}
 
-  return !m_activeSystems.isEmpty();
+bool World::updateVariableStep(float deltaTime, float stepInterpolation) {
+  for (const SystemPtr& system : m_systems) {
+    if (system) {
+      system->m_stepInterpolation = stepInterpolation;
+      system->m_fixedStepCount    = m_fixedStepCount;
+    }
+  }
+
+  return updateSystems(UpdateStep::VARIABLE, deltaTime);
+}
+
+World& World::operator=(World&& world) noexcept {
+  m_systems       = std::move(world.m_systems);
+  m_activeSystems = std::move(world.m_activeSystems);
+  m_systemGraphs  = std::move(world.m_systemGraphs);
+
+  m_areSystemGraphsDirty = world.m_areSystemGraphsDirty;
+
+  m_budgetOverruns = std::move(world.m_budgetOverruns);
+  m_isFrameEnded   = world.m_isFrameEnded;
+  m_fixedStepCount = world.m_fixedStepCount;
+
+  m_isRefreshDeferred = world.m_isRefreshDeferred;
+
+  // The current entities must be destroyed while the registry holding their components & their pool still exist
+  m_entities   = std::move(world.m_entities);
+  m_entityPool = std::move(world.m_entityPool);
+  m_registry   = std::move(world.m_registry);
+
+  m_activeEntityCount = world.m_activeEntityCount;
+  m_entitySlots       = std::move(world.m_entitySlots);
+  m_freeEntityIndices = std::move(world.m_freeEntityIndices);
+
+  m_commandBuffers       = std::move(world.m_commandBuffers);
+  m_threadCommandBuffers = std::move(world.m_threadCommandBuffers);
+  m_commandBuffersMutex  = std::move(world.m_commandBuffersMutex);
+
+  return *this;
 }
 
 void World::refresh() {
-  if (m_entities.empty())
+  const std::vector<Entity*>& dirtyEntities = m_registry->getDirtyEntities();
+
+  // Entities are only reorganized & relinked if any of them has been structurally modified or destroyed since the last refresh
+  if (dirtyEntities.empty() && m_registry->getDestroyedEntities().empty())
+    return;
+
+  RAZ_PROFILE_ZONE("World::refresh");
+
+  for (Entity* entity : dirtyEntities) {
+    // The entities to be destroyed are unlinked right after
+    if (entity->isPendingDestruction())
+      continue;
+
+    for (const SystemPtr& system : m_systems) {
+      if (system)
+        linkEntity(*system, *entity);
+    }
+  }
+
+  m_registry->clearDirtyEntities();
+
+  destroyMarkedEntities();
+
+  if (m_entities.empty()) {
+    m_activeEntityCount = 0;
     return;
+  }
 
   // Reorganizing the entites, swapping enabled & disabled ones so that the enabled ones are in front
   auto entityBegin = m_entities.begin();
@@ -48,24 +251,103 @@ void World::refresh() {
   }
 
   m_activeEntityCount = static_cast<std::size_t>(std::distance(m_entities.begin(), entityEnd) + 1);
+}
 
-  for (std::size_t entityIndex = 0; entityIndex < m_activeEntityCount; ++entityIndex) {
-    const auto& entity = m_entities[entityIndex];
+void World::destroyMarkedEntities() {
+  const std::vector<Entity*>& destroyedEntities = m_registry->getDestroyedEntities();
 
-    for (auto& system : m_systems) {
-      const Bitset matchingComponents = system->getAcceptedComponents() & entity->getEnabledComponents();
+  if (destroyedEntities.empty())
+    return;
 
-      // If the system doesn't contain the entity, check if it should (possesses the accepted components); if yes, link it
-      // Else, if the system contains the entity but shouldn't, unlink it
-      if (!system->containsEntity(entity)) {
-        if (!matchingComponents.isEmpty())
-          system->linkEntity(entity);
-      } else {
-        if (matchingComponents.isEmpty())
-          system->unlinkEntity(entity);
+  for (Entity* entity : destroyedEntities) {
+    for (const SystemPtr& system : m_systems) {
+      if (system)
+        system->unlinkEntity(*entity);
+    }
+
+    m_registry->removeEntity(*entity);
+
+    // Incrementing the index's generation invalidates all the existing handles to the entity
+    EntitySlot& slot = m_entitySlots[entity->getId()];
+    slot.entity      = nullptr;
+    ++slot.generation;
+
+    m_freeEntityIndices.emplace_back(entity->getId());
+  }
+
+  m_registry->clearDestroyedEntities();
+
+  // Removing all the destroyed entities at once, keeping the others' order; their components are given back to the registry
+  m_entities.erase(std::remove_if(m_entities.begin(), m_entities.end(), [] (const EntityPtr& entity) {
+    return entity->isPendingDestruction();
+  }), m_entities.end());
+}
+
+bool World::updateSystems(UpdateStep step, float deltaTime) {
+  RAZ_PROFILE_ZONE("World::update");
+
+  if (!m_isRefreshDeferred) {
+    playbackCommandBuffers();
+    refresh();
+  }
+
+  const auto stepIndex = static_cast<std::size_t>(step);
+
+  if (m_areSystemGraphsDirty[stepIndex]) {
+    Bitset stepSystems = m_activeSystems;
+
+    if (step != UpdateStep::ALL) {
+      for (std::size_t systemIndex = 0; systemIndex < m_systems.size(); ++systemIndex) {
+        if (m_systems[systemIndex] && m_systems[systemIndex]->isFixedStepRequired() != (step == UpdateStep::FIXED))
+          stepSystems.setBit(systemIndex, false);
+      }
+    }
+
+    m_systemGraphs[stepIndex].build(m_systems, stepSystems);
+    m_areSystemGraphsDirty[stepIndex] = false;
+  }
+
+  if (step == UpdateStep::ALL) {
+    // Without any fixed step, there is nothing to interpolate; the step count restarts once the World is updated at a fixed step again
+    m_fixedStepCount = 0;
+
+    for (const SystemPtr& system : m_systems) {
+      if (system) {
+        system->m_stepInterpolation = 0.f;
+        system->m_fixedStepCount    = 0;
       }
     }
+  } else if (step == UpdateStep::FIXED) {
+    ++m_fixedStepCount;
   }
+
+  // If any system throws or becomes inactive, all the graphs are rebuilt on their next update, since some systems may have become
+  //  inactive in the meantime
+  const std::array<bool, static_cast<std::size_t>(UpdateStep::COUNT)> areSystemGraphsDirty = m_areSystemGraphsDirty;
+  m_areSystemGraphsDirty.fill(true);
+
+  if (m_isFrameEnded) {
+    m_budgetOverruns.clear();
+    m_isFrameEnded = false;
+  }
+
+  SystemGraph& systemGraph = m_systemGraphs[stepIndex];
+
+  if (!systemGraph.update(deltaTime, m_activeSystems))
+    m_areSystemGraphsDirty = areSystemGraphsDirty;
+
+  // The systems' updates being over, their durations can be safely read; the nodes are still those which have just been updated
+  for (const std::unique_ptr<SystemNode>& node : systemGraph.getGraph().getNodes()) {
+    const System& system = node->getSystem();
+
+    if (node->isUpdated() && system.hasExceededTimeBudget())
+      m_budgetOverruns.push_back(BudgetOverrun{ &system, system.getLastUpdateDuration(), system.getTimeBudget() });
+  }
+
+  // The fixed steps are made before the variable one within the same frame
+  m_isFrameEnded = (step != UpdateStep::FIXED);
+
+  return !m_activeSystems.isEmpty();
 }
 
 } // namespace Raz
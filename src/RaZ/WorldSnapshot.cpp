@@ -0,0 +1,253 @@
+#include "RaZ/Entity.hpp"
+#include "RaZ/World.hpp"
+#include "RaZ/WorldSnapshot.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Physics/RigidBody.hpp"
+
+#include <array>
+#include <fstream>
+
+namespace Raz {
+
+namespace {
+
+constexpr std::array<char, 8> snapshotMagic = { 'R', 'A', 'Z', 'W', 'O', 'R', 'L', 'D' };
+
+bool isComponentEnabled(const Entity& entity, std::size_t compId) {
+  return (compId < entity.getComponents().size() && entity.getEnabledComponents()[compId]);
+}
+
+} // namespace
+
+void SnapshotWriter::writeString(std::string_view text) {
+  write(static_cast<std::uint32_t>(text.size()));
+  writeArray(text.data(), text.size());
+}
+
+std::string SnapshotReader::readString() {
+  std::string text(read<std::uint32_t>(), '\0');
+  readArray(text.data(), text.size());
+  return text;
+}
+
+const std::byte* SnapshotReader::readBytes(std::size_t size) {
+  if (size > getRemainingSize())
+    throw std::runtime_error("Error: The snapshot is truncated");
+
+  const std::byte* bytes = m_data + m_position;
+  m_position += size;
+
+  return bytes;
+}
+
+WorldSnapshot::WorldSnapshot() {
+  registerComponent<Transform>("Transform", 1, [] (const Transform& transform, SnapshotWriter& writer) {
+    writer.write(transform.getPosition());
+    writer.write(transform.getRotation());
+    writer.write(transform.getScale());
+  }, [] (Entity& entity, SnapshotReader& reader, std::uint32_t) {
+    const auto position = reader.read<Vec3f>();
+    const auto rotation = reader.read<Mat4f>();
+    const auto scale    = reader.read<Vec3f>();
+
+    entity.addComponent<Transform>(position, rotation, scale);
+  });
+
+  registerComponent<RigidBody>("RigidBody", 1, [] (const RigidBody& rigidBody, SnapshotWriter& writer) {
+    writer.write(rigidBody.getMass());
+    writer.write(rigidBody.getBounciness());
+    writer.write(rigidBody.getForces());
+    writer.write(rigidBody.getVelocity());
+  }, [] (Entity& entity, SnapshotReader& reader, std::uint32_t) {
+    const auto mass       = reader.read<float>();
+    const auto bounciness = reader.read<float>();
+
+    auto& rigidBody = entity.addComponent<RigidBody>(mass, bounciness);
+    rigidBody.applyForces(reader.read<Vec3f>());
+    rigidBody.setVelocity(reader.read<Vec3f>());
+  });
+}
+
+std::vector<std::byte> WorldSnapshot::save(const World& world) const {
+  std::vector<std::byte> snapshot;
+  save(world, snapshot);
+  return snapshot;
+}
+
+void WorldSnapshot::save(const World& world, std::vector<std::byte>& snapshot) const {
+  std::vector<const Entity*> entities;
+  entities.reserve(world.getEntities().size());
+
+  for (const auto& entity : world.getEntities()) {
+    if (!entity->isPendingDestruction())
+      entities.emplace_back(entity.get());
+  }
+
+  SnapshotWriter writer(std::move(snapshot));
+
+  writer.write(snapshotMagic);
+  writer.write(FormatVersion);
+
+  // The amount of blocks is only known once all components have been written
+  const std::size_t blockCountPos = writer.getSize();
+  writer.write(std::uint32_t{});
+  writer.write(std::uint64_t{ entities.size() });
+
+  std::vector<std::uint8_t> enabledStates(entities.size());
+  for (std::size_t entityIndex = 0; entityIndex < entities.size(); ++entityIndex)
+    enabledStates[entityIndex] = entities[entityIndex]->isEnabled();
+  writer.writeArray(enabledStates.data(), enabledStates.size());
+
+  std::uint32_t blockCount = 0;
+  std::vector<std::uint32_t> entityIndices;
+
+  for (const ComponentSerializer& serializer : m_serializers) {
+    entityIndices.clear();
+
+    for (std::size_t entityIndex = 0; entityIndex < entities.size(); ++entityIndex) {
+      if (isComponentEnabled(*entities[entityIndex], serializer.componentId))
+        entityIndices.emplace_back(static_cast<std::uint32_t>(entityIndex));
+    }
+
+    if (entityIndices.empty())
+      continue;
+
+    writer.writeString(serializer.name);
+    writer.write(serializer.version);
+    writer.write(std::uint64_t{ entityIndices.size() });
+
+    // The data's size allows readers to skip the blocks of components they don't know
+    const std::size_t dataSizePos = writer.getSize();
+    writer.write(std::uint64_t{});
+    writer.writeArray(entityIndices.data(), entityIndices.size());
+
+    const std::size_t dataStartPos = writer.getSize();
+    for (const std::uint32_t entityIndex : entityIndices)
+      serializer.save(*entities[entityIndex]->getComponents()[serializer.componentId], writer);
+
+    const std::uint64_t dataSize = writer.getSize() - dataStartPos;
+    std::memcpy(writer.getData().data() + dataSizePos, &dataSize, sizeof(dataSize));
+
+    ++blockCount;
+  }
+
+  std::memcpy(writer.getData().data() + blockCountPos, &blockCount, sizeof(blockCount));
+
+  snapshot = std::move(writer.getData());
+}
+
+void WorldSnapshot::save(const World& world, const std::string& filePath) const {
+  const std::vector<std::byte> snapshot = save(world);
+
+  std::ofstream file(filePath, std::ios::binary);
+
+  if (!file)
+    throw std::runtime_error("Error: Unable to create a file as '" + filePath + "'; path to file must exist");
+
+  file.write(reinterpret_cast<const char*>(snapshot.data()), static_cast<std::streamsize>(snapshot.size()));
+}
+
+std::vector<Entity*> WorldSnapshot::load(World& world, const std::byte* data, std::size_t size) const {
+  SnapshotReader reader(data, size);
+
+  if (reader.read<std::array<char, snapshotMagic.size()>>() != snapshotMagic)
+    throw std::runtime_error("Error: The given data isn't a world snapshot");
+
+  if (reader.read<std::uint32_t>() != FormatVersion)
+    throw std::runtime_error("Error: The world snapshot has an unsupported format version");
+
+  const auto blockCount  = reader.read<std::uint32_t>();
+  const auto entityCount = reader.read<std::uint64_t>();
+
+  // Each entity takes at least a byte; checking it beforehand avoids creating entities from a corrupted snapshot
+  const std::byte* enabledStates = reader.readBytes(static_cast<std::size_t>(entityCount));
+
+  struct Block {
+    const ComponentSerializer* serializer;
+    std::string name;
+    std::uint32_t version;
+    std::size_t componentCount;
+    const std::byte* entityIndices;
+    SnapshotReader dataReader;
+  };
+
+  // All the blocks are checked before any entity is created, so that an invalid snapshot leaves the world untouched
+  std::vector<Block> blocks;
+
+  for (std::uint32_t blockIndex = 0; blockIndex < blockCount; ++blockIndex) {
+    std::string name          = reader.readString();
+    const auto version        = reader.read<std::uint32_t>();
+    const auto componentCount = reader.read<std::uint64_t>();
+    const auto dataSize       = reader.read<std::uint64_t>();
+
+    if (componentCount > entityCount)
+      throw std::runtime_error("Error: The world snapshot's block '" + name + "' holds more components than there are entities");
+
+    const std::byte* entityIndices = reader.readBytes(static_cast<std::size_t>(componentCount) * sizeof(std::uint32_t));
+    SnapshotReader dataReader(reader.readBytes(static_cast<std::size_t>(dataSize)), static_cast<std::size_t>(dataSize));
+
+    for (std::size_t componentIndex = 0; componentIndex < componentCount; ++componentIndex) {
+      std::uint32_t entityIndex {};
+      std::memcpy(&entityIndex, entityIndices + componentIndex * sizeof(std::uint32_t), sizeof(std::uint32_t));
+
+      if (entityIndex >= entityCount)
+        throw std::runtime_error("Error: The world snapshot's block '" + name + "' references an invalid entity");
+    }
+
+    const auto serializerIter = std::find_if(m_serializers.cbegin(), m_serializers.cend(), [&name] (const ComponentSerializer& serializer) {
+      return (serializer.name == name);
+    });
+
+    if (serializerIter == m_serializers.cend())
+      continue;
+
+    blocks.push_back(Block{ &*serializerIter, std::move(name), version, static_cast<std::size_t>(componentCount), entityIndices, dataReader });
+  }
+
+  std::vector<Entity*> entities;
+  entities.reserve(static_cast<std::size_t>(entityCount));
+
+  for (std::size_t entityIndex = 0; entityIndex < entityCount; ++entityIndex)
+    entities.emplace_back(&world.addEntity(enabledStates[entityIndex] != std::byte{ 0 }));
+
+  // The components' data can only be checked by reading it; if it is invalid, the entities already created are destroyed
+  try {
+    for (Block& block : blocks) {
+      for (std::size_t componentIndex = 0; componentIndex < block.componentCount; ++componentIndex) {
+        std::uint32_t entityIndex {};
+        std::memcpy(&entityIndex, block.entityIndices + componentIndex * sizeof(std::uint32_t), sizeof(std::uint32_t));
+
+        block.serializer->load(*entities[entityIndex], block.dataReader, block.version);
+      }
+
+      if (block.dataReader.getRemainingSize() != 0)
+        throw std::runtime_error("Error: The world snapshot's block '" + block.name + "' hasn't been entirely read");
+    }
+  } catch (...) {
+    for (Entity* entity : entities)
+      world.destroyEntity(*entity);
+
+    throw;
+  }
+
+  return entities;
+}
+
+std::vector<Entity*> WorldSnapshot::load(World& world, const std::string& filePath) const {
+  std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+
+  if (!file)
+    throw std::runtime_error("Error: Couldn't open the file '" + filePath + "'");
+
+  std::vector<std::byte> snapshot(static_cast<std::size_t>(file.tellg()));
+
+  file.seekg(0);
+  file.read(reinterpret_cast<char*>(snapshot.data()), static_cast<std::streamsize>(snapshot.size()));
+
+  if (!file)
+    throw std::runtime_error("Error: Couldn't read the file '" + filePath + "'");
+
+  return load(world, snapshot);
+}
+
+} // namespace Raz
@@ -0,0 +1,320 @@
+#include "Catch.hpp"
+
+#include "RaZ/Application.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+/// System integrating at the fixed simulation step, counting its steps.
+class FixedStepSystem final : public Raz::System {
+public:
+  FixedStepSystem() { registerWrittenComponents<Raz::Transform>(); requireFixedStep(); }
+
+  std::size_t getStepCount() const noexcept { return m_stepCount; }
+  float getLastTimeStep() const noexcept { return m_lastTimeStep; }
+
+  bool update(float timeStep) override {
+    ++m_stepCount;
+    m_lastTimeStep = timeStep;
+
+    return true;
+  }
+
+private:
+  std::size_t m_stepCount {};
+  float m_lastTimeStep {};
+};
+
+/// System updated once per frame, recording the step interpolation & the step count it is given.
+class InterpolationRecorderSystem final : public Raz::System {
+public:
+  InterpolationRecorderSystem() { registerReadComponents<Raz::Transform>(); }
+
+  std::size_t getUpdateCount() const noexcept { return m_updateCount; }
+  float getLastInterpolation() const noexcept { return m_lastInterpolation; }
+  std::uint64_t getLastFixedStepCount() const noexcept { return m_lastFixedStepCount; }
+
+  bool update(float /* deltaTime */) override {
+    ++m_updateCount;
+    m_lastInterpolation  = getStepInterpolation();
+    m_lastFixedStepCount = getFixedStepCount();
+
+    return true;
+  }
+
+private:
+  std::size_t m_updateCount {};
+  float m_lastInterpolation {};
+  std::uint64_t m_lastFixedStepCount {};
+};
+
+#if defined(RAZ_THREADS_AVAILABLE)
+/// System waiting, on each update, for as many worlds as expected to have started their own; this can only happen if they run concurrently.
+class RendezvousSystem final : public Raz::System {
+public:
+  RendezvousSystem(std::atomic<std::size_t>& startedWorldCount, std::size_t expectedWorldCount, bool throws = false)
+    : m_startedWorldCount{ startedWorldCount }, m_expectedWorldCount{ expectedWorldCount }, m_throws{ throws } {
+    registerWrittenComponents<Raz::Transform>();
+  }
+
+  std::size_t getUpdateCount() const noexcept { return m_updateCount; }
+  bool hasMetOtherWorlds() const noexcept { return m_hasMetOtherWorlds; }
+
+  bool update(float /* deltaTime */) override {
+    ++m_updateCount;
+    ++m_startedWorldCount;
+
+    // The wait is bounded so that a sequential update makes the test fail instead of hanging
+    const auto endTime = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+    while (m_startedWorldCount < m_expectedWorldCount && std::chrono::steady_clock::now() < endTime)
+      std::this_thread::yield();
+
+    m_hasMetOtherWorlds = (m_startedWorldCount >= m_expectedWorldCount);
+
+    if (m_throws)
+      throw std::runtime_error("Error: Failing world update");
+
+    return true;
+  }
+
+private:
+  std::atomic<std::size_t>& m_startedWorldCount;
+  std::size_t m_expectedWorldCount {};
+  bool m_throws {};
+  std::size_t m_updateCount {};
+  bool m_hasMetOtherWorlds {};
+};
+
+/// Pipelined system producing, on each update, a frame holding its index, & consuming the last produced one when rendered.
+class FrameProducerSystem final : public Raz::System {
+public:
+  /// Creates a frame producer.
+  /// \param waitsForRendering True if each update must wait for the rendering of the same application frame to have started, which can
+  ///   only happen if both overlap; false otherwise.
+  explicit FrameProducerSystem(bool waitsForRendering) : m_waitsForRendering{ waitsForRendering } {
+    registerReadComponents<Raz::Transform>();
+    registerRenderedComponents<Raz::Transform>();
+    m_isPipelined = true;
+  }
+
+  std::size_t getRenderedFrame() const noexcept { return m_renderedFrame; }
+  std::size_t getRenderCount() const noexcept { return m_renderCount; }
+  bool hasMetRendering() const noexcept { return m_hasMetRendering; }
+
+  bool update(float /* deltaTime */) override {
+    const std::size_t producedFrame = m_producedFrame + 1;
+
+    if (m_waitsForRendering) {
+      // The wait is bounded so that a sequential rendering makes the test fail instead of hanging
+      const auto endTime = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+      while (m_renderCount < producedFrame && std::chrono::steady_clock::now() < endTime)
+        std::this_thread::yield();
+
+      m_hasMetRendering = (m_renderCount >= producedFrame);
+    }
+
+    std::lock_guard<std::mutex> lock(m_frameMutex);
+    m_producedFrame = producedFrame;
+
+    return true;
+  }
+
+  bool render() override {
+    {
+      std::lock_guard<std::mutex> lock(m_frameMutex);
+      m_renderedFrame = m_producedFrame;
+    }
+
+    ++m_renderCount;
+
+    return true;
+  }
+
+private:
+  bool m_waitsForRendering {};
+  std::mutex m_frameMutex {};
+  std::size_t m_producedFrame {};
+  std::size_t m_renderedFrame {};
+  std::atomic<std::size_t> m_renderCount = 0;
+  bool m_hasMetRendering {};
+};
+
+/// System modifying transforms, which may throw on update.
+class TransformWriterSystem final : public Raz::System {
+public:
+  TransformWriterSystem() { registerWrittenComponents<Raz::Transform>(); }
+
+  void setThrowing(bool throws) noexcept { m_throws = throws; }
+
+  bool update(float /* deltaTime */) override {
+    if (m_throws)
+      throw std::runtime_error("Error: Failing transform update");
+
+    return true;
+  }
+
+private:
+  bool m_throws {};
+};
+#endif
+
+} // namespace
+
+TEST_CASE("Application fixed step") {
+  Raz::Application app;
+
+  Raz::World& world    = app.addWorld(Raz::World());
+  auto& fixedSystem    = world.addSystem<FixedStepSystem>();
+  auto& variableSystem = world.addSystem<InterpolationRecorderSystem>();
+
+  // The durations used are exactly representable, so that the accumulated time can be checked exactly
+  app.setFixedTimeStep(0.25f);
+
+  // 2 steps fit in the frame, the remaining eighth of a second being half a step
+  CHECK(app.run(0.625f));
+  CHECK(fixedSystem.getStepCount() == 2);
+  CHECK(fixedSystem.getLastTimeStep() == 0.25f);
+  CHECK(variableSystem.getUpdateCount() == 1);
+  CHECK(app.getStepInterpolation() == 0.5f);
+  CHECK(variableSystem.getLastInterpolation() == 0.5f);
+  CHECK(variableSystem.getLastFixedStepCount() == 2);
+
+  // The time left by the previous frame is accumulated with the next one's
+  app.run(0.25f);
+  CHECK(fixedSystem.getStepCount() == 3);
+  CHECK(app.getStepInterpolation() == 0.5f);
+
+  // A frame shorter than the remaining time doesn't make any step, but still updates the other systems
+  app.run(0.0625f);
+  CHECK(fixedSystem.getStepCount() == 3);
+  CHECK(variableSystem.getUpdateCount() == 3);
+  CHECK(app.getStepInterpolation() == 0.75f);
+  CHECK(variableSystem.getLastInterpolation() == 0.75f);
+  CHECK(variableSystem.getLastFixedStepCount() == 3);
+
+  // Frames too long to be caught up with are clamped to the maximum step count, the late steps being dropped
+  app.setMaxStepCount(3);
+  app.run(2.f); // 2.1875s are accumulated, 3 steps are made & the 1.4375s left are brought back within a step
+  CHECK(fixedSystem.getStepCount() == 6);
+  CHECK(app.getStepInterpolation() == 0.75f);
+
+  app.run(0.0625f);
+  CHECK(fixedSystem.getStepCount() == 7);
+  CHECK(app.getStepInterpolation() == 0.f);
+
+  // Without a fixed step, all systems are updated once per frame with its duration, without any interpolation
+  app.setFixedTimeStep(0.f);
+  app.run(1.f);
+  CHECK(fixedSystem.getStepCount() == 8);
+  CHECK(fixedSystem.getLastTimeStep() == 1.f);
+  CHECK(variableSystem.getUpdateCount() == 6);
+  CHECK(variableSystem.getLastFixedStepCount() == 0);
+  CHECK(app.getStepInterpolation() == 0.f);
+  CHECK(app.getDeltaTime() == 1.f);
+}
+
+#if defined(RAZ_THREADS_AVAILABLE)
+TEST_CASE("Application parallel world update") {
+  Raz::Application app;
+  app.enableParallelWorldUpdate();
+
+  std::atomic<std::size_t> startedWorldCount = 0;
+
+  // The systems declare their accesses, thus not requiring their world to be updated on the main thread
+  auto& firstSystem  = app.addWorld(Raz::World()).addSystem<RendezvousSystem>(startedWorldCount, 2);
+  auto& secondSystem = app.addWorld(Raz::World()).addSystem<RendezvousSystem>(startedWorldCount, 2);
+
+  CHECK(app.run(0.f));
+  CHECK(firstSystem.getUpdateCount() == 1);
+  CHECK(secondSystem.getUpdateCount() == 1);
+  CHECK(firstSystem.hasMetOtherWorlds());
+  CHECK(secondSystem.hasMetOtherWorlds());
+
+  // If a world throws, the exception is rethrown to the caller once every world has been updated
+  Raz::Application failingApp;
+  failingApp.enableParallelWorldUpdate();
+
+  startedWorldCount = 0;
+
+  auto& validSystem   = failingApp.addWorld(Raz::World()).addSystem<RendezvousSystem>(startedWorldCount, 2);
+  auto& failingSystem = failingApp.addWorld(Raz::World()).addSystem<RendezvousSystem>(startedWorldCount, 2, true);
+
+  CHECK_THROWS_AS(failingApp.run(0.f), std::runtime_error);
+  CHECK(validSystem.getUpdateCount() == 1);
+  CHECK(failingSystem.getUpdateCount() == 1);
+  CHECK(validSystem.hasMetOtherWorlds());
+  CHECK(failingSystem.hasMetOtherWorlds());
+}
+#endif
+
+#if defined(RAZ_THREADS_AVAILABLE)
+TEST_CASE("Application pipelined rendering") {
+  Raz::Application app;
+
+  Raz::World& world    = app.addWorld(Raz::World());
+  auto& producerSystem = world.addSystem<FrameProducerSystem>(true);
+
+  // Each frame renders the one produced during the previous application frame, while the next one is being produced
+  for (std::size_t frameIndex = 1; frameIndex <= 3; ++frameIndex) {
+    CHECK(app.run(0.f));
+    CHECK(producerSystem.hasMetRendering());
+    CHECK(producerSystem.getRenderCount() == frameIndex);
+    CHECK(producerSystem.getRenderedFrame() == frameIndex - 1);
+  }
+
+  // The refresh is deferred only during the simulation
+  CHECK_FALSE(world.isRefreshDeferred());
+}
+
+TEST_CASE("Application pipelined rendering exclusive access") {
+  Raz::Application app;
+
+  // Another system may write the rendered components, thus forbidding any overlap: each frame is rendered once produced
+  Raz::World& world    = app.addWorld(Raz::World());
+  auto& producerSystem = world.addSystem<FrameProducerSystem>(false);
+  world.addSystem<TransformWriterSystem>();
+
+  for (std::size_t frameIndex = 1; frameIndex <= 3; ++frameIndex) {
+    CHECK(app.run(0.f));
+    CHECK(producerSystem.getRenderCount() == frameIndex);
+    CHECK(producerSystem.getRenderedFrame() == frameIndex);
+  }
+}
+
+TEST_CASE("Application pipelined rendering failure") {
+  Raz::Application app;
+
+  // The failing system belongs to another world, leaving the rendering overlap with the simulation
+  Raz::World& renderedWorld = app.addWorld(Raz::World());
+  auto& producerSystem      = renderedWorld.addSystem<FrameProducerSystem>(true);
+
+  Raz::World& failingWorld = app.addWorld(Raz::World());
+  auto& failingSystem      = failingWorld.addSystem<TransformWriterSystem>();
+
+  failingSystem.setThrowing(true);
+
+  // The exception is rethrown once both the rendering & the simulation are over, the refresh being restored
+  CHECK_THROWS_AS(app.run(0.f), std::runtime_error);
+  CHECK(producerSystem.hasMetRendering());
+  CHECK(producerSystem.getRenderCount() == 1);
+  CHECK(producerSystem.getRenderedFrame() == 0);
+  CHECK_FALSE(renderedWorld.isRefreshDeferred());
+  CHECK_FALSE(failingWorld.isRefreshDeferred());
+
+  // The application can still be run afterward, rendering the frame produced before the failure
+  failingSystem.setThrowing(false);
+
+  CHECK(app.run(0.f));
+  CHECK(producerSystem.getRenderCount() == 2);
+  CHECK(producerSystem.getRenderedFrame() == 1);
+}
+#endif
@@ -0,0 +1,165 @@
+#include "Catch.hpp"
+
+#include "RaZ/EntityCommandBuffer.hpp"
+#include "RaZ/World.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Physics/RigidBody.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+/// Component whose construction may fail.
+class FallibleComponent final : public Raz::Component {
+public:
+  explicit FallibleComponent(bool fails) {
+    if (fails)
+      throw std::runtime_error("Error: Failed to construct the component");
+  }
+};
+
+} // namespace
+
+TEST_CASE("EntityCommandBuffer playback") {
+  Raz::World world;
+
+  Raz::Entity& entity1 = world.addEntityWithComponent<Raz::Transform>();
+  Raz::Entity& entity2 = world.addEntityWithComponent<Raz::Transform>();
+
+  Raz::EntityCommandBuffer commandBuffer;
+  CHECK(commandBuffer.isEmpty());
+
+  const Raz::DeferredEntity createdEntity = commandBuffer.createEntity(false);
+  commandBuffer.addComponent<Raz::Transform>(createdEntity, Raz::Vec3f(1.f, 2.f, 3.f));
+  commandBuffer.addComponent<Raz::RigidBody>(entity1.getHandle(), 1.f, 0.5f);
+  commandBuffer.removeComponent<Raz::Transform>(entity1.getHandle());
+  commandBuffer.enableEntity(entity2.getHandle(), false);
+  CHECK(commandBuffer.getCommandCount() == 5);
+
+  // Recording commands doesn't modify the world
+  CHECK(world.getEntities().size() == 2);
+  CHECK(entity1.hasComponent<Raz::Transform>());
+  CHECK_FALSE(entity1.hasComponent<Raz::RigidBody>());
+  CHECK(entity2.isEnabled());
+
+  commandBuffer.playback(world);
+  CHECK(commandBuffer.isEmpty());
+
+  REQUIRE(world.getEntities().size() == 3);
+  const Raz::Entity& entity3 = *world.getEntities().back();
+  CHECK_FALSE(entity3.isEnabled());
+  REQUIRE(entity3.hasComponent<Raz::Transform>());
+  CHECK(entity3.getComponent<Raz::Transform>().getPosition() == Raz::Vec3f(1.f, 2.f, 3.f));
+
+  CHECK_FALSE(entity1.hasComponent<Raz::Transform>());
+  CHECK(entity1.hasComponent<Raz::RigidBody>());
+  CHECK_FALSE(entity2.isEnabled());
+
+  // Commands targeting destroyed entities are ignored
+  const Raz::EntityHandle handle2 = entity2.getHandle();
+  commandBuffer.destroyEntity(handle2);
+  commandBuffer.addComponent<Raz::RigidBody>(handle2, 1.f, 0.5f);
+  commandBuffer.playback(world);
+
+  CHECK(entity2.isPendingDestruction());
+  CHECK_FALSE(entity2.hasComponent<Raz::RigidBody>());
+
+  world.refresh();
+  CHECK_FALSE(world.isValid(handle2));
+
+  commandBuffer.enableEntity(handle2);
+  CHECK_NOTHROW(commandBuffer.playback(world));
+  CHECK(world.getEntities().size() == 2);
+
+  // Entities created by the buffer can be destroyed by it
+  const Raz::DeferredEntity destroyedEntity = commandBuffer.createEntity();
+  commandBuffer.addComponent<Raz::Transform>(destroyedEntity);
+  commandBuffer.destroyEntity(destroyedEntity);
+  commandBuffer.playback(world);
+  world.refresh();
+
+  CHECK(world.getEntities().size() == 2);
+  CHECK(world.getComponentRegistry().getStorage<Raz::Transform>().getComponentCount() == 1);
+
+  commandBuffer.createEntity();
+  commandBuffer.clear();
+  commandBuffer.playback(world);
+  CHECK(world.getEntities().size() == 2);
+}
+
+TEST_CASE("EntityCommandBuffer per-thread recording") {
+  Raz::World world;
+
+  for (std::size_t entityIndex = 0; entityIndex < 100; ++entityIndex)
+    world.addEntityWithComponent<Raz::Transform>();
+
+  // Each thread records into its own buffer, the world being left untouched until the buffers are played back
+  Raz::Threading::parallelize(world.getEntities(), [&world] (Raz::Threading::IndexRange range) {
+    Raz::EntityCommandBuffer& commandBuffer = world.getCommandBuffer();
+
+    for (std::size_t entityIndex = range.beginIndex; entityIndex < range.endIndex; ++entityIndex) {
+      const Raz::Entity& entity = *world.getEntities()[entityIndex];
+      commandBuffer.addComponent<Raz::RigidBody>(entity.getHandle(), 1.f, 0.5f);
+      commandBuffer.createEntity();
+    }
+  });
+
+  CHECK(world.getEntities().size() == 100);
+  CHECK_FALSE(world.getComponentRegistry().hasStorage<Raz::RigidBody>());
+  CHECK(&world.getCommandBuffer() == &world.getCommandBuffer());
+
+  // The buffers are played back at the beginning of the update
+  world.update(0.f);
+
+  CHECK(world.getEntities().size() == 200);
+  CHECK(world.getComponentRegistry().getStorage<Raz::RigidBody>().getComponentCount() == 100);
+  CHECK(world.getCommandBuffer().isEmpty());
+}
+
+TEST_CASE("EntityCommandBuffer playback order") {
+  Raz::World world;
+
+  // The buffers are played back in the order in which their threads first requested them, whatever the threads' IDs
+  Raz::EntityCommandBuffer& mainBuffer = world.getCommandBuffer();
+  mainBuffer.addComponent<Raz::Transform>(mainBuffer.createEntity(), Raz::Vec3f(0.f));
+
+  for (std::size_t threadIndex = 1; threadIndex < 4; ++threadIndex) {
+    std::thread([&world, threadIndex] () {
+      Raz::EntityCommandBuffer& commandBuffer = world.getCommandBuffer();
+      commandBuffer.addComponent<Raz::Transform>(commandBuffer.createEntity(), Raz::Vec3f(static_cast<float>(threadIndex)));
+    }).join();
+  }
+
+  mainBuffer.addComponent<Raz::Transform>(mainBuffer.createEntity(), Raz::Vec3f(0.f));
+
+  world.playbackCommandBuffers();
+
+  REQUIRE(world.getEntities().size() == 5);
+
+  for (std::size_t entityIndex = 0; entityIndex < 5; ++entityIndex) {
+    const float expectedPos = (entityIndex <= 1 ? 0.f : static_cast<float>(entityIndex - 1));
+    CHECK(world.getEntities()[entityIndex]->getComponent<Raz::Transform>().getPosition() == Raz::Vec3f(expectedPos));
+  }
+
+  // If a command throws, none of the buffers' remaining commands is kept for the next playback
+  mainBuffer.addComponent<FallibleComponent>(mainBuffer.createEntity(), true);
+  mainBuffer.createEntity();
+
+  std::thread([&world] () { world.getCommandBuffer().createEntity(); }).join();
+
+  CHECK_THROWS(world.playbackCommandBuffers());
+  CHECK(world.getEntities().size() == 6);
+  CHECK(mainBuffer.isEmpty());
+
+  world.playbackCommandBuffers();
+  CHECK(world.getEntities().size() == 6);
+
+  // The buffer stays usable afterward
+  mainBuffer.addComponent<FallibleComponent>(mainBuffer.createEntity(), false);
+  world.playbackCommandBuffers();
+
+  REQUIRE(world.getEntities().size() == 7);
+  CHECK(world.getEntities().back()->hasComponent<FallibleComponent>());
+}
@@ -3,6 +3,8 @@
 #include "RaZ/Math/Matrix.hpp"
 #include "RaZ/Math/Vector.hpp"
 
+#include <cstring>
+
 namespace {
 
 // Declaring matrices to be tested
@@ -151,3 +153,42 @@ TEST_CASE("Matrix/vector operations") {
   CHECK((mat41 * vec4) == Raz::Vec4f(62692.896451f, 159652.86849f, 31668.27f, 644394.3890001f));
   CHECK((mat42 * vec4) == Raz::Vec4f(36239.89676f, 45725.116745f, 35918.46f, 30679.27964f));
 }
+
+#if defined(RAZ_CONSTANT_EVALUATION_DETECTABLE)
+TEST_CASE("Matrix SIMD parity") {
+  // Constant expressions are always computed by the generic implementations, while the SIMD ones are used at runtime if available;
+  //  both must give results identical to the bit
+  const auto isBitwiseEqual = [] (const auto& val1, const auto& val2) {
+    return (std::memcmp(val1.getDataPtr(), val2.getDataPtr(), sizeof(val1)) == 0);
+  };
+
+  // Zeros of opposite signs must be kept as such
+  constexpr Raz::Mat4f signedZeroMat(-0.f,  0.f,  -0.f,   1.5f,
+                                      2.f, -0.f,   3.f,  -0.f,
+                                      0.f, -4.f,   0.5f,  -0.f,
+                                     -1.f,  0.f,   0.f,   -0.f);
+  constexpr Raz::Vec4f vec(84.47f, -0.f, 0.001f, -847.12f);
+
+  constexpr Raz::Mat4f product4142       = mat41 * mat42;
+  constexpr Raz::Mat4f product4241       = mat42 * mat41;
+  constexpr Raz::Mat4f productSignedZero = signedZeroMat * signedZeroMat;
+  constexpr Raz::Vec4f matVecProduct     = mat41 * vec;
+  constexpr Raz::Vec4f signedZeroMatVec  = signedZeroMat * Raz::Vec4f(-0.f);
+  constexpr Raz::Vec4f vecMatProduct     = vec * mat42;
+  constexpr Raz::Mat4f transposed        = mat41.transpose();
+  constexpr Raz::Mat4f inverse41         = mat41.inverse();
+  constexpr Raz::Mat4f inverse42         = mat42.inverse();
+  constexpr Raz::Mat4f inverseSignedZero = signedZeroMat.inverse();
+
+  CHECK(isBitwiseEqual(mat41 * mat42, product4142));
+  CHECK(isBitwiseEqual(mat42 * mat41, product4241));
+  CHECK(isBitwiseEqual(signedZeroMat * signedZeroMat, productSignedZero));
+  CHECK(isBitwiseEqual(mat41 * vec, matVecProduct));
+  CHECK(isBitwiseEqual(signedZeroMat * Raz::Vec4f(-0.f), signedZeroMatVec));
+  CHECK(isBitwiseEqual(vec * mat42, vecMatProduct));
+  CHECK(isBitwiseEqual(mat41.transpose(), transposed));
+  CHECK(isBitwiseEqual(mat41.inverse(), inverse41));
+  CHECK(isBitwiseEqual(mat42.inverse(), inverse42));
+  CHECK(isBitwiseEqual(signedZeroMat.inverse(), inverseSignedZero));
+}
+#endif
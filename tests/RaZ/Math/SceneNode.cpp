@@ -0,0 +1,175 @@
+#include "Catch.hpp"
+
+#include "RaZ/World.hpp"
+#include "RaZ/Math/SceneGraphSystem.hpp"
+#include "RaZ/Math/SceneNode.hpp"
+#include "RaZ/Math/Transform.hpp"
+
+TEST_CASE("SceneNode hierarchy") {
+  Raz::SceneNode root;
+  Raz::SceneNode child1;
+  Raz::SceneNode child2;
+
+  CHECK(root.isRoot());
+  CHECK(root.getChildren().empty());
+
+  root.addChild(child1);
+  child2.setParent(root);
+  CHECK_FALSE(child1.isRoot());
+  CHECK(child1.getParent() == &root);
+  CHECK(root.getChildren().size() == 2);
+
+  // Attaching a node to another parent detaches it from the previous one
+  child2.setParent(child1);
+  CHECK(root.getChildren().size() == 1);
+  CHECK(child1.getChildren().size() == 1);
+  CHECK(child2.getParent() == &child1);
+
+  child1.detach();
+  CHECK(child1.isRoot());
+  CHECK(root.getChildren().empty());
+  CHECK(child2.getParent() == &child1);
+
+  // Destroying a node makes its children roots
+  {
+    Raz::SceneNode parent;
+    parent.addChild(child1);
+    CHECK_FALSE(child1.isRoot());
+  }
+
+  CHECK(child1.isRoot());
+}
+
+TEST_CASE("SceneGraphSystem world matrices") {
+  Raz::World world;
+  auto& sceneGraph = world.addSystem<Raz::SceneGraphSystem>();
+
+  Raz::Entity& root = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(1.f, 0.f, 0.f));
+  auto& rootNode    = root.addComponent<Raz::SceneNode>();
+
+  Raz::Entity& child = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.f, 2.f, 0.f), Raz::Mat4f::identity(), Raz::Vec3f(2.f));
+  auto& childNode    = child.addComponent<Raz::SceneNode>();
+
+  // An entity without any transform is placed at its parent's origin
+  Raz::Entity& grandchild = world.addEntityWithComponent<Raz::SceneNode>();
+  auto& grandchildNode    = grandchild.getComponent<Raz::SceneNode>();
+
+  rootNode.addChild(childNode);
+  childNode.addChild(grandchildNode);
+
+  world.update(0.f);
+  CHECK(sceneGraph.getNodeCount() == 3);
+  CHECK(sceneGraph.getHierarchyCount() == 1);
+
+  const Raz::Vec4f origin(0.f, 0.f, 0.f, 1.f);
+  CHECK(origin * rootNode.getWorldMatrix() == Raz::Vec4f(1.f, 0.f, 0.f, 1.f));
+  CHECK(origin * childNode.getWorldMatrix() == Raz::Vec4f(1.f, 2.f, 0.f, 1.f));
+  CHECK(Raz::Vec4f(1.f, 0.f, 0.f, 1.f) * childNode.getWorldMatrix() == Raz::Vec4f(3.f, 2.f, 0.f, 1.f));
+  CHECK(grandchildNode.getWorldMatrix() == childNode.getWorldMatrix());
+
+  // A modified transform updates the matrices of its node & of all the node's descendants
+  root.getMutableComponent<Raz::Transform>().translate(0.f, 0.f, 3.f);
+  world.update(0.f);
+  CHECK(origin * rootNode.getWorldMatrix() == Raz::Vec4f(1.f, 0.f, 3.f, 1.f));
+  CHECK(origin * grandchildNode.getWorldMatrix() == Raz::Vec4f(1.f, 2.f, 3.f, 1.f));
+
+  // Matrices are cached: a transform modified without being marked as such isn't taken into account
+  auto& childTransform = child.getComponent<Raz::Transform>();
+  world.update(0.f);
+  childTransform.translate(0.f, 10.f, 0.f);
+  world.update(0.f);
+  CHECK(origin * childNode.getWorldMatrix() == Raz::Vec4f(1.f, 2.f, 3.f, 1.f));
+
+  // Changing the hierarchy recomputes everything
+  childNode.detach();
+  world.update(0.f);
+  CHECK(sceneGraph.getHierarchyCount() == 2);
+  CHECK(origin * childNode.getWorldMatrix() == Raz::Vec4f(0.f, 12.f, 0.f, 1.f));
+  CHECK(origin * grandchildNode.getWorldMatrix() == Raz::Vec4f(0.f, 12.f, 0.f, 1.f));
+
+  // Destroying a parent entity makes its children roots
+  world.destroyEntity(child);
+  world.update(0.f);
+  CHECK(sceneGraph.getNodeCount() == 2);
+  CHECK(sceneGraph.getHierarchyCount() == 2);
+  CHECK(grandchildNode.isRoot());
+  CHECK(grandchildNode.getWorldMatrix() == Raz::Mat4f::identity());
+}
+
+TEST_CASE("SceneGraphSystem independent worlds") {
+  Raz::World firstWorld;
+  firstWorld.addSystem<Raz::SceneGraphSystem>();
+
+  Raz::World secondWorld;
+  auto& secondSceneGraph = secondWorld.addSystem<Raz::SceneGraphSystem>();
+
+  Raz::Entity& firstParent = firstWorld.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(1.f, 0.f, 0.f));
+  auto& firstParentNode    = firstParent.addComponent<Raz::SceneNode>();
+  Raz::Entity& firstChild  = firstWorld.addEntityWithComponent<Raz::Transform>();
+  auto& firstChildNode     = firstChild.addComponent<Raz::SceneNode>();
+
+  Raz::Entity& secondParent = secondWorld.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.f, 1.f, 0.f));
+  auto& secondParentNode    = secondParent.addComponent<Raz::SceneNode>();
+  Raz::Entity& secondChild  = secondWorld.addEntityWithComponent<Raz::Transform>();
+  auto& secondChildNode     = secondChild.addComponent<Raz::SceneNode>();
+
+  firstWorld.update(0.f);
+  secondWorld.update(0.f);
+  CHECK(secondSceneGraph.getHierarchyCount() == 2);
+
+  // A transform modified without being marked as such is only taken into account if the hierarchies are rebuilt
+  secondParent.getComponent<Raz::Transform>().translate(0.f, 10.f, 0.f);
+
+  // Editing the first world's hierarchy doesn't make the second world's system rebuild its own
+  firstParentNode.addChild(firstChildNode);
+  firstWorld.update(0.f);
+  secondWorld.update(0.f);
+
+  const Raz::Vec4f origin(0.f, 0.f, 0.f, 1.f);
+  CHECK(origin * firstChildNode.getWorldMatrix() == Raz::Vec4f(1.f, 0.f, 0.f, 1.f));
+  CHECK(secondSceneGraph.getHierarchyCount() == 2);
+  CHECK(origin * secondParentNode.getWorldMatrix() == Raz::Vec4f(0.f, 1.f, 0.f, 1.f));
+
+  // Editing its own hierarchy does
+  secondParentNode.addChild(secondChildNode);
+  secondWorld.update(0.f);
+  CHECK(secondSceneGraph.getHierarchyCount() == 1);
+  CHECK(origin * secondParentNode.getWorldMatrix() == Raz::Vec4f(0.f, 11.f, 0.f, 1.f));
+  CHECK(origin * secondChildNode.getWorldMatrix() == Raz::Vec4f(0.f, 11.f, 0.f, 1.f));
+}
+
+TEST_CASE("SceneGraphSystem parallel update") {
+  Raz::World world;
+  auto& sceneGraph = world.addSystem<Raz::SceneGraphSystem>();
+  sceneGraph.setParallelThreshold(0);
+
+  constexpr std::size_t hierarchyCount = 50;
+  constexpr std::size_t hierarchyDepth = 10;
+
+  std::vector<Raz::SceneNode*> leaves;
+
+  for (std::size_t hierarchyIndex = 0; hierarchyIndex < hierarchyCount; ++hierarchyIndex) {
+    Raz::SceneNode* parent = nullptr;
+
+    for (std::size_t depth = 0; depth < hierarchyDepth; ++depth) {
+      Raz::Entity& entity = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(static_cast<float>(hierarchyIndex), 1.f, 0.f));
+      auto& node          = entity.addComponent<Raz::SceneNode>();
+
+      if (parent)
+        parent->addChild(node);
+
+      parent = &node;
+    }
+
+    leaves.emplace_back(parent);
+  }
+
+  world.update(0.f);
+  CHECK(sceneGraph.getNodeCount() == hierarchyCount * hierarchyDepth);
+  CHECK(sceneGraph.getHierarchyCount() == hierarchyCount);
+
+  for (std::size_t hierarchyIndex = 0; hierarchyIndex < hierarchyCount; ++hierarchyIndex) {
+    const float expectedX = static_cast<float>(hierarchyIndex * hierarchyDepth);
+    CHECK(Raz::Vec4f(0.f, 0.f, 0.f, 1.f) * leaves[hierarchyIndex]->getWorldMatrix() == Raz::Vec4f(expectedX, 10.f, 0.f, 1.f));
+  }
+}
@@ -0,0 +1,118 @@
+#include "Catch.hpp"
+
+#include "RaZ/World.hpp"
+#include "RaZ/Math/SceneGraphSystem.hpp"
+#include "RaZ/Math/SceneNode.hpp"
+#include "RaZ/Math/SpatialIndexSystem.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Render/Mesh.hpp"
+
+#include <algorithm>
+
+namespace {
+
+Raz::Entity& addBoxEntity(Raz::World& world, const Raz::Vec3f& position) {
+  Raz::Entity& entity = world.addEntity();
+  entity.addComponent<Raz::Mesh>(Raz::AABB(Raz::Vec3f(-0.5f), Raz::Vec3f(0.5f))).computeBoundingBox();
+  entity.addComponent<Raz::Transform>(position);
+  return entity;
+}
+
+bool containsEntity(const std::vector<Raz::Entity*>& entities, const Raz::Entity& entity) {
+  return (std::find(entities.cbegin(), entities.cend(), &entity) != entities.cend());
+}
+
+} // namespace
+
+TEST_CASE("SpatialIndexSystem queries") {
+  Raz::World world;
+  auto& spatialIndex = world.addSystem<Raz::SpatialIndexSystem>(0.f);
+
+  Raz::Entity& originEntity = addBoxEntity(world, Raz::Vec3f(0.f));
+  Raz::Entity& farEntity    = addBoxEntity(world, Raz::Vec3f(10.f, 0.f, 0.f));
+  world.addEntityWithComponent<Raz::Transform>(); // Without a mesh, the entity isn't indexed
+
+  world.update(0.f);
+  CHECK(spatialIndex.getTree().getProxyCount() == 2);
+
+  std::vector<Raz::Entity*> entities = spatialIndex.query(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f)));
+  REQUIRE(entities.size() == 1);
+  CHECK(entities.front() == &originEntity);
+
+  entities = spatialIndex.query(Raz::Sphere(Raz::Vec3f(9.f, 0.f, 0.f), 1.f));
+  REQUIRE(entities.size() == 1);
+  CHECK(entities.front() == &farEntity);
+
+  const std::vector<std::pair<Raz::Entity*, float>> hits = spatialIndex.raycast(Raz::Ray(Raz::Vec3f(-5.f, 0.f, 0.f), Raz::Axis::X));
+  REQUIRE(hits.size() == 2);
+  CHECK(hits[0].first == &originEntity);
+  CHECK(hits[0].second == 4.5f);
+  CHECK(hits[1].first == &farEntity);
+  CHECK(hits[1].second == 14.5f);
+
+  const std::vector<std::vector<Raz::Entity*>> batchedEntities = spatialIndex.query(std::vector<Raz::Sphere>{
+    Raz::Sphere(Raz::Vec3f(0.f), 1.f),
+    Raz::Sphere(Raz::Vec3f(5.f, 0.f, 0.f), 1.f),
+    Raz::Sphere(Raz::Vec3f(5.f, 0.f, 0.f), 10.f)
+  });
+  REQUIRE(batchedEntities.size() == 3);
+  CHECK(batchedEntities[0] == std::vector<Raz::Entity*>({ &originEntity }));
+  CHECK(batchedEntities[1].empty());
+  CHECK(batchedEntities[2].size() == 2);
+
+  // Removing the mesh unlinks the entity from the system, removing it from the index
+  farEntity.removeComponent<Raz::Mesh>();
+  world.update(0.f);
+  CHECK(spatialIndex.getTree().getProxyCount() == 1);
+  CHECK(spatialIndex.query(Raz::Sphere(Raz::Vec3f(10.f, 0.f, 0.f), 1.f)).empty());
+}
+
+TEST_CASE("SpatialIndexSystem incremental update") {
+  Raz::World world;
+  auto& spatialIndex = world.addSystem<Raz::SpatialIndexSystem>(0.f);
+
+  Raz::Entity& entity = addBoxEntity(world, Raz::Vec3f(0.f));
+  world.update(0.f);
+  CHECK(containsEntity(spatialIndex.query(Raz::Sphere(Raz::Vec3f(0.f), 0.1f)), entity));
+
+  // Moving the entity through its Transform moves it in the index on the next update
+  entity.getMutableComponent<Raz::Transform>().setPosition(Raz::Vec3f(0.f, 5.f, 0.f));
+  world.update(0.f);
+  CHECK(spatialIndex.query(Raz::Sphere(Raz::Vec3f(0.f), 0.1f)).empty());
+  CHECK(containsEntity(spatialIndex.query(Raz::Sphere(Raz::Vec3f(0.f, 5.f, 0.f), 0.1f)), entity));
+
+  // The box follows the entity's scale & rotation
+  entity.getMutableComponent<Raz::Transform>().setScale(4.f);
+  world.update(0.f);
+  CHECK(containsEntity(spatialIndex.query(Raz::Sphere(Raz::Vec3f(0.f, 6.5f, 0.f), 0.1f)), entity));
+
+  // Removing the Transform places the box back at its local position
+  entity.removeComponent<Raz::Transform>();
+  world.update(0.f);
+  CHECK(containsEntity(spatialIndex.query(Raz::Sphere(Raz::Vec3f(0.f), 0.1f)), entity));
+}
+
+TEST_CASE("SpatialIndexSystem scene graph") {
+  Raz::World world;
+  world.addSystem<Raz::SceneGraphSystem>();
+  auto& spatialIndex = world.addSystem<Raz::SpatialIndexSystem>(0.f);
+
+  Raz::Entity& parent = world.addEntity();
+  parent.addComponent<Raz::Transform>(Raz::Vec3f(10.f, 0.f, 0.f));
+  auto& parentNode = parent.addComponent<Raz::SceneNode>();
+
+  Raz::Entity& child = addBoxEntity(world, Raz::Vec3f(0.f, 2.f, 0.f));
+  child.addComponent<Raz::SceneNode>().setParent(parentNode);
+
+  // The systems being updated in the order of their IDs, the index may only get the world matrices computed on the previous update
+  world.update(0.f);
+  world.update(0.f);
+  CHECK(containsEntity(spatialIndex.query(Raz::Sphere(Raz::Vec3f(10.f, 2.f, 0.f), 0.1f)), child));
+
+  // Moving the parent moves its child in the index
+  parent.getMutableComponent<Raz::Transform>().setPosition(Raz::Vec3f(-10.f, 0.f, 0.f));
+  world.update(0.f);
+  world.update(0.f);
+  CHECK(spatialIndex.query(Raz::Sphere(Raz::Vec3f(10.f, 2.f, 0.f), 0.1f)).empty());
+  CHECK(containsEntity(spatialIndex.query(Raz::Sphere(Raz::Vec3f(-10.f, 2.f, 0.f), 0.1f)), child));
+}
@@ -0,0 +1,112 @@
+#include "Catch.hpp"
+
+#include "RaZ/Prefab.hpp"
+#include "RaZ/System.hpp"
+#include "RaZ/World.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Physics/RigidBody.hpp"
+
+namespace {
+
+class RigidBodySystem final : public Raz::System {
+public:
+  RigidBodySystem() { m_acceptedComponents.setBit(Raz::Component::getId<Raz::RigidBody>()); }
+
+  const std::vector<Raz::Entity*>& getEntities() const { return m_entities; }
+
+  bool update(float /* deltaTime */) override { return true; }
+};
+
+} // namespace
+
+TEST_CASE("Prefab components") {
+  Raz::Prefab prefab;
+  CHECK(prefab.getComponentCount() == 0);
+  CHECK_FALSE(prefab.hasComponent<Raz::Transform>());
+  CHECK_THROWS(prefab.getComponent<Raz::Transform>());
+
+  prefab.addComponent<Raz::Transform>(Raz::Vec3f(1.f, 2.f, 3.f));
+  prefab.addComponent<Raz::RigidBody>(10.f, 0.5f);
+  CHECK(prefab.getComponentCount() == 2);
+  CHECK(prefab.hasComponent<Raz::Transform>());
+  CHECK(prefab.hasComponent<Raz::RigidBody>());
+  CHECK(prefab.getSignature()[Raz::Component::getId<Raz::Transform>()]);
+
+  prefab.getComponent<Raz::Transform>().setScale(2.f);
+  CHECK(prefab.getComponent<Raz::Transform>().getScale() == Raz::Vec3f(2.f));
+
+  // Adding a component of the same type replaces it
+  prefab.addComponent<Raz::RigidBody>(5.f, 0.f);
+  CHECK(prefab.getComponentCount() == 2);
+  CHECK(prefab.getComponent<Raz::RigidBody>().getMass() == 5.f);
+
+  prefab.removeComponent<Raz::RigidBody>();
+  CHECK(prefab.getComponentCount() == 1);
+  CHECK_FALSE(prefab.hasComponent<Raz::RigidBody>());
+}
+
+TEST_CASE("Prefab instantiation") {
+  Raz::World world;
+  const auto& system = world.addSystem<RigidBodySystem>();
+
+  Raz::Prefab prefab;
+  prefab.addComponent<Raz::Transform>(Raz::Vec3f(1.f, 2.f, 3.f));
+  prefab.addComponent<Raz::RigidBody>(10.f, 0.5f);
+
+  CHECK(world.instantiate(prefab, 0).empty());
+
+  const std::vector<Raz::Entity*> entities = world.instantiate(prefab, 100);
+  REQUIRE(entities.size() == 100);
+  CHECK(world.getEntities().size() == 100);
+
+  for (const Raz::Entity* entity : entities) {
+    CHECK(entity->isEnabled());
+    CHECK(entity->isDirty());
+    REQUIRE(entity->hasComponent<Raz::Transform>());
+    REQUIRE(entity->hasComponent<Raz::RigidBody>());
+    CHECK(entity->getComponent<Raz::Transform>().getPosition() == Raz::Vec3f(1.f, 2.f, 3.f));
+    CHECK(entity->getComponent<Raz::RigidBody>().getMass() == 10.f);
+    CHECK(entity->getArchetype() == entities.front()->getArchetype());
+    CHECK(world.isValid(entity->getHandle()));
+  }
+
+  // Each entity holds its own copies of the components
+  entities.front()->getComponent<Raz::Transform>().setPosition(Raz::Vec3f(0.f));
+  CHECK(entities.back()->getComponent<Raz::Transform>().getPosition() == Raz::Vec3f(1.f, 2.f, 3.f));
+  CHECK(prefab.getComponent<Raz::Transform>().getPosition() == Raz::Vec3f(1.f, 2.f, 3.f));
+
+  const Raz::Archetype& archetype = *entities.front()->getArchetype();
+  CHECK(archetype.getEntityCount() == 100);
+  CHECK(archetype.getColumn(Raz::Component::getId<Raz::RigidBody>())[42] == &entities[42]->getComponent<Raz::RigidBody>());
+
+  // The instantiated entities are linked to the systems on the next refresh
+  CHECK(system.getEntities().empty());
+  world.refresh();
+  CHECK(system.getEntities().size() == 100);
+
+  // The components can be queried like any other
+  std::size_t queriedCount = 0;
+  world.query<const Raz::Transform, const Raz::RigidBody>().forEach([&queriedCount] (const Raz::Transform&, const Raz::RigidBody&) {
+    ++queriedCount;
+  });
+  CHECK(queriedCount == 100);
+
+  // Destroyed entities' indices are reused by the next instantiated ones
+  for (std::size_t entityIndex = 0; entityIndex < 10; ++entityIndex)
+    world.destroyEntity(*entities[entityIndex]);
+  world.refresh();
+
+  Raz::Entity& entity = *world.instantiate(prefab, 1, false).front();
+  CHECK(entity.getId() < 100);
+  CHECK_FALSE(entity.isEnabled());
+  CHECK(entity.getArchetype() == nullptr);
+  CHECK(entity.hasComponent<Raz::RigidBody>());
+  CHECK(world.getEntities().size() == 91);
+
+  // Modifying the prefab only affects the entities instantiated afterward
+  prefab.removeComponent<Raz::RigidBody>();
+  const Raz::Entity& transformEntity = *world.instantiate(prefab, 1).front();
+  CHECK(transformEntity.hasComponent<Raz::Transform>());
+  CHECK_FALSE(transformEntity.hasComponent<Raz::RigidBody>());
+  CHECK(entities.back()->hasComponent<Raz::RigidBody>());
+}
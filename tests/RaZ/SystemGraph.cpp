@@ -0,0 +1,177 @@
+#include "Catch.hpp"
+
+#include "RaZ/World.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Physics/RigidBody.hpp"
+
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+std::mutex updateMutex;
+std::vector<std::size_t> updatedSystems;
+std::thread::id mainThreadSystemId;
+
+template <typename Sys>
+void recordUpdate() {
+  std::lock_guard<std::mutex> lock(updateMutex);
+  updatedSystems.emplace_back(Raz::System::getId<Sys>());
+}
+
+std::size_t getUpdatePosition(std::size_t systemId) {
+  return static_cast<std::size_t>(std::distance(updatedSystems.cbegin(), std::find(updatedSystems.cbegin(), updatedSystems.cend(), systemId)));
+}
+
+class TransformReader final : public Raz::System {
+public:
+  TransformReader() { registerReadComponents<Raz::Transform>(); }
+
+  bool update(float) override { recordUpdate<TransformReader>(); return true; }
+};
+
+class TransformWriter final : public Raz::System {
+public:
+  TransformWriter() { registerReadComponents<Raz::RigidBody>(); registerWrittenComponents<Raz::Transform>(); }
+
+  bool update(float) override { recordUpdate<TransformWriter>(); return true; }
+};
+
+class RigidBodyWriter final : public Raz::System {
+public:
+  RigidBodyWriter() { registerWrittenComponents<Raz::RigidBody>(); }
+
+  bool update(float) override { recordUpdate<RigidBodyWriter>(); return m_isActive; }
+
+  bool m_isActive = true;
+};
+
+class MainThreadSystem final : public Raz::System {
+public:
+  MainThreadSystem() { registerReadComponents<Raz::Transform>(); requireMainThread(); }
+
+  bool update(float) override {
+    recordUpdate<MainThreadSystem>();
+    mainThreadSystemId = std::this_thread::get_id();
+
+    if (m_mustThrow)
+      throw std::runtime_error("Error: Test exception");
+
+    return true;
+  }
+
+  bool m_mustThrow = false;
+};
+
+class UndeclaredSystem final : public Raz::System {
+public:
+  bool update(float) override { recordUpdate<UndeclaredSystem>(); return true; }
+};
+
+} // namespace
+
+TEST_CASE("System conflicts") {
+  const TransformReader reader;
+  const TransformWriter transformWriter;
+  const RigidBodyWriter rigidBodyWriter;
+  const MainThreadSystem mainThreadSystem;
+  const UndeclaredSystem undeclaredSystem;
+
+  CHECK(reader.hasDeclaredAccesses());
+  CHECK_FALSE(undeclaredSystem.hasDeclaredAccesses());
+
+  CHECK_FALSE(reader.isMainThreadRequired());
+  CHECK(mainThreadSystem.isMainThreadRequired());
+  CHECK(undeclaredSystem.isMainThreadRequired());
+
+  // Systems only reading the same components don't conflict
+  CHECK_FALSE(reader.conflictsWith(mainThreadSystem));
+  CHECK_FALSE(reader.conflictsWith(rigidBodyWriter));
+
+  // A system writing components another one reads or writes conflicts with it, whichever is checked against the other
+  CHECK(reader.conflictsWith(transformWriter));
+  CHECK(transformWriter.conflictsWith(reader));
+  CHECK(transformWriter.conflictsWith(rigidBodyWriter));
+  CHECK(rigidBodyWriter.conflictsWith(transformWriter));
+
+  // A system not having declared its accesses conflicts with every other
+  CHECK(undeclaredSystem.conflictsWith(reader));
+  CHECK(reader.conflictsWith(undeclaredSystem));
+}
+
+TEST_CASE("SystemGraph ordering") {
+  Raz::World world;
+
+  world.addSystem<TransformReader>();
+  world.addSystem<TransformWriter>();
+  world.addSystem<RigidBodyWriter>();
+  world.addSystem<MainThreadSystem>();
+
+  CHECK(world.getSystemGraph().getGraph().getNodes().empty()); // The graph is built on the next update
+
+  updatedSystems.clear();
+  CHECK(world.update(0.f));
+
+  const std::vector<std::unique_ptr<Raz::SystemNode>>& nodes = world.getSystemGraph().getGraph().getNodes();
+  REQUIRE(nodes.size() == 4);
+
+  // The systems are ordered by their IDs; the transform writer conflicts with both readers & the rigid body writer
+  CHECK(nodes[0]->getParentCount() == 0); // Transform reader
+  CHECK(nodes[1]->getParentCount() == 1); // Transform writer
+  CHECK(nodes[2]->getParentCount() == 1); // Rigid body writer
+  CHECK(nodes[3]->getParentCount() == 1); // Main thread system
+
+  REQUIRE(updatedSystems.size() == 4);
+
+  const std::size_t writerPos = getUpdatePosition(Raz::System::getId<TransformWriter>());
+  CHECK(getUpdatePosition(Raz::System::getId<TransformReader>()) < writerPos);
+  CHECK(writerPos < getUpdatePosition(Raz::System::getId<RigidBodyWriter>()));
+  CHECK(writerPos < getUpdatePosition(Raz::System::getId<MainThreadSystem>()));
+  CHECK(mainThreadSystemId == std::this_thread::get_id());
+
+  // A system added later isn't concurrent with any other, & is thus updated after all the previous ones
+  world.addSystem<UndeclaredSystem>();
+
+  updatedSystems.clear();
+  world.update(0.f);
+
+  REQUIRE(updatedSystems.size() == 5);
+  CHECK(updatedSystems.back() == Raz::System::getId<UndeclaredSystem>());
+  CHECK(nodes.size() == 5);
+  CHECK(nodes.back()->getParentCount() == 4);
+}
+
+TEST_CASE("SystemGraph deactivation & exceptions") {
+  Raz::World world;
+
+  world.addSystem<TransformReader>();
+  auto& rigidBodyWriter  = world.addSystem<RigidBodyWriter>();
+  auto& mainThreadSystem = world.addSystem<MainThreadSystem>();
+
+  // A system becoming inactive isn't updated anymore
+  rigidBodyWriter.m_isActive = false;
+
+  updatedSystems.clear();
+  CHECK(world.update(0.f));
+  CHECK(updatedSystems.size() == 3);
+
+  updatedSystems.clear();
+  CHECK(world.update(0.f));
+  CHECK(updatedSystems.size() == 2);
+  CHECK(getUpdatePosition(Raz::System::getId<RigidBodyWriter>()) == updatedSystems.size());
+
+  // An exception thrown by a system is forwarded once all the others have been updated
+  mainThreadSystem.m_mustThrow = true;
+
+  updatedSystems.clear();
+  CHECK_THROWS_AS(world.update(0.f), std::runtime_error);
+  CHECK(updatedSystems.size() == 2);
+
+  // Removing a system takes it out of the graph
+  world.removeSystem<MainThreadSystem>();
+
+  updatedSystems.clear();
+  CHECK(world.update(0.f));
+  CHECK(updatedSystems == std::vector<std::size_t>({ Raz::System::getId<TransformReader>() }));
+}
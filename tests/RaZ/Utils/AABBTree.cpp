@@ -0,0 +1,114 @@
+#include "Catch.hpp"
+
+#include "RaZ/Utils/AABBTree.hpp"
+
+#include <algorithm>
+
+namespace {
+
+template <typename ShapeT>
+std::vector<int> queryValues(const Raz::AABBTree<int>& tree, const ShapeT& shape) {
+  std::vector<int> values;
+  tree.query(shape, [&values] (int value) { values.emplace_back(value); });
+  std::sort(values.begin(), values.end());
+  return values;
+}
+
+} // namespace
+
+TEST_CASE("AABBTree insertion & removal") {
+  Raz::AABBTree<int> tree(0.5f);
+  CHECK(tree.isEmpty());
+  CHECK(tree.getHeight() == 0);
+  CHECK(tree.getMargin() == 0.5f);
+
+  const std::size_t firstProxy = tree.insert(Raz::AABB(Raz::Vec3f(0.f), Raz::Vec3f(1.f)), 1);
+  CHECK(tree.getProxyCount() == 1);
+  CHECK(tree.getHeight() == 1);
+  CHECK(tree.getValue(firstProxy) == 1);
+
+  // The stored box is enlarged by the margin on each side
+  CHECK(tree.getFatBox(firstProxy).getLeftBottomBackPos() == Raz::Vec3f(-0.5f));
+  CHECK(tree.getFatBox(firstProxy).getRightTopFrontPos() == Raz::Vec3f(1.5f));
+
+  const std::size_t secondProxy = tree.insert(Raz::AABB(Raz::Vec3f(5.f), Raz::Vec3f(6.f)), 2);
+  CHECK(tree.getProxyCount() == 2);
+  CHECK(tree.getHeight() == 2);
+  CHECK(tree.getValue(secondProxy) == 2);
+
+  tree.remove(firstProxy);
+  CHECK(tree.getProxyCount() == 1);
+  CHECK(tree.getHeight() == 1);
+  CHECK(tree.getValue(secondProxy) == 2);
+
+  // Removed proxies' IDs are reused
+  CHECK(tree.insert(Raz::AABB(Raz::Vec3f(0.f), Raz::Vec3f(1.f)), 3) == firstProxy);
+
+  tree.clear();
+  CHECK(tree.isEmpty());
+  CHECK(tree.getHeight() == 0);
+}
+
+TEST_CASE("AABBTree balancing") {
+  Raz::AABBTree<int> tree;
+
+  // Inserting boxes in a line is the worst case for an unbalanced tree, whose height would then grow linearly
+  for (int i = 0; i < 1024; ++i)
+    tree.insert(Raz::AABB(Raz::Vec3f(static_cast<float>(i), 0.f, 0.f), Raz::Vec3f(static_cast<float>(i) + 0.5f, 0.5f, 0.5f)), i);
+
+  CHECK(tree.getProxyCount() == 1024);
+  CHECK(tree.getHeight() <= 20);
+}
+
+TEST_CASE("AABBTree update") {
+  Raz::AABBTree<int> tree(0.5f);
+  const std::size_t proxyId = tree.insert(Raz::AABB(Raz::Vec3f(0.f), Raz::Vec3f(1.f)), 1);
+
+  // Moving the box inside its enlarged one doesn't modify the tree
+  CHECK_FALSE(tree.update(proxyId, Raz::AABB(Raz::Vec3f(0.25f), Raz::Vec3f(1.25f))));
+  CHECK(tree.getFatBox(proxyId).getLeftBottomBackPos() == Raz::Vec3f(-0.5f));
+
+  CHECK(tree.update(proxyId, Raz::AABB(Raz::Vec3f(10.f), Raz::Vec3f(11.f))));
+  CHECK(tree.getFatBox(proxyId).getLeftBottomBackPos() == Raz::Vec3f(9.5f));
+  CHECK(tree.getValue(proxyId) == 1);
+
+  CHECK(queryValues(tree, Raz::AABB(Raz::Vec3f(0.f), Raz::Vec3f(1.f))).empty());
+  CHECK(queryValues(tree, Raz::AABB(Raz::Vec3f(10.f), Raz::Vec3f(11.f))) == std::vector<int>({ 1 }));
+}
+
+TEST_CASE("AABBTree queries") {
+  Raz::AABBTree<int> tree(0.f);
+
+  // Boxes of size 1 placed every 2 units on a 10x10 grid in the XY plane, each holding its index
+  for (int y = 0; y < 10; ++y) {
+    for (int x = 0; x < 10; ++x) {
+      const Raz::Vec3f minPos(static_cast<float>(x) * 2.f, static_cast<float>(y) * 2.f, 0.f);
+      tree.insert(Raz::AABB(minPos, minPos + Raz::Vec3f(1.f)), y * 10 + x);
+    }
+  }
+
+  CHECK(queryValues(tree, Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(-0.5f))).empty());
+  CHECK(queryValues(tree, Raz::AABB(Raz::Vec3f(0.5f), Raz::Vec3f(2.5f))) == std::vector<int>({ 0, 1, 10, 11 }));
+  CHECK(queryValues(tree, Raz::AABB(Raz::Vec3f(-100.f), Raz::Vec3f(100.f))).size() == 100);
+
+  CHECK(queryValues(tree, Raz::Sphere(Raz::Vec3f(4.5f, 4.5f, 0.5f), 0.1f)) == std::vector<int>({ 22 }));
+  CHECK(queryValues(tree, Raz::Sphere(Raz::Vec3f(3.5f, 3.5f, 0.5f), 0.5f)).empty());
+  CHECK(queryValues(tree, Raz::Sphere(Raz::Vec3f(3.5f, 3.5f, 0.5f), 1.f)) == std::vector<int>({ 11, 12, 21, 22 }));
+
+  // Ray going along the X axis on the third row
+  const Raz::Ray ray(Raz::Vec3f(-1.f, 4.5f, 0.5f), Raz::Axis::X);
+  CHECK(queryValues(tree, ray) == std::vector<int>({ 20, 21, 22, 23, 24, 25, 26, 27, 28, 29 }));
+
+  std::vector<std::pair<int, float>> hits;
+  tree.raycast(ray, 5.f, [&hits] (int value, float distance) { hits.emplace_back(value, distance); });
+  std::sort(hits.begin(), hits.end());
+
+  REQUIRE(hits.size() == 3);
+  CHECK(hits[0] == std::make_pair(20, 1.f));
+  CHECK(hits[1] == std::make_pair(21, 3.f));
+  CHECK(hits[2] == std::make_pair(22, 5.f));
+
+  // Orthographic-like frustum keeping the points in [-1; 1] on X & Y, & in [0; 1] on Z
+  const Raz::Frustum frustum(Raz::Mat4f::identity());
+  CHECK(queryValues(tree, frustum) == std::vector<int>({ 0 }));
+}
@@ -3,6 +3,7 @@
 #include "RaZ/Utils/Bitset.hpp"
 
 #include <sstream>
+#include <vector>
 
 namespace {
 
@@ -36,6 +37,86 @@ TEST_CASE("Bitset basic") {
 
   compBitset.resize(7);
   CHECK_FALSE(compBitset.getSize() == fullZeros.getSize());
+  CHECK_FALSE(compBitset == fullZeros); // Bitsets of different sizes are never equal
+}
+
+TEST_CASE("Bitset queries") {
+  CHECK(fullZeros.findFirstEnabledBit() == fullZeros.getSize());
+  CHECK(fullZeros.findLastEnabledBit() == fullZeros.getSize());
+
+  CHECK(alternated1.findFirstEnabledBit() == 0);
+  CHECK(alternated1.findNextEnabledBit(1) == 2);
+  CHECK(alternated1.findNextEnabledBit(4) == 4);
+  CHECK(alternated1.findNextEnabledBit(5) == alternated1.getSize());
+  CHECK(alternated1.findLastEnabledBit() == 4);
+
+  CHECK(alternated2.findFirstEnabledBit() == 1);
+  CHECK(alternated2.findLastEnabledBit() == 5);
+
+  std::vector<std::size_t> enabledBits;
+  alternated2.forEachEnabledBit([&enabledBits] (std::size_t bitIndex) { enabledBits.emplace_back(bitIndex); });
+  CHECK(enabledBits == std::vector<std::size_t>({ 1, 3, 5 }));
+
+  CHECK(alternated1.intersects(fullOnes));
+  CHECK_FALSE(alternated1.intersects(alternated2));
+  CHECK_FALSE(alternated1.intersects(fullZeros));
+
+  CHECK(alternated1.isSubsetOf(fullOnes));
+  CHECK(fullZeros.isSubsetOf(alternated1));
+  CHECK_FALSE(alternated1.isSubsetOf(alternated2));
+  CHECK_FALSE(fullOnes.isSubsetOf(alternated1));
+
+  // A bitset is a subset of a smaller one if its extra bits are all disabled
+  CHECK(Raz::Bitset({ true, false, false, false }).isSubsetOf(Raz::Bitset({ true })));
+  CHECK_FALSE(Raz::Bitset({ true, false, false, true }).isSubsetOf(Raz::Bitset({ true })));
+}
+
+TEST_CASE("Bitset large") {
+  // Bitsets of more than 128 bits are stored on the heap; they must behave as the smaller ones
+  Raz::Bitset largeBitset(200);
+  CHECK(largeBitset.getSize() == 200);
+  CHECK(largeBitset.getWordCount() == 4);
+  CHECK(largeBitset.isEmpty());
+
+  largeBitset.setBit(3);
+  largeBitset.setBit(64);
+  largeBitset.setBit(199);
+  CHECK(largeBitset.getEnabledBitCount() == 3);
+  CHECK(largeBitset.findNextEnabledBit(4) == 64);
+  CHECK(largeBitset.findNextEnabledBit(65) == 199);
+  CHECK(largeBitset.findLastEnabledBit() == 199);
+
+  // Growing past the inline storage keeps the existing bits
+  Raz::Bitset growingBitset = alternated1;
+  growingBitset.setBit(300);
+  CHECK(growingBitset.getSize() == 301);
+  CHECK(growingBitset.getEnabledBitCount() == 4);
+  CHECK(growingBitset[0]);
+  CHECK_FALSE(growingBitset[1]);
+  CHECK(growingBitset[300]);
+
+  // Shrinking then growing again must not bring back previously enabled bits
+  growingBitset.resize(3);
+  CHECK(growingBitset == Raz::Bitset({ true, false, true }));
+  growingBitset.resize(301);
+  CHECK(growingBitset.getEnabledBitCount() == 2);
+
+  const Raz::Bitset largeOnes(200, true);
+  CHECK(largeOnes.getEnabledBitCount() == 200);
+  CHECK((~largeOnes).isEmpty());
+  CHECK((~largeBitset).getEnabledBitCount() == 197);
+  CHECK((largeOnes & largeBitset) == largeBitset);
+  CHECK((largeOnes ^ largeBitset) == ~largeBitset);
+
+  Raz::Bitset copiedBitset = largeBitset;
+  CHECK(copiedBitset == largeBitset);
+
+  Raz::Bitset movedBitset = std::move(copiedBitset);
+  CHECK(movedBitset == largeBitset);
+  CHECK(copiedBitset.getSize() == 0);
+
+  movedBitset = alternated1;
+  CHECK(movedBitset == alternated1);
 }
 
 TEST_CASE("Bitset manipulations") {
@@ -76,6 +157,23 @@ TEST_CASE("Bitset manipulations") {
   CHECK(~fullOnes == fullZeros);
   CHECK(~alternated1 == alternated2);
   CHECK(~alternated2 == alternated1);
+
+  // In-place operations only affect the bits common to both bitsets
+  Raz::Bitset inPlaceBitset(70, true);
+  inPlaceBitset &= alternated2;
+  CHECK(inPlaceBitset.getSize() == 70);
+  CHECK(inPlaceBitset.getEnabledBitCount() == 3 + 64);
+  CHECK_FALSE(inPlaceBitset[0]);
+  CHECK(inPlaceBitset[6]);
+
+  inPlaceBitset ^= fullOnes;
+  CHECK(inPlaceBitset.getEnabledBitCount() == 3 + 64);
+  CHECK(inPlaceBitset[0]);
+  CHECK_FALSE(inPlaceBitset[1]);
+
+  Raz::Bitset shortBitset = alternated1;
+  shortBitset |= Raz::Bitset(70, true);
+  CHECK(shortBitset == fullOnes);
 }
 
 TEST_CASE("Bitset shifts") {
@@ -91,6 +189,20 @@ TEST_CASE("Bitset shifts") {
   CHECK(shiftTest == alternated1);
 }
 
+TEST_CASE("Bitset hash") {
+  // Bitsets comparing equal must have the same hash, regardless of how their bits have been disabled
+  Raz::Bitset shiftedBitset = alternated1;
+  shiftedBitset <<= 1;
+  shiftedBitset >>= 1;
+
+  CHECK(shiftedBitset == alternated1);
+  CHECK(shiftedBitset.hash() == alternated1.hash());
+  CHECK(std::hash<Raz::Bitset>()(alternated1) == alternated1.hash());
+
+  CHECK(alternated1.hash() != alternated2.hash());
+  CHECK(alternated1.hash() != alternated1.hash(1));
+}
+
 TEST_CASE("Bitset printing") {
   std::stringstream stream;
 
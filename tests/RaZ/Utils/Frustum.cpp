@@ -0,0 +1,70 @@
+#include "Catch.hpp"
+
+#include "RaZ/Utils/Frustum.hpp"
+
+namespace {
+
+// Perspective projection looking towards +Z, with a 90° field of view, a square ratio, a near plane at 1 & a far plane at 10
+//
+//         \          /  Z = 10
+//          \        /
+//           \      /
+//            \____/     Z = 1
+//             \  /
+//              \/       Z = 0
+
+const Raz::Mat4f projMat(1.f, 0.f,  0.f,         0.f,
+                         0.f, 1.f,  0.f,         0.f,
+                         0.f, 0.f,  10.f / 9.f,  1.f,
+                         0.f, 0.f, -10.f / 9.f,  0.f);
+
+} // namespace
+
+TEST_CASE("Frustum planes extraction") {
+  const Raz::Frustum frustum(projMat);
+
+  for (const Raz::Plane& plane : frustum.getPlanes())
+    CHECK(plane.getNormal().computeLength() == Approx(1.f));
+
+  // The near & far planes face each other along the Z axis
+  CHECK(frustum.getPlanes()[4].getNormal() == Raz::Axis::Z);
+  CHECK(frustum.getPlanes()[5].getNormal() == -Raz::Axis::Z);
+}
+
+TEST_CASE("Frustum point containment") {
+  const Raz::Frustum frustum(projMat);
+
+  CHECK(frustum.contains(Raz::Vec3f(0.f, 0.f, 5.f)));
+  CHECK(frustum.contains(Raz::Vec3f(4.f, -4.f, 5.f)));
+  CHECK(frustum.contains(Raz::Vec3f(0.f, 0.f, 1.f)));
+  CHECK(frustum.contains(Raz::Vec3f(9.f, 9.f, 9.5f)));
+
+  CHECK_FALSE(frustum.contains(Raz::Vec3f(0.f, 0.f, 0.5f)));  // Before the near plane
+  CHECK_FALSE(frustum.contains(Raz::Vec3f(0.f, 0.f, 11.f)));  // Beyond the far plane
+  CHECK_FALSE(frustum.contains(Raz::Vec3f(6.f, 0.f, 5.f)));   // Right of the right plane
+  CHECK_FALSE(frustum.contains(Raz::Vec3f(0.f, -6.f, 5.f)));  // Below the bottom plane
+  CHECK_FALSE(frustum.contains(Raz::Vec3f(0.f, 0.f, -5.f)));  // Behind the viewer
+}
+
+TEST_CASE("Frustum-sphere intersection") {
+  const Raz::Frustum frustum(projMat);
+
+  CHECK(frustum.intersects(Raz::Sphere(Raz::Vec3f(0.f, 0.f, 5.f), 1.f)));
+  CHECK(frustum.intersects(Raz::Sphere(Raz::Vec3f(0.f, 0.f, 0.5f), 1.f))); // Crossing the near plane
+  CHECK(frustum.intersects(Raz::Sphere(Raz::Vec3f(6.f, 0.f, 5.f), 1.f)));  // Crossing the right plane
+
+  CHECK_FALSE(frustum.intersects(Raz::Sphere(Raz::Vec3f(0.f, 0.f, 12.f), 1.f)));
+  CHECK_FALSE(frustum.intersects(Raz::Sphere(Raz::Vec3f(8.f, 0.f, 5.f), 1.f)));
+}
+
+TEST_CASE("Frustum-AABB intersection") {
+  const Raz::Frustum frustum(projMat);
+
+  CHECK(frustum.intersects(Raz::AABB(Raz::Vec3f(-1.f, -1.f, 4.f), Raz::Vec3f(1.f, 1.f, 6.f))));
+  CHECK(frustum.intersects(Raz::AABB(Raz::Vec3f(-20.f, -20.f, -20.f), Raz::Vec3f(20.f, 20.f, 20.f)))); // Containing the whole frustum
+  CHECK(frustum.intersects(Raz::AABB(Raz::Vec3f(4.f, 0.f, 4.f), Raz::Vec3f(8.f, 1.f, 6.f))));          // Crossing the right plane
+
+  CHECK_FALSE(frustum.intersects(Raz::AABB(Raz::Vec3f(-1.f, -1.f, -6.f), Raz::Vec3f(1.f, 1.f, -4.f))));
+  CHECK_FALSE(frustum.intersects(Raz::AABB(Raz::Vec3f(7.f, 0.f, 4.f), Raz::Vec3f(8.f, 1.f, 6.f))));
+  CHECK_FALSE(frustum.intersects(Raz::Vec3f(-1.f, -1.f, 11.f), Raz::Vec3f(1.f, 1.f, 12.f)));
+}
@@ -0,0 +1,111 @@
+#include "Catch.hpp"
+
+#include "RaZ/Utils/MpmcQueue.hpp"
+
+#ifdef RAZ_THREADS_AVAILABLE
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+TEST_CASE("MpmcQueue basic") {
+  Raz::MpmcQueue<std::string> queue(1);
+  CHECK(queue.getCapacity() == 2); // The queue holds at least 2 elements
+  CHECK(queue.isEmpty());
+
+  std::string value;
+  CHECK_FALSE(queue.tryPop(value));
+
+  CHECK(queue.tryPush("first"));
+  CHECK(queue.tryEmplace(3, 'a'));
+  CHECK(queue.getSize() == 2);
+  CHECK_FALSE(queue.tryPush("third"));
+
+  CHECK(queue.tryPop(value));
+  CHECK(value == "first");
+  CHECK(queue.tryPush("third"));
+
+  CHECK(queue.tryPop(value));
+  CHECK(value == "aaa");
+  CHECK(queue.tryPop(value));
+  CHECK(value == "third");
+
+  CHECK(queue.isEmpty());
+  CHECK_FALSE(queue.tryPop(value));
+
+  // The remaining elements are destroyed with the queue
+  const auto sharedValue = std::make_shared<int>(0);
+
+  {
+    Raz::MpmcQueue<std::shared_ptr<int>> sharedQueue(4);
+    sharedQueue.tryPush(sharedValue);
+    sharedQueue.tryPush(sharedValue);
+    CHECK(sharedValue.use_count() == 3);
+  }
+
+  CHECK(sharedValue.use_count() == 1);
+}
+
+TEST_CASE("MpmcQueue stress") {
+  Raz::MpmcQueue<std::size_t> queue(64);
+
+  constexpr std::size_t threadCount         = 4;
+  constexpr std::size_t valueCountPerThread = 50'000;
+
+  std::vector<std::thread> threads;
+  std::vector<std::vector<std::size_t>> poppedValues(threadCount);
+  std::atomic<std::size_t> poppedCount {};
+
+  for (std::size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex) {
+    // Each producer pushes its own range of values
+    threads.emplace_back([&queue, threadIndex] () noexcept {
+      for (std::size_t valueIndex = 0; valueIndex < valueCountPerThread; ++valueIndex) {
+        while (!queue.tryPush(threadIndex * valueCountPerThread + valueIndex))
+          std::this_thread::yield();
+      }
+    });
+
+    threads.emplace_back([&queue, &poppedValues, &poppedCount, threadIndex] () {
+      std::size_t value {};
+
+      while (poppedCount < threadCount * valueCountPerThread) {
+        if (!queue.tryPop(value)) {
+          std::this_thread::yield();
+          continue;
+        }
+
+        poppedValues[threadIndex].emplace_back(value);
+        ++poppedCount;
+      }
+    });
+  }
+
+  for (std::thread& thread : threads)
+    thread.join();
+
+  CHECK(queue.isEmpty());
+
+  // Every value has been popped exactly once, & each consumer received each producer's values in order
+  std::vector<std::size_t> receivedCounts(threadCount * valueCountPerThread);
+  bool isInOrder = true;
+
+  for (const std::vector<std::size_t>& values : poppedValues) {
+    std::vector<std::size_t> lastValues(threadCount);
+    std::vector<bool> hasLastValues(threadCount);
+
+    for (std::size_t value : values) {
+      ++receivedCounts[value];
+
+      const std::size_t producerIndex = value / valueCountPerThread;
+      isInOrder = isInOrder && (!hasLastValues[producerIndex] || lastValues[producerIndex] < value);
+      lastValues[producerIndex]    = value;
+      hasLastValues[producerIndex] = true;
+    }
+  }
+
+  CHECK(isInOrder);
+  CHECK(std::all_of(receivedCounts.cbegin(), receivedCounts.cend(), [] (std::size_t count) { return (count == 1); }));
+}
+
+#endif // RAZ_THREADS_AVAILABLE
@@ -0,0 +1,95 @@
+#include "Catch.hpp"
+
+#include "RaZ/Utils/ObjectPool.hpp"
+
+#include <stdexcept>
+
+namespace {
+
+struct Value {
+  explicit Value(int val) : value{ val } {
+    if (val < 0)
+      throw std::invalid_argument("Error: Negative value");
+  }
+
+  int value {};
+  char padding[60] {};
+};
+
+} // namespace
+
+TEST_CASE("ObjectPool allocation") {
+  Raz::ObjectPool<Value> pool;
+  CHECK(pool.getObjectCount() == 0);
+  CHECK(pool.getChunkCount() == 0);
+  CHECK(pool.computeOccupancy() == 0.f);
+  CHECK(pool.computeFragmentation() == 0.f);
+
+  Value& value1 = pool.emplace(1);
+  Value& value2 = pool.emplace(2);
+  Value& value3 = pool.emplace(3);
+
+  CHECK(value1.value == 1);
+  CHECK(&value2 == &value1 + 1);
+  CHECK(&value3 == &value2 + 1);
+  CHECK(pool.getObjectCount() == 3);
+  CHECK(pool.getChunkCount() == 1);
+  CHECK(pool.getCapacity() == Raz::ObjectPool<Value>::ChunkCapacity);
+  CHECK(pool.computeOccupancy() == 3.f / static_cast<float>(Raz::ObjectPool<Value>::ChunkCapacity));
+
+  // Destroyed objects leave holes, reused first by the next objects
+  pool.destroy(value2);
+  CHECK(pool.getObjectCount() == 2);
+  CHECK(pool.getFreeSlotCount() == 1);
+  CHECK(pool.computeFragmentation() == 1.f / 3.f);
+
+  Value& value4 = pool.emplace(4);
+  CHECK(&value4 == &value1 + 1);
+  CHECK(pool.getFreeSlotCount() == 0);
+  CHECK(pool.computeFragmentation() == 0.f);
+
+  // A failed construction doesn't use the slot
+  pool.destroy(value1);
+  CHECK_THROWS(pool.emplace(-1));
+  CHECK(pool.getObjectCount() == 2);
+  CHECK(pool.getFreeSlotCount() == 1);
+  CHECK(&pool.emplace(5) == &value1);
+
+  // Filling the chunk allocates another one
+  for (std::size_t valueIndex = pool.getObjectCount(); valueIndex < Raz::ObjectPool<Value>::ChunkCapacity + 1; ++valueIndex)
+    pool.emplace(0);
+
+  CHECK(pool.getChunkCount() == 2);
+  CHECK(pool.getFreeSlotCount() == 0);
+}
+
+TEST_CASE("ObjectPool reservation") {
+  constexpr std::size_t chunkCapacity = Raz::ObjectPool<Value>::ChunkCapacity;
+
+  Raz::ObjectPool<Value> pool;
+  pool.reserve(chunkCapacity * 2 + 1);
+  CHECK(pool.getChunkCount() == 3);
+  CHECK(pool.getCapacity() == chunkCapacity * 3);
+  CHECK(pool.getObjectCount() == 0);
+
+  // Reserving less than the current capacity does nothing
+  pool.reserve(chunkCapacity);
+  CHECK(pool.getChunkCount() == 3);
+
+  // Reserved chunks are used in order before any new one is allocated
+  Value* firstValue = &pool.emplace(0);
+
+  for (std::size_t valueIndex = 1; valueIndex < chunkCapacity * 3; ++valueIndex)
+    pool.emplace(0);
+
+  CHECK(pool.getChunkCount() == 3);
+  CHECK(pool.computeOccupancy() == 1.f);
+
+  pool.destroy(*firstValue);
+  pool.reserve(chunkCapacity * 3);
+  CHECK(pool.getChunkCount() == 3);
+
+  pool.emplace(0);
+  pool.emplace(0);
+  CHECK(pool.getChunkCount() == 4);
+}
@@ -0,0 +1,147 @@
+#include "Catch.hpp"
+
+#include "RaZ/Math/Vector.hpp"
+#include "RaZ/Utils/ParallelAlgorithms.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+
+#ifdef RAZ_THREADS_AVAILABLE
+
+namespace {
+
+std::vector<int> createRandomValues(std::size_t valueCount) {
+  std::mt19937 randGen(42);
+  std::uniform_int_distribution<int> randDist(-1000, 1000);
+
+  std::vector<int> values(valueCount);
+
+  for (int& value : values)
+    value = randDist(randGen);
+
+  return values;
+}
+
+} // namespace
+
+TEST_CASE("ParallelAlgorithms grain size") {
+  // The grain size is never below the requested minimum, & always spans whole cache lines
+  CHECK(Raz::Threading::computeGrainSize(10, sizeof(int), 100) >= 100);
+  CHECK(Raz::Threading::computeGrainSize(1'000'000, sizeof(int)) % (64 / sizeof(int)) == 0);
+  CHECK(Raz::Threading::computeGrainSize(1'000'000, 3) % 21 == 0);
+  CHECK(Raz::Threading::computeGrainSize(1'000'000, 256) >= 2048);
+}
+
+TEST_CASE("ParallelAlgorithms sort") {
+  // Sizes below & above the threshold, the latter not being divisible by the amount of threads
+  for (const std::size_t valueCount : { 0, 1, 1000, 100'003 }) {
+    std::vector<int> values = createRandomValues(valueCount);
+    std::vector<int> expectedValues = values;
+
+    std::sort(expectedValues.begin(), expectedValues.end());
+    Raz::Threading::parallelSort(values.begin(), values.end());
+    CHECK(values == expectedValues);
+
+    std::sort(expectedValues.begin(), expectedValues.end(), std::greater<>());
+    Raz::Threading::parallelSort(values.begin(), values.end(), std::greater<>());
+    CHECK(values == expectedValues);
+  }
+
+  // Sorting elements by a key, many of them being equivalent
+  std::vector<std::pair<int, std::size_t>> keys(50'000);
+
+  for (std::size_t keyIndex = 0; keyIndex < keys.size(); ++keyIndex)
+    keys[keyIndex] = { static_cast<int>(keyIndex % 7), keyIndex };
+
+  Raz::Threading::parallelSort(keys.begin(), keys.end(), [] (const auto& key1, const auto& key2) { return key1.first < key2.first; });
+  CHECK(std::is_sorted(keys.cbegin(), keys.cend(), [] (const auto& key1, const auto& key2) { return key1.first < key2.first; }));
+}
+
+TEST_CASE("ParallelAlgorithms reduce") {
+  const std::vector<int> values = createRandomValues(100'003);
+
+  CHECK(Raz::Threading::parallelReduce(values.cbegin(), values.cend(), 0) == std::accumulate(values.cbegin(), values.cend(), 0));
+  CHECK(Raz::Threading::parallelReduce(values.cbegin(), values.cend(), 5, [] (int val1, int val2) { return std::max(val1, val2); }) == 1000);
+  CHECK(Raz::Threading::parallelReduce(values.cbegin(), values.cbegin(), 5) == 5);
+
+  // Computing a bounding box from points
+  std::vector<Raz::Vec3f> points(20'000);
+
+  for (std::size_t pointIndex = 0; pointIndex < points.size(); ++pointIndex)
+    points[pointIndex] = Raz::Vec3f(static_cast<float>(pointIndex), -static_cast<float>(pointIndex % 100), 1.f);
+
+  using Box = std::pair<Raz::Vec3f, Raz::Vec3f>;
+  const auto mergeBoxes = [] (Box box1, const Box& box2) {
+    for (std::size_t i = 0; i < 3; ++i) {
+      box1.first[i]  = std::min(box1.first[i], box2.first[i]);
+      box1.second[i] = std::max(box1.second[i], box2.second[i]);
+    }
+
+    return box1;
+  };
+
+  const Box initBox(Raz::Vec3f(std::numeric_limits<float>::max()), Raz::Vec3f(std::numeric_limits<float>::lowest()));
+  const Box box = Raz::Threading::parallelTransformReduce(points.cbegin(), points.cend(), initBox, mergeBoxes, [] (const Raz::Vec3f& point) {
+    return Box(point, point);
+  });
+
+  CHECK(box.first == Raz::Vec3f(0.f, -99.f, 1.f));
+  CHECK(box.second == Raz::Vec3f(19'999.f, 0.f, 1.f));
+
+  // The chunks' results are combined in order, allowing non-commutative operations
+  std::vector<std::string> letters(10'000);
+
+  for (std::size_t letterIndex = 0; letterIndex < letters.size(); ++letterIndex)
+    letters[letterIndex] = static_cast<char>('a' + letterIndex % 26);
+
+  CHECK(Raz::Threading::parallelReduce(letters.cbegin(), letters.cend(), std::string()) == std::accumulate(letters.cbegin(), letters.cend(), std::string()));
+}
+
+TEST_CASE("ParallelAlgorithms scan") {
+  for (const std::size_t valueCount : { 1000, 100'003 }) {
+    const std::vector<int> values = createRandomValues(valueCount);
+
+    std::vector<int> expectedValues(values.size());
+    std::vector<int> scannedValues(values.size());
+
+    std::inclusive_scan(values.cbegin(), values.cend(), expectedValues.begin());
+    CHECK(Raz::Threading::parallelInclusiveScan(values.cbegin(), values.cend(), scannedValues.begin()) == scannedValues.end());
+    CHECK(scannedValues == expectedValues);
+
+    std::exclusive_scan(values.cbegin(), values.cend(), expectedValues.begin(), 10);
+    CHECK(Raz::Threading::parallelExclusiveScan(values.cbegin(), values.cend(), scannedValues.begin(), 10) == scannedValues.end());
+    CHECK(scannedValues == expectedValues);
+
+    // The scan can be done in place
+    scannedValues = values;
+    Raz::Threading::parallelExclusiveScan(scannedValues.cbegin(), scannedValues.cend(), scannedValues.begin(), 10);
+    CHECK(scannedValues == expectedValues);
+
+    scannedValues = values;
+    Raz::Threading::parallelInclusiveScan(scannedValues.cbegin(), scannedValues.cend(), scannedValues.begin(), [] (int val1, int val2) {
+      return std::max(val1, val2);
+    });
+    CHECK(scannedValues.back() == *std::max_element(values.cbegin(), values.cend()));
+    CHECK(std::is_sorted(scannedValues.cbegin(), scannedValues.cend()));
+  }
+}
+
+TEST_CASE("ParallelAlgorithms partition") {
+  for (const std::size_t valueCount : { 0, 1000, 100'003 }) {
+    std::vector<int> values = createRandomValues(valueCount);
+    std::vector<int> expectedValues = values;
+
+    const auto isEven = [] (int value) { return (value % 2 == 0); };
+
+    const auto expectedPartitionPoint = std::stable_partition(expectedValues.begin(), expectedValues.end(), isEven);
+    const auto partitionPoint         = Raz::Threading::parallelPartition(values.begin(), values.end(), isEven);
+
+    // Both groups keep their elements' relative order
+    CHECK(std::distance(values.begin(), partitionPoint) == std::distance(expectedValues.begin(), expectedPartitionPoint));
+    CHECK(values == expectedValues);
+  }
+}
+
+#endif // RAZ_THREADS_AVAILABLE
@@ -0,0 +1,151 @@
+#include "Catch.hpp"
+
+#include "RaZ/Utils/Profiler.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+namespace {
+
+std::size_t countEvents(const Raz::ProfileCapture& capture, const std::string& name) {
+  return static_cast<std::size_t>(std::count_if(capture.getEvents().cbegin(), capture.getEvents().cend(), [&capture, &name] (const auto& event) {
+    return capture.getNames()[event.nameIndex] == name;
+  }));
+}
+
+} // namespace
+
+TEST_CASE("Profiler zones") {
+  Raz::Profiler::capture(); // Discarding the events that may have been recorded by other tests
+
+  {
+    const Raz::ProfileZone outerZone("Outer zone");
+    const Raz::ProfileZone innerZone("Inner zone");
+  }
+
+  std::thread([] () {
+    Raz::Profiler::setThreadName("Profiled thread");
+    const Raz::ProfileZone zone("Thread zone");
+  }).join();
+
+  // A disabled profiler doesn't record anything
+  Raz::Profiler::disable();
+  { const Raz::ProfileZone zone("Ignored zone"); }
+  Raz::Profiler::enable();
+
+  const Raz::ProfileCapture capture = Raz::Profiler::capture();
+  CHECK(countEvents(capture, "Outer zone") == 1);
+  CHECK(countEvents(capture, "Inner zone") == 1);
+  CHECK(countEvents(capture, "Thread zone") == 1);
+  CHECK(countEvents(capture, "Ignored zone") == 0);
+  CHECK(capture.getDroppedEventCount() == 0);
+
+  const auto findEvent = [&capture] (const std::string& name) {
+    return *std::find_if(capture.getEvents().cbegin(), capture.getEvents().cend(), [&capture, &name] (const auto& event) {
+      return capture.getNames()[event.nameIndex] == name;
+    });
+  };
+
+  // Zones are recorded when they end: the inner one is recorded first, & is enclosed by the outer one
+  const Raz::ProfileCapture::Event outerEvent = findEvent("Outer zone");
+  const Raz::ProfileCapture::Event innerEvent = findEvent("Inner zone");
+  CHECK(outerEvent.threadIndex == innerEvent.threadIndex);
+  CHECK(outerEvent.startTime <= innerEvent.startTime);
+  CHECK(outerEvent.startTime + outerEvent.duration >= innerEvent.startTime + innerEvent.duration);
+
+  const Raz::ProfileCapture::Event threadEvent = findEvent("Thread zone");
+  CHECK(threadEvent.threadIndex != outerEvent.threadIndex);
+  CHECK(capture.getThreadNames()[threadEvent.threadIndex] == "Profiled thread");
+
+  // Captured events are not captured again
+  CHECK(Raz::Profiler::capture().getEvents().empty());
+}
+
+TEST_CASE("Profiler thread buffer reuse") {
+  Raz::Profiler::capture();
+
+  const auto findThreadName = [] (const Raz::ProfileCapture& capture, const std::string& eventName) {
+    const auto eventIter = std::find_if(capture.getEvents().cbegin(), capture.getEvents().cend(), [&capture, &eventName] (const auto& event) {
+      return capture.getNames()[event.nameIndex] == eventName;
+    });
+
+    return (eventIter == capture.getEvents().cend() ? std::string() : capture.getThreadNames()[eventIter->threadIndex]);
+  };
+
+  std::thread([] () noexcept { const Raz::ProfileZone zone("First thread zone"); }).join();
+
+  // The buffer of an exited thread is still captured, its events being kept until then
+  const Raz::ProfileCapture firstCapture = Raz::Profiler::capture();
+  const std::string firstThreadName = findThreadName(firstCapture, "First thread zone");
+  REQUIRE_FALSE(firstThreadName.empty());
+
+  // Once captured, it is no longer listed, & is given to the next thread instead of a new one being allocated
+  const Raz::ProfileCapture emptyCapture = Raz::Profiler::capture();
+  CHECK(std::find(emptyCapture.getThreadNames().cbegin(), emptyCapture.getThreadNames().cend(), firstThreadName)
+        == emptyCapture.getThreadNames().cend());
+
+  std::thread([] () noexcept { const Raz::ProfileZone zone("Second thread zone"); }).join();
+  CHECK(findThreadName(Raz::Profiler::capture(), "Second thread zone") == firstThreadName);
+}
+
+TEST_CASE("Profiler full buffer") {
+  Raz::Profiler::capture();
+
+  for (std::size_t eventIndex = 0; eventIndex < Raz::Profiler::ThreadBufferCapacity + 10; ++eventIndex)
+    Raz::Profiler::recordEvent("Event", eventIndex, eventIndex + 1);
+
+  const Raz::ProfileCapture capture = Raz::Profiler::capture();
+  CHECK(capture.getEvents().size() == Raz::Profiler::ThreadBufferCapacity);
+  CHECK(capture.getDroppedEventCount() == 10);
+  CHECK(capture.getNames().size() == 1);
+
+  // Once captured, the buffer can be filled again
+  Raz::Profiler::recordEvent("Event", 0, 1);
+  CHECK(Raz::Profiler::capture().getEvents().size() == 1);
+}
+
+TEST_CASE("Profiler capture export") {
+  Raz::Profiler::capture();
+
+  Raz::Profiler::recordEvent("First \"event\"", 1000, 3500);
+  Raz::Profiler::recordEvent("Second event", 4000, 4001);
+  Raz::Profiler::recordEvent("First \"event\"", 5000, 6000);
+
+  const Raz::ProfileCapture capture = Raz::Profiler::capture();
+  REQUIRE(capture.getEvents().size() == 3);
+  CHECK(capture.getNames().size() == 2);
+
+  capture.saveBinary("testProfile.rzprof");
+  const Raz::ProfileCapture loadedCapture = Raz::ProfileCapture::loadBinary("testProfile.rzprof");
+
+  CHECK(loadedCapture.getNames() == capture.getNames());
+  CHECK(loadedCapture.getThreadNames() == capture.getThreadNames());
+  REQUIRE(loadedCapture.getEvents().size() == 3);
+
+  for (std::size_t eventIndex = 0; eventIndex < 3; ++eventIndex) {
+    const Raz::ProfileCapture::Event& event       = capture.getEvents()[eventIndex];
+    const Raz::ProfileCapture::Event& loadedEvent = loadedCapture.getEvents()[eventIndex];
+
+    CHECK(loadedEvent.nameIndex == event.nameIndex);
+    CHECK(loadedEvent.threadIndex == event.threadIndex);
+    CHECK(loadedEvent.startTime == event.startTime);
+    CHECK(loadedEvent.duration == event.duration);
+  }
+
+  capture.exportChromeTrace("testProfile.json");
+
+  std::ifstream traceFile("testProfile.json");
+  REQUIRE(traceFile);
+
+  std::stringstream trace;
+  trace << traceFile.rdbuf();
+
+  CHECK(trace.str().find(R"({"name":"First \"event\"","ph":"X","pid":0,"tid":)") != std::string::npos);
+  CHECK(trace.str().find(R"("ts":1.000,"dur":2.500})") != std::string::npos);
+  CHECK(trace.str().find(R"("ts":4.000,"dur":0.001})") != std::string::npos);
+  CHECK(trace.str().find(R"("ph":"M")") != std::string::npos);
+
+  CHECK_THROWS(Raz::ProfileCapture::loadBinary("testProfile.json"));
+}
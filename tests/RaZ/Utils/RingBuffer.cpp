@@ -0,0 +1,102 @@
+#include "Catch.hpp"
+
+#include "RaZ/Utils/RingBuffer.hpp"
+
+#ifdef RAZ_THREADS_AVAILABLE
+
+#include <array>
+#include <numeric>
+
+TEST_CASE("RingBuffer batches") {
+  Raz::RingBuffer<int> buffer(6);
+  CHECK(buffer.getCapacity() == 8);
+  CHECK(buffer.isEmpty());
+
+  std::array<int, 10> values {};
+  std::iota(values.begin(), values.end(), 0);
+
+  // Only the elements fitting in the buffer are pushed
+  CHECK(buffer.push(values.data(), 5) == 5);
+  CHECK(buffer.push(values.data() + 5, 5) == 3);
+  CHECK(buffer.getSize() == 8);
+  CHECK_FALSE(buffer.tryPush(8));
+
+  std::array<int, 10> poppedValues {};
+  CHECK(buffer.pop(poppedValues.data(), 6) == 6);
+  CHECK(poppedValues[0] == 0);
+  CHECK(poppedValues[5] == 5);
+
+  // The next batch wraps around the end of the buffer
+  CHECK(buffer.push(values.data(), 5) == 5);
+  CHECK(buffer.getSize() == 7);
+
+  CHECK(buffer.pop(poppedValues.data(), poppedValues.size()) == 7);
+  CHECK(poppedValues[0] == 6);
+  CHECK(poppedValues[1] == 7);
+
+  for (int valueIndex = 0; valueIndex < 5; ++valueIndex)
+    CHECK(poppedValues[static_cast<std::size_t>(valueIndex) + 2] == valueIndex);
+
+  CHECK(buffer.isEmpty());
+  CHECK(buffer.pop(poppedValues.data(), poppedValues.size()) == 0);
+
+  int value {};
+  CHECK_FALSE(buffer.tryPop(value));
+  CHECK(buffer.tryPush(42));
+  CHECK(buffer.tryPop(value));
+  CHECK(value == 42);
+}
+
+TEST_CASE("RingBuffer stress") {
+  Raz::RingBuffer<std::size_t> buffer(256);
+  constexpr std::size_t valueCount = 500'000;
+
+  std::thread producer([&buffer] () {
+    // Pushing batches of varying sizes, some of which being larger than the buffer
+    std::array<std::size_t, 300> batch {};
+    std::size_t nextValue = 0;
+    std::size_t batchSize = 1;
+
+    while (nextValue < valueCount) {
+      const std::size_t valueCountToPush = std::min(batchSize, valueCount - nextValue);
+      std::iota(batch.begin(), batch.begin() + static_cast<std::ptrdiff_t>(valueCountToPush), nextValue);
+
+      std::size_t pushedCount = 0;
+
+      while (pushedCount < valueCountToPush) {
+        const std::size_t count = buffer.push(batch.data() + pushedCount, valueCountToPush - pushedCount);
+
+        if (count == 0)
+          std::this_thread::yield();
+
+        pushedCount += count;
+      }
+
+      nextValue += valueCountToPush;
+      batchSize  = (batchSize * 7 + 3) % batch.size() + 1;
+    }
+  });
+
+  std::array<std::size_t, 100> batch {};
+  std::size_t expectedValue = 0;
+  bool isInOrder = true;
+
+  while (expectedValue < valueCount) {
+    const std::size_t count = buffer.pop(batch.data(), batch.size());
+
+    if (count == 0) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    for (std::size_t valueIndex = 0; valueIndex < count; ++valueIndex)
+      isInOrder = isInOrder && (batch[valueIndex] == expectedValue++);
+  }
+
+  producer.join();
+
+  CHECK(isInOrder);
+  CHECK(buffer.isEmpty());
+}
+
+#endif // RAZ_THREADS_AVAILABLE
@@ -0,0 +1,83 @@
+#include "Catch.hpp"
+
+#include "RaZ/Utils/SpscQueue.hpp"
+
+#ifdef RAZ_THREADS_AVAILABLE
+
+#include <memory>
+#include <string>
+
+TEST_CASE("SpscQueue basic") {
+  Raz::SpscQueue<std::string> queue(3);
+  CHECK(queue.getCapacity() == 4); // The capacity is rounded up to a power of two
+  CHECK(queue.isEmpty());
+
+  std::string value;
+  CHECK_FALSE(queue.tryPop(value));
+
+  CHECK(queue.tryPush("first"));
+  CHECK(queue.tryEmplace(3, 'a'));
+  CHECK(queue.tryPush(std::string("third")));
+  CHECK(queue.tryPush("fourth"));
+  CHECK(queue.getSize() == 4);
+
+  // The queue never grows; an element can't be added until another one has been popped
+  CHECK_FALSE(queue.tryPush("fifth"));
+
+  CHECK(queue.tryPop(value));
+  CHECK(value == "first");
+  CHECK(queue.tryPush("fifth"));
+
+  // Elements are popped in order, including around the end of the buffer
+  for (const char* expectedValue : { "aaa", "third", "fourth", "fifth" }) {
+    REQUIRE(queue.tryPop(value));
+    CHECK(value == expectedValue);
+  }
+
+  CHECK(queue.isEmpty());
+  CHECK_FALSE(queue.tryPop(value));
+
+  // The remaining elements are destroyed with the queue
+  const auto sharedValue = std::make_shared<int>(0);
+
+  {
+    Raz::SpscQueue<std::shared_ptr<int>> sharedQueue(4);
+    sharedQueue.tryPush(sharedValue);
+    sharedQueue.tryPush(sharedValue);
+    CHECK(sharedValue.use_count() == 3);
+  }
+
+  CHECK(sharedValue.use_count() == 1);
+}
+
+TEST_CASE("SpscQueue stress") {
+  // A small capacity forces both threads to often wait for each other
+  Raz::SpscQueue<std::size_t> queue(16);
+  constexpr std::size_t valueCount = 200'000;
+
+  std::thread producer([&queue] () {
+    for (std::size_t value = 0; value < valueCount; ++value) {
+      while (!queue.tryPush(value))
+        std::this_thread::yield();
+    }
+  });
+
+  // Every value is received exactly once & in order
+  bool isInOrder = true;
+
+  for (std::size_t expectedValue = 0; expectedValue < valueCount; ++expectedValue) {
+    std::size_t value {};
+
+    while (!queue.tryPop(value))
+      std::this_thread::yield();
+
+    isInOrder = isInOrder && (value == expectedValue);
+  }
+
+  producer.join();
+
+  CHECK(isInOrder);
+  CHECK(queue.isEmpty());
+}
+
+#endif // RAZ_THREADS_AVAILABLE
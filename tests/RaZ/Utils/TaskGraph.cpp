@@ -0,0 +1,130 @@
+#include "Catch.hpp"
+
+#include "RaZ/Utils/TaskGraph.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+
+TEST_CASE("TaskGraph dependencies") {
+  Raz::TaskGraph taskGraph;
+
+  std::mutex orderMutex;
+  std::vector<std::size_t> order;
+
+  const auto recordTask = [&orderMutex, &order] (std::size_t taskIndex) {
+    return [&orderMutex, &order, taskIndex] () {
+      std::lock_guard<std::mutex> lock(orderMutex);
+      order.emplace_back(taskIndex);
+    };
+  };
+  const auto getPosition = [&order] (std::size_t taskIndex) {
+    return std::distance(order.cbegin(), std::find(order.cbegin(), order.cend(), taskIndex));
+  };
+
+  // 0 -> 1 -> 3
+  //   \     /
+  //    > 2 -> 4 (continuation)
+  Raz::TaskNode& task0 = taskGraph.addTask(recordTask(0));
+  Raz::TaskNode& task1 = taskGraph.addTask(recordTask(1));
+  Raz::TaskNode& task2 = taskGraph.addTask(recordTask(2));
+  Raz::TaskNode& task3 = taskGraph.addWhenAll({ &task1, &task2 }, recordTask(3));
+  Raz::TaskNode& task4 = taskGraph.addContinuation(task2, recordTask(4));
+
+  task1.addDependency(task0);
+  task2.addDependencies(task0, task0); // Adding the same dependency twice doesn't count it twice
+  CHECK(task2.getDependencyCount() == 1);
+  CHECK(task3.getDependencyCount() == 2);
+  CHECK(task4.getDependencyCount() == 1);
+
+  // The graph can be executed several times, always following the same dependencies
+  for (std::size_t executionIndex = 0; executionIndex < 3; ++executionIndex) {
+    order.clear();
+    taskGraph.execute();
+
+    REQUIRE(order.size() == 5);
+    CHECK(getPosition(0) == 0);
+    CHECK(getPosition(1) < getPosition(3));
+    CHECK(getPosition(2) < getPosition(3));
+    CHECK(getPosition(2) < getPosition(4));
+  }
+}
+
+TEST_CASE("TaskGraph parallel execution") {
+  Raz::TaskGraph taskGraph;
+
+  // Decoding many items, then processing them, then gathering the results
+  std::vector<std::size_t> values(40);
+  std::vector<Raz::TaskNode*> processTasks;
+
+  for (std::size_t valueIndex = 0; valueIndex < values.size(); ++valueIndex) {
+    Raz::TaskNode& decodeTask = taskGraph.addTask([&values, valueIndex] () noexcept { values[valueIndex] = valueIndex + 1; });
+    processTasks.emplace_back(&taskGraph.addContinuation(decodeTask, [&values, valueIndex] () noexcept { values[valueIndex] *= 2; }));
+  }
+
+  std::size_t sum = 0;
+  taskGraph.addWhenAll(processTasks, [&values, &sum] () noexcept {
+    for (std::size_t value : values)
+      sum += value;
+  });
+
+  taskGraph.execute();
+  CHECK(sum == 40 * 41);
+}
+
+TEST_CASE("TaskGraph when any") {
+  Raz::TaskGraph taskGraph;
+
+  std::atomic<std::size_t> joinCount {};
+  std::atomic<bool> isSlowTaskDone {};
+
+  Raz::TaskNode& fastTask = taskGraph.addTask([] () noexcept {});
+  Raz::TaskNode& slowTask = taskGraph.addTask([&isSlowTaskDone] () noexcept { isSlowTaskDone = true; });
+  Raz::TaskNode& anyTask  = taskGraph.addWhenAny({ &fastTask, &slowTask }, [&joinCount] () noexcept { ++joinCount; });
+  CHECK(anyTask.waitsForAny());
+
+  // The join is executed only once, even though both its dependencies are done
+  taskGraph.execute();
+  CHECK(joinCount == 1);
+  CHECK(isSlowTaskDone);
+  CHECK_FALSE(anyTask.isCanceled());
+}
+
+TEST_CASE("TaskGraph failures") {
+  Raz::TaskGraph taskGraph;
+
+  bool isContinuationExecuted = false;
+  bool isAnyJoinExecuted      = false;
+  bool isIndependentExecuted  = false;
+
+  Raz::TaskNode& failingTask  = taskGraph.addTask([] () { throw std::runtime_error("Error: Test exception"); });
+  Raz::TaskNode& continuation = taskGraph.addContinuation(failingTask, [&isContinuationExecuted] () noexcept { isContinuationExecuted = true; });
+  Raz::TaskNode& nextTask     = taskGraph.addContinuation(continuation, {});
+  Raz::TaskNode& workingTask  = taskGraph.addTask([&isIndependentExecuted] () noexcept { isIndependentExecuted = true; });
+  Raz::TaskNode& anyJoin      = taskGraph.addWhenAny({ &failingTask, &workingTask }, [&isAnyJoinExecuted] () noexcept { isAnyJoinExecuted = true; });
+
+  // The tasks depending on a failed one are canceled, the others still being executed before the exception is rethrown
+  CHECK_THROWS_AS(taskGraph.execute(), std::runtime_error);
+
+  CHECK(failingTask.hasFailed());
+  CHECK(continuation.isCanceled());
+  CHECK(nextTask.isCanceled());
+  CHECK_FALSE(isContinuationExecuted);
+  CHECK(isIndependentExecuted);
+
+  // A task waiting for any of its dependencies is executed as long as one of them succeeds
+  CHECK_FALSE(anyJoin.isCanceled());
+  CHECK(isAnyJoinExecuted);
+
+  // Cycles are detected before executing anything
+  Raz::TaskGraph cyclicGraph;
+  bool isExecuted = false;
+
+  Raz::TaskNode& firstTask  = cyclicGraph.addTask([&isExecuted] () noexcept { isExecuted = true; });
+  Raz::TaskNode& secondTask = cyclicGraph.addContinuation(firstTask, {});
+  cyclicGraph.addTask({});
+  firstTask.addDependency(secondTask);
+
+  CHECK_THROWS_AS(cyclicGraph.execute(), std::runtime_error);
+  CHECK_FALSE(isExecuted);
+}
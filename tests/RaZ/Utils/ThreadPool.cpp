@@ -0,0 +1,68 @@
+#include "Catch.hpp"
+
+#include "RaZ/Utils/Threading.hpp"
+
+#ifdef RAZ_THREADS_AVAILABLE
+
+#include <numeric>
+#include <stdexcept>
+
+TEST_CASE("ThreadPool tasks") {
+  std::atomic<std::size_t> executedCount {};
+
+  {
+    Raz::ThreadPool threadPool(3);
+    CHECK(threadPool.getWorkerCount() == 3);
+
+    for (std::size_t i = 0; i < 100; ++i)
+      threadPool.addTask([&executedCount] () noexcept { ++executedCount; });
+
+    // The destructor waits for all the pending tasks to be executed
+  }
+
+  CHECK(executedCount == 100);
+}
+
+TEST_CASE("ThreadPool run") {
+  Raz::ThreadPool threadPool(2);
+
+  std::vector<std::size_t> values(50);
+  threadPool.run(values.size(), [&values] (std::size_t executionIndex) noexcept { values[executionIndex] = executionIndex + 1; });
+
+  CHECK(std::accumulate(values.cbegin(), values.cend(), static_cast<std::size_t>(0)) == 50 * 51 / 2);
+
+  // Executions can themselves run others on the same pool without blocking it
+  std::atomic<std::size_t> nestedCount {};
+  threadPool.run(4, [&threadPool, &nestedCount] (std::size_t) {
+    threadPool.run(4, [&nestedCount] (std::size_t) noexcept { ++nestedCount; });
+  });
+
+  CHECK(nestedCount == 16);
+
+  // The first exception thrown by any execution is forwarded to the caller, once every execution has finished
+  std::atomic<std::size_t> finishedCount {};
+  CHECK_THROWS_AS(threadPool.run(8, [&finishedCount] (std::size_t executionIndex) {
+    ++finishedCount;
+
+    if (executionIndex == 3)
+      throw std::runtime_error("Error: Test exception");
+  }), std::runtime_error);
+
+  CHECK(finishedCount == 8);
+}
+
+TEST_CASE("ThreadPool affinities") {
+  const unsigned int firstProcessorIndex = Raz::Threading::getCpuTopology().logicalProcessors.front().index;
+
+  // A worker with an empty processor set is free to run anywhere
+  Raz::ThreadPool threadPool({ Raz::ProcessorSet{ firstProcessorIndex }, Raz::ProcessorSet{} });
+  REQUIRE(threadPool.getWorkerCount() == 2);
+  CHECK(threadPool.getWorkerAffinity(0) == Raz::ProcessorSet{ firstProcessorIndex });
+  CHECK(threadPool.getWorkerAffinity(1).empty());
+
+  std::atomic<std::size_t> executedCount {};
+  threadPool.run(20, [&executedCount] (std::size_t) noexcept { ++executedCount; });
+  CHECK(executedCount == 20);
+}
+
+#endif // RAZ_THREADS_AVAILABLE
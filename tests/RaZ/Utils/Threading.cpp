@@ -2,8 +2,10 @@
 
 #include "RaZ/Utils/Threading.hpp"
 
+#include <algorithm>
 #include <numeric>
 #include <random>
+#include <stdexcept>
 
 #ifdef RAZ_THREADS_AVAILABLE
 
@@ -92,4 +94,160 @@ TEST_CASE("Iterator parallelization - indivisible size") {
   CHECK(sumBeforeIncrement + values.size() == sumAfterIncrement);
 }
 
+TEST_CASE("Parallelization - fewer elements than threads") {
+  std::vector<int> values(3);
+
+  Raz::Threading::parallelize(values, [&values] (Raz::Threading::IndexRange range) noexcept {
+    for (std::size_t i = range.beginIndex; i < range.endIndex; ++i)
+      ++values[i];
+  }, 8);
+
+  CHECK(values == std::vector<int>({ 1, 1, 1 }));
+
+  std::atomic<int> callCount {};
+  Raz::Threading::parallelize([&callCount] () noexcept { ++callCount; }, 8);
+  CHECK(callCount == 8);
+
+  // All instances run at the same time, even if there are more of them than the thread pool's workers; they can thus wait for each other
+  const std::size_t instanceCount = Raz::Threading::getDefaultThreadPool().getWorkerCount() + 4;
+  std::atomic<std::size_t> arrivedCount {};
+
+  Raz::Threading::parallelize([&arrivedCount, instanceCount] () noexcept {
+    ++arrivedCount;
+
+    while (arrivedCount < instanceCount)
+      std::this_thread::yield();
+  }, instanceCount);
+  CHECK(arrivedCount == instanceCount);
+}
+
+TEST_CASE("Parallel for") {
+  std::vector<int> values(2083);
+
+  // Each index must be processed exactly once, whatever the grain size
+  for (std::size_t grainSize : { 1, 7, 64, 2083, 5000 }) {
+    std::fill(values.begin(), values.end(), 0);
+    std::atomic<bool> isGrainSizeRespected = true;
+
+    Raz::Threading::parallelFor(Raz::Threading::IndexRange{ 0, values.size() }, grainSize, [&values, &isGrainSizeRespected, grainSize] (Raz::Threading::IndexRange range) noexcept {
+      if (range.endIndex - range.beginIndex > grainSize)
+        isGrainSizeRespected = false;
+
+      for (std::size_t i = range.beginIndex; i < range.endIndex; ++i)
+        ++values[i];
+    });
+
+    CHECK(isGrainSizeRespected);
+    CHECK(std::all_of(values.cbegin(), values.cend(), [] (int value) { return value == 1; }));
+  }
+
+  // The action can also be called for each index separately, over a subrange
+  std::fill(values.begin(), values.end(), 0);
+  Raz::Threading::parallelFor(Raz::Threading::IndexRange{ 10, 20 }, 3, [&values] (std::size_t index) { values[index] = static_cast<int>(index); });
+
+  CHECK(computeSum(values) == 145); // 10 + 11 + ... + 19
+  CHECK(values[9] == 0);
+  CHECK(values[20] == 0);
+
+  // An empty range does nothing
+  Raz::Threading::parallelFor(Raz::Threading::IndexRange{ 5, 5 }, 1, [] (std::size_t) { FAIL("An empty range must not be processed"); });
+}
+
+TEST_CASE("CPU topology") {
+  const Raz::Threading::CpuTopology& topology = Raz::Threading::getCpuTopology();
+
+  REQUIRE_FALSE(topology.logicalProcessors.empty());
+  CHECK(topology.logicalProcessors.size() == Raz::Threading::getSystemThreadCount());
+  CHECK(topology.coreCount >= 1);
+  CHECK(topology.coreCount <= topology.logicalProcessors.size());
+  CHECK(topology.numaNodeCount >= 1);
+  CHECK(topology.numaNodeCount <= topology.coreCount);
+
+  for (const Raz::Threading::LogicalProcessor& processor : topology.logicalProcessors) {
+    CHECK(processor.coreIndex < topology.coreCount);
+    CHECK(processor.numaNodeIndex < topology.numaNodeCount);
+  }
+
+  // The processors are sorted by core
+  CHECK(std::is_sorted(topology.logicalProcessors.cbegin(), topology.logicalProcessors.cend(), [] (const auto& processor1, const auto& processor2) {
+    return processor1.coreIndex < processor2.coreIndex;
+  }));
+}
+
+TEST_CASE("Worker affinities") {
+  // 2 NUMA nodes of 2 cores each, each core having 2 logical processors
+  Raz::Threading::CpuTopology topology;
+  topology.coreCount     = 4;
+  topology.numaNodeCount = 2;
+
+  for (unsigned int coreIndex = 0; coreIndex < 4; ++coreIndex) {
+    topology.logicalProcessors.push_back({ coreIndex, coreIndex, coreIndex / 2 });
+    topology.logicalProcessors.push_back({ coreIndex + 4, coreIndex, coreIndex / 2 });
+  }
+
+  using Affinities = std::vector<Raz::ProcessorSet>;
+
+  // By default, one core is left to the main thread, each other one getting a worker pinned to its processors
+  Raz::Threading::SchedulingSettings settings;
+  CHECK(Raz::Threading::computeWorkerAffinities(topology, settings) == Affinities({ { 1, 5 }, { 2, 6 }, { 3, 7 } }));
+
+  settings.pinWorkers = false;
+  CHECK(Raz::Threading::computeWorkerAffinities(topology, settings) == Affinities(3));
+
+  // Workers can be distributed on each NUMA node, sharing cores if there are more workers than cores
+  settings.reservedCoreCount       = 0;
+  settings.workerCountsPerNumaNode = { 1, 3 };
+  settings.pinWorkers              = true;
+  CHECK(Raz::Threading::computeWorkerAffinities(topology, settings) == Affinities({ { 0, 4 }, { 2, 6 }, { 3, 7 }, { 2, 6 } }));
+
+  // Unpinned workers are still kept on their node
+  settings.reservedCoreCount       = 3;
+  settings.workerCountsPerNumaNode = { 0, 2 };
+  settings.pinWorkers              = false;
+  CHECK(Raz::Threading::computeWorkerAffinities(topology, settings) == Affinities({ { 3, 7 }, { 3, 7 } }));
+
+  // If all cores are reserved, a single worker shares the last one
+  settings.reservedCoreCount       = 10;
+  settings.workerCountsPerNumaNode = {};
+  settings.pinWorkers              = true;
+  CHECK(Raz::Threading::computeWorkerAffinities(topology, settings) == Affinities({ { 3, 7 } }));
+
+  // Workers on a node whose cores are all reserved share its processors
+  settings.reservedCoreCount       = 2;
+  settings.workerCountsPerNumaNode = { 1 };
+  CHECK(Raz::Threading::computeWorkerAffinities(topology, settings) == Affinities({ { 0, 1, 4, 5 } }));
+
+  // There must be at least one worker, on existing nodes
+  settings.workerCountsPerNumaNode = { 0, 0 };
+  CHECK_THROWS_AS(Raz::Threading::computeWorkerAffinities(topology, settings), std::runtime_error);
+
+  settings.workerCountsPerNumaNode = { 1, 1, 1 };
+  CHECK_THROWS_AS(Raz::Threading::computeWorkerAffinities(topology, settings), std::runtime_error);
+}
+
+TEST_CASE("Default thread pool configuration") {
+  // The default pool can't be configured anymore once it has been used
+  Raz::Threading::getDefaultThreadPool();
+  CHECK_THROWS_AS(Raz::Threading::configureDefaultThreadPool(Raz::Threading::SchedulingSettings()), std::runtime_error);
+}
+
+#if defined(RAZ_PLATFORM_LINUX)
+TEST_CASE("Thread name & affinity") {
+  const unsigned int firstProcessorIndex = Raz::Threading::getCpuTopology().logicalProcessors.front().index;
+
+  bool isNamed  = false;
+  bool isPinned = false;
+
+  std::thread thread([&isNamed, &isPinned, firstProcessorIndex] () {
+    isNamed  = Raz::Threading::setCurrentThreadName("A thread with a long name"); // Truncated to 15 characters
+    isPinned = Raz::Threading::setCurrentThreadAffinity({ firstProcessorIndex });
+  });
+  thread.join();
+
+  CHECK(isNamed);
+  CHECK(isPinned);
+  CHECK_FALSE(Raz::Threading::setCurrentThreadAffinity({}));
+}
+#endif
+
 #endif // RAZ_THREADS_AVAILABLE
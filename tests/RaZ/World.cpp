@@ -0,0 +1,709 @@
+#include "Catch.hpp"
+
+#include "RaZ/System.hpp"
+#include "RaZ/World.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Physics/PhysicsSystem.hpp"
+#include "RaZ/Physics/RigidBody.hpp"
+#include "RaZ/Render/Light.hpp"
+
+#include <thread>
+
+namespace {
+
+class TransformSystem final : public Raz::System {
+public:
+  TransformSystem() { m_acceptedComponents.setBit(Raz::Component::getId<Raz::Transform>()); }
+
+  const std::vector<Raz::Entity*>& getEntities() const { return m_entities; }
+
+  bool update(float /* deltaTime */) override { return true; }
+};
+
+/// System destroying all the entities it is linked to during its update.
+class DestroyerSystem final : public Raz::System {
+public:
+  explicit DestroyerSystem(Raz::World& world) : m_world{ world } { m_acceptedComponents.setBit(Raz::Component::getId<Raz::RigidBody>()); }
+
+  bool update(float /* deltaTime */) override {
+    for (Raz::Entity* entity : m_entities)
+      m_world.destroyEntity(*entity);
+
+    return true;
+  }
+
+private:
+  Raz::World& m_world;
+};
+
+/// System requiring the main thread, as if it made graphics API calls.
+class GraphicsSystem final : public Raz::System {
+public:
+  GraphicsSystem() { requireMainThread(); }
+
+  bool update(float /* deltaTime */) override { return true; }
+};
+
+/// System moving a single entity on each update.
+class MoverSystem final : public Raz::System {
+public:
+  MoverSystem() { registerWrittenComponents<Raz::Transform>(); }
+
+  void setMovedEntity(Raz::Entity* entity) noexcept { m_movedEntity = entity; }
+
+  bool update(float /* deltaTime */) override {
+    if (m_movedEntity)
+      m_movedEntity->getMutableComponent<Raz::Transform>().translate(1.f, 0.f, 0.f);
+
+    return true;
+  }
+
+private:
+  Raz::Entity* m_movedEntity {};
+};
+
+/// System counting the transforms modified since its previous update.
+class ChangeTrackerSystem final : public Raz::System {
+public:
+  ChangeTrackerSystem() { registerReadComponents<Raz::Transform>(); }
+
+  std::size_t getChangedCount() const noexcept { return m_changedCount; }
+
+  void linkComponentRegistry(Raz::ComponentRegistry& registry) override {
+    System::linkComponentRegistry(registry);
+    m_transforms = &registry.query<const Raz::Transform>();
+  }
+
+  bool update(float /* deltaTime */) override {
+    m_changedCount = 0;
+    m_transforms->forEachChanged(getLastUpdateVersion(), [this] (const Raz::Transform&) noexcept { ++m_changedCount; });
+
+    return true;
+  }
+
+private:
+  const Raz::Query<const Raz::Transform>* m_transforms {};
+  std::size_t m_changedCount {};
+};
+
+/// System recording the times given to its updates.
+class TimeRecorderSystem final : public Raz::System {
+public:
+  TimeRecorderSystem() { registerReadComponents<Raz::Light>(); }
+
+  const std::vector<float>& getDeltaTimes() const noexcept { return m_deltaTimes; }
+
+  bool update(float deltaTime) override { m_deltaTimes.emplace_back(deltaTime); return true; }
+
+private:
+  std::vector<float> m_deltaTimes {};
+};
+
+/// System processing a given amount of work items, spreading them over several updates so as to stay within its time budget.
+class TimeSlicedSystem final : public Raz::System {
+public:
+  TimeSlicedSystem() { registerReadComponents<Raz::RigidBody>(); }
+
+  std::size_t getProcessedCount() const noexcept { return m_processedCount; }
+
+  void setWorkCount(std::size_t workCount) noexcept { m_workCount = workCount; }
+
+  bool update(float /* deltaTime */) override {
+    // At least one item is processed on each update, so that the work always progresses
+    do {
+      ++m_processedCount;
+    } while (m_processedCount < m_workCount && !isTimeBudgetSpent());
+
+    return true;
+  }
+
+private:
+  std::size_t m_workCount {};
+  std::size_t m_processedCount {};
+};
+
+/// System whose updates last a given duration.
+class SlowSystem final : public Raz::System {
+public:
+  SlowSystem() { registerReadComponents<Raz::Transform>(); }
+
+  void setUpdateDuration(std::chrono::milliseconds duration) noexcept { m_updateDuration = duration; }
+
+  bool update(float /* deltaTime */) override {
+    std::this_thread::sleep_for(m_updateDuration);
+    return true;
+  }
+
+private:
+  std::chrono::milliseconds m_updateDuration {};
+};
+
+const Raz::Archetype* findArchetype(const Raz::World& world, const Raz::Bitset& signature) {
+  for (const Raz::ArchetypePtr& archetype : world.getArchetypes()) {
+    if (archetype->getSignature() == signature)
+      return archetype.get();
+  }
+
+  return nullptr;
+}
+
+} // namespace
+
+TEST_CASE("World archetypes") {
+  Raz::World world;
+
+  Raz::Entity& entity1 = world.addEntity();
+  Raz::Entity& entity2 = world.addEntity();
+
+  // Entities without any component belong to the empty archetype
+  REQUIRE(world.getArchetypes().size() == 1);
+  CHECK(entity1.getArchetype() == entity2.getArchetype());
+  CHECK(entity1.getArchetype()->getSignature().isEmpty());
+  CHECK(entity1.getArchetype()->getEntityCount() == 2);
+
+  auto& transform1 = entity1.addComponent<Raz::Transform>();
+  auto& transform2 = entity2.addComponent<Raz::Transform>();
+
+  const Raz::Archetype* transformArchetype = entity1.getArchetype();
+  CHECK(transformArchetype == entity2.getArchetype());
+  CHECK(transformArchetype->hasComponent(Raz::Component::getId<Raz::Transform>()));
+  CHECK(transformArchetype->getEntityCount() == 2);
+
+  // Columns reference the entities' components in the same order as the entities themselves
+  const std::vector<Raz::Component*>& transformColumn = transformArchetype->getColumn(Raz::Component::getId<Raz::Transform>());
+  REQUIRE(transformColumn.size() == 2);
+  CHECK(transformColumn[0] == &transform1);
+  CHECK(transformColumn[1] == &transform2);
+
+  // Adding a component migrates the entity into another archetype, leaving its already existing components untouched
+  entity1.addComponent<Raz::RigidBody>(1.f, 0.5f);
+
+  CHECK(entity1.getArchetype() != transformArchetype);
+  CHECK(entity1.getArchetype()->getEntityCount() == 1);
+  CHECK(transformArchetype->getEntityCount() == 1);
+  CHECK(transformColumn.front() == &transform2);
+  CHECK(&entity1.getComponent<Raz::Transform>() == &transform1);
+
+  // Removing it brings the entity back into its former archetype
+  entity1.removeComponent<Raz::RigidBody>();
+
+  CHECK(entity1.getArchetype() == transformArchetype);
+  CHECK(transformArchetype->getEntityCount() == 2);
+
+  // Disabled entities don't belong to any archetype
+  entity2.disable();
+  CHECK(entity2.getArchetype() == nullptr);
+  CHECK(transformArchetype->getEntityCount() == 1);
+
+  entity2.enable();
+  CHECK(entity2.getArchetype() == transformArchetype);
+
+  Raz::Bitset lightSignature;
+  lightSignature.setBit(Raz::Component::getId<Raz::Light>());
+  CHECK(findArchetype(world, lightSignature) == nullptr);
+
+  world.addEntityWithComponent<Raz::Light>(Raz::LightType::POINT, 1.f);
+  CHECK(findArchetype(world, lightSignature) != nullptr);
+}
+
+TEST_CASE("World component storage") {
+  Raz::World world;
+
+  for (std::size_t entityIndex = 0; entityIndex < 3; ++entityIndex)
+    world.addEntityWithComponent<Raz::Transform>();
+
+  const auto& storage = world.getComponentRegistry().getStorage<Raz::Transform>();
+  CHECK(storage.getComponentCount() == 3);
+  CHECK(storage.getChunkCount() == 1);
+
+  // Components of the same type are stored contiguously
+  const auto& transform0 = world.getEntities()[0]->getComponent<Raz::Transform>();
+  const auto& transform1 = world.getEntities()[1]->getComponent<Raz::Transform>();
+  const auto& transform2 = world.getEntities()[2]->getComponent<Raz::Transform>();
+  CHECK(&transform1 == &transform0 + 1);
+  CHECK(&transform2 == &transform1 + 1);
+
+  // A removed component's slot is reused by the next one
+  world.getEntities()[1]->removeComponent<Raz::Transform>();
+  CHECK(storage.getComponentCount() == 2);
+
+  const auto& newTransform = world.getEntities()[1]->addComponent<Raz::Transform>();
+  CHECK(&newTransform == &transform0 + 1);
+  CHECK(storage.getComponentCount() == 3);
+
+  CHECK_FALSE(world.getComponentRegistry().hasStorage<Raz::RigidBody>());
+  CHECK_THROWS(world.getComponentRegistry().getStorage<Raz::RigidBody>());
+}
+
+TEST_CASE("World queries") {
+  Raz::World world;
+
+  Raz::Entity& transformEntity = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(1.f));
+  Raz::Entity& bodyEntity      = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(2.f));
+  bodyEntity.addComponent<Raz::RigidBody>(1.f, 0.5f);
+
+  auto& transformQuery = world.query<Raz::Transform>();
+  auto& bodyQuery      = world.query<Raz::Transform, Raz::RigidBody>();
+  auto& noBodyQuery    = world.query<Raz::Transform>(Raz::exclude<Raz::RigidBody>);
+
+  // Queries are cached & returned as is when requested again
+  CHECK(&world.query<Raz::Transform>() == &transformQuery);
+  CHECK(&world.query<Raz::Transform>(Raz::exclude<Raz::RigidBody>) == &noBodyQuery);
+  CHECK(&world.query<Raz::Transform>(Raz::exclude<Raz::RigidBody>) != &transformQuery);
+  CHECK(&world.query<Raz::Transform, Raz::RigidBody>() == &bodyQuery);
+
+  // The same components queried in another order give their references in that order, & thus make a different query
+  CHECK(&world.query<Raz::RigidBody, Raz::Transform>() != static_cast<const Raz::BaseQuery*>(&bodyQuery));
+
+  CHECK(transformQuery.computeEntityCount() == 2);
+  CHECK(bodyQuery.computeEntityCount() == 1);
+  CHECK(noBodyQuery.computeEntityCount() == 1);
+
+  float positionSum = 0.f;
+
+  for (auto [transform] : transformQuery)
+    positionSum += transform.getPosition()[0];
+
+  CHECK(positionSum == 3.f);
+
+  for (auto [transform, rigidBody] : bodyQuery) {
+    CHECK(&transform == &bodyEntity.getComponent<Raz::Transform>());
+    CHECK(&rigidBody == &bodyEntity.getComponent<Raz::RigidBody>());
+  }
+
+  noBodyQuery.forEach([&transformEntity] (Raz::Entity& entity, Raz::Transform& transform) {
+    CHECK(&entity == &transformEntity);
+    transform.translate(1.f, 0.f, 0.f);
+  });
+
+  CHECK(transformEntity.getComponent<Raz::Transform>().getPosition()[0] == 2.f);
+
+  // Queries are kept up to date with the entities' structural changes, including with newly created archetypes
+  transformEntity.addComponent<Raz::RigidBody>(1.f, 0.5f);
+  CHECK(bodyQuery.computeEntityCount() == 2);
+  CHECK(noBodyQuery.computeEntityCount() == 0);
+
+  Raz::Entity& lightEntity = world.addEntityWithComponent<Raz::Light>(Raz::LightType::POINT, 1.f);
+  lightEntity.addComponent<Raz::Transform>();
+  lightEntity.addComponent<Raz::RigidBody>(1.f, 0.5f);
+  CHECK(bodyQuery.computeEntityCount() == 3);
+  CHECK(world.query<Raz::Transform, Raz::RigidBody>(Raz::exclude<Raz::Light>).computeEntityCount() == 2);
+
+  // Disabled entities are not matched
+  bodyEntity.disable();
+  CHECK(bodyQuery.computeEntityCount() == 2);
+
+  std::size_t iterationCount = 0;
+  bodyQuery.forEach([&iterationCount] (Raz::Transform&, Raz::RigidBody&) noexcept { ++iterationCount; });
+  CHECK(iterationCount == 2);
+}
+
+TEST_CASE("World system linking") {
+  Raz::World world;
+
+  Raz::Entity& entity1 = world.addEntityWithComponent<Raz::Transform>();
+  Raz::Entity& entity2 = world.addEntity();
+
+  // Entities existing before the system are linked on the next refresh
+  auto& system = world.addSystem<TransformSystem>();
+  CHECK(system.getEntities().empty());
+
+  CHECK(entity1.isDirty());
+  CHECK(entity2.isDirty());
+
+  world.refresh();
+
+  CHECK_FALSE(entity1.isDirty());
+  CHECK_FALSE(entity2.isDirty());
+  CHECK(system.containsEntity(entity1));
+  CHECK_FALSE(system.containsEntity(entity2));
+
+  // Modifying an entity's components marks it as dirty & relinks it
+  entity2.addComponent<Raz::Transform>();
+  CHECK(entity2.isDirty());
+  CHECK_FALSE(entity1.isDirty());
+
+  world.refresh();
+  CHECK(system.containsEntity(entity2));
+  REQUIRE(system.getEntities().size() == 2);
+
+  entity1.removeComponent<Raz::Transform>();
+  world.refresh();
+
+  // The last linked entity takes the unlinked entity's place
+  CHECK_FALSE(system.containsEntity(entity1));
+  CHECK(system.containsEntity(entity2));
+  REQUIRE(system.getEntities().size() == 1);
+  CHECK(system.getEntities().front() == &entity2);
+
+  entity1.addComponent<Raz::Transform>();
+  world.update(0.f);
+  CHECK(system.containsEntity(entity1));
+
+  // Linking an already linked entity doesn't duplicate it
+  system.linkEntity(entity1);
+  CHECK(system.getEntities().size() == 2);
+
+  system.unlinkEntity(entity1);
+  system.unlinkEntity(entity1);
+  CHECK(system.getEntities().size() == 1);
+
+  // Disabled entities are unlinked on the next refresh, & relinked once enabled again
+  entity2.disable();
+  CHECK(entity2.isDirty());
+  CHECK(system.containsEntity(entity2));
+
+  world.refresh();
+  CHECK_FALSE(system.containsEntity(entity2));
+  CHECK(system.getEntities().empty());
+
+  entity2.enable();
+  world.refresh();
+  CHECK(system.containsEntity(entity2));
+
+  // Entities created disabled are not linked either
+  Raz::Entity& disabledEntity = world.addEntity(false);
+  disabledEntity.addComponent<Raz::Transform>();
+  world.refresh();
+  CHECK_FALSE(system.containsEntity(disabledEntity));
+}
+
+TEST_CASE("World entity destruction") {
+  Raz::World world;
+
+  auto& system = world.addSystem<TransformSystem>();
+
+  Raz::Entity& entity1 = world.addEntityWithComponent<Raz::Transform>();
+  Raz::Entity& entity2 = world.addEntityWithComponent<Raz::Transform>();
+  world.refresh();
+
+  const Raz::EntityHandle handle1 = entity1.getHandle();
+  const Raz::EntityHandle handle2 = entity2.getHandle();
+
+  CHECK(world.isValid(handle1));
+  CHECK(world.getEntity(handle2) == &entity2);
+  CHECK_FALSE(world.isValid(Raz::EntityHandle{}));
+
+  // The destruction is deferred until the next refresh
+  world.destroyEntity(entity1);
+  CHECK(entity1.isPendingDestruction());
+  CHECK(world.isValid(handle1));
+  CHECK(world.getEntities().size() == 2);
+
+  world.refresh();
+
+  CHECK_FALSE(world.isValid(handle1));
+  CHECK(world.getEntity(handle1) == nullptr);
+  CHECK(world.getEntities().size() == 1);
+  CHECK(system.getEntities().size() == 1);
+  CHECK(system.containsEntity(entity2));
+  CHECK(world.getComponentRegistry().getStorage<Raz::Transform>().getComponentCount() == 1);
+
+  // The destroyed entity's index is reused with a new generation, its former handles not referencing the new entity
+  Raz::Entity& entity3 = world.addEntityWithComponent<Raz::Transform>();
+  CHECK(entity3.getId() == handle1.index);
+  CHECK(entity3.getHandle() != handle1);
+  CHECK_FALSE(world.isValid(handle1));
+  CHECK(world.getEntity(entity3.getHandle()) == &entity3);
+
+  // Destroying through a stale handle does nothing
+  world.destroyEntity(handle1);
+  CHECK_FALSE(entity3.isPendingDestruction());
+
+  // An entity can be destroyed before having ever been linked
+  Raz::Entity& entity4 = world.addEntityWithComponent<Raz::Transform>();
+  world.destroyEntity(entity4.getHandle());
+  world.update(0.f);
+
+  CHECK(world.getEntities().size() == 2);
+  CHECK(system.getEntities().size() == 2);
+  CHECK(world.isValid(handle2));
+}
+
+TEST_CASE("World entity destruction during update") {
+  Raz::World world;
+  world.addSystem<DestroyerSystem>(world);
+
+  // Disabled entities must be kept
+  for (std::size_t entityIndex = 0; entityIndex < 100; ++entityIndex)
+    world.addEntityWithComponent<Raz::Transform>().disable();
+
+  std::size_t chunkCount = 0;
+
+  // Spawning & destroying many short-lived entities must not make the world grow
+  for (std::size_t frameIndex = 0; frameIndex < 100; ++frameIndex) {
+    if (frameIndex == 10)
+      chunkCount = world.getComponentRegistry().getStorage<Raz::Transform>().getChunkCount();
+
+    for (std::size_t entityIndex = 0; entityIndex < 100; ++entityIndex)
+      world.addEntityWithComponent<Raz::Transform>().addComponent<Raz::RigidBody>(1.f, 0.f);
+
+    // The entities are linked at the beginning of the update, then destroyed on the next one
+    world.update(0.f);
+  }
+
+  world.update(0.f);
+
+  CHECK(world.getEntities().size() == 100);
+  CHECK(world.getComponentRegistry().getStorage<Raz::RigidBody>().getComponentCount() == 0);
+  CHECK(world.getComponentRegistry().getStorage<Raz::Transform>().getComponentCount() == 100);
+  CHECK(world.getComponentRegistry().getStorage<Raz::Transform>().getChunkCount() == chunkCount);
+  CHECK(std::none_of(world.getEntities().cbegin(), world.getEntities().cend(), [] (const Raz::EntityPtr& entity) { return entity->isEnabled(); }));
+}
+
+TEST_CASE("World deferred refresh") {
+  Raz::World world;
+  auto& system = world.addSystem<TransformSystem>();
+
+  Raz::Entity& entity = world.addEntityWithComponent<Raz::Transform>();
+
+  world.deferRefresh();
+  CHECK(world.isRefreshDeferred());
+
+  // While deferred, the structural changes are not applied by the updates
+  world.update(0.f);
+  CHECK(entity.isDirty());
+  CHECK_FALSE(system.containsEntity(entity));
+
+  world.destroyEntity(entity);
+  world.update(0.f);
+  CHECK(world.getEntities().size() == 1);
+
+  world.refresh();
+  CHECK(world.getEntities().empty());
+  CHECK(system.getEntities().empty());
+
+  world.deferRefresh(false);
+
+  Raz::Entity& newEntity = world.addEntityWithComponent<Raz::Transform>();
+  world.update(0.f);
+  CHECK(system.containsEntity(newEntity));
+}
+
+TEST_CASE("World entity pool") {
+  Raz::World world(100);
+
+  // The entities' memory is allocated upfront
+  const std::size_t chunkCount = world.getEntityPool().getChunkCount();
+  CHECK(world.getEntityPool().getCapacity() >= 100);
+
+  for (std::size_t entityIndex = 0; entityIndex < 100; ++entityIndex)
+    world.addEntityWithComponent<Raz::Transform>();
+
+  CHECK(world.getEntityPool().getObjectCount() == 100);
+  CHECK(world.getEntityPool().getChunkCount() == chunkCount);
+
+  const Raz::Entity* destroyedEntity = world.getEntities()[50].get();
+  world.destroyEntity(*world.getEntities()[50]);
+  world.refresh();
+
+  CHECK(world.getEntityPool().getObjectCount() == 99);
+  CHECK(world.getEntityPool().getFreeSlotCount() == 1);
+  CHECK(world.getEntityPool().computeFragmentation() == 0.01f);
+
+  // The next entity takes the destroyed one's place in memory
+  CHECK(&world.addEntity() == destroyedEntity);
+  CHECK(world.getEntityPool().computeFragmentation() == 0.f);
+
+  const auto& transformPool = world.getComponentRegistry().getStorage<Raz::Transform>().getPool();
+  CHECK(transformPool.getObjectCount() == 99);
+  CHECK(transformPool.getFreeSlotCount() == 1);
+}
+
+TEST_CASE("World fixed step update") {
+  Raz::World world;
+
+  auto& physics   = world.addSystem<Raz::PhysicsSystem>();
+  auto& transform = world.addSystem<TransformSystem>();
+  CHECK(physics.isFixedStepRequired());
+  CHECK_FALSE(transform.isFixedStepRequired());
+
+  Raz::Entity& entity = world.addEntityWithComponent<Raz::Transform>();
+  entity.addComponent<Raz::RigidBody>(1.f, 0.f);
+
+  // Only the systems requiring a fixed step are updated at this step
+  world.updateFixedStep(1.f);
+  const float fixedStepHeight = entity.getComponent<Raz::Transform>().getPosition()[1];
+  CHECK(fixedStepHeight < 0.f);
+
+  CHECK(world.updateVariableStep(1.f, 0.25f));
+  CHECK(entity.getComponent<Raz::Transform>().getPosition()[1] == fixedStepHeight);
+  CHECK(transform.getStepInterpolation() == 0.25f);
+
+  // A regular update updates all the systems, without any interpolation
+  world.update(1.f);
+  CHECK(entity.getComponent<Raz::Transform>().getPosition()[1] < fixedStepHeight);
+  CHECK(transform.getStepInterpolation() == 0.f);
+}
+
+TEST_CASE("World standalone system update") {
+  // A system can still be used outside of any World, its entities being linked manually
+  Raz::PhysicsSystem physics;
+
+  Raz::EntityPtr entity = Raz::Entity::create(0);
+  entity->addComponent<Raz::Transform>();
+  entity->addComponent<Raz::RigidBody>(1.f, 0.f);
+  physics.linkEntity(entity);
+
+  CHECK(physics.update(1.f));
+  CHECK(entity->getComponent<Raz::Transform>().getPosition()[1] < 0.f);
+}
+
+TEST_CASE("World main thread requirement") {
+  Raz::World world;
+  CHECK_FALSE(world.isMainThreadRequired());
+
+  // Systems which haven't declared their accesses are only bound to the thread updating the world
+  world.addSystem<TransformSystem>();
+  CHECK(world.getSystem<TransformSystem>().isMainThreadRequired());
+  CHECK_FALSE(world.isMainThreadRequired());
+
+  world.addSystem<GraphicsSystem>();
+  CHECK(world.isMainThreadRequired());
+
+  world.removeSystem<GraphicsSystem>();
+  CHECK_FALSE(world.isMainThreadRequired());
+}
+
+TEST_CASE("World change tracking") {
+  Raz::World world;
+
+  for (std::size_t entityIndex = 0; entityIndex < 10; ++entityIndex)
+    world.addEntityWithComponent<Raz::Transform>();
+
+  auto& mover   = world.addSystem<MoverSystem>();
+  auto& tracker = world.addSystem<ChangeTrackerSystem>();
+
+  // Queries only reading components share their entities with the mutable ones, but are cached separately
+  CHECK(&world.query<const Raz::Transform>() != static_cast<const Raz::BaseQuery*>(&world.query<Raz::Transform>()));
+  CHECK(world.query<const Raz::Transform>().computeEntityCount() == 10);
+
+  // All the components are considered modified before a system's first update
+  world.update(0.f);
+  CHECK(tracker.getChangedCount() == 10);
+  CHECK(tracker.getLastUpdateVersion() != 0);
+
+  world.update(0.f);
+  CHECK(tracker.getChangedCount() == 0);
+
+  // Only the components modified since the system's last update are iterated over, whichever system has been updated first
+  Raz::Entity& movedEntity = *world.getEntities()[3];
+  mover.setMovedEntity(&movedEntity);
+
+  world.update(0.f);
+  world.update(0.f);
+  CHECK(tracker.getChangedCount() == 1);
+
+  mover.setMovedEntity(nullptr);
+  world.update(0.f);
+  world.update(0.f);
+  CHECK(tracker.getChangedCount() == 0);
+
+  // Reading components doesn't mark them as modified, while accessing them mutably or creating them does
+  const Raz::Transform& transform = static_cast<const Raz::Entity&>(movedEntity).getComponent<Raz::Transform>();
+  const std::uint64_t changeVersion = transform.getChangeVersion();
+
+  world.query<const Raz::Transform>().forEach([] (const Raz::Transform&) noexcept {});
+  CHECK(transform.getChangeVersion() == changeVersion);
+
+  // Only an explicit mutable access marks a component from its entity, getting it having no side effect
+  movedEntity.getComponent<Raz::Transform>();
+  CHECK(transform.getChangeVersion() == changeVersion);
+
+  movedEntity.getMutableComponent<Raz::Transform>();
+  CHECK(transform.getChangeVersion() > changeVersion);
+
+  // A modification can't be undone by an older one, stamped later by another thread
+  const std::uint64_t mutableChangeVersion = transform.getChangeVersion();
+  movedEntity.getComponent<Raz::Transform>().markChanged(changeVersion);
+  CHECK(transform.getChangeVersion() == mutableChangeVersion);
+
+  world.query<Raz::Transform>().forEach([] (Raz::Transform&) noexcept {});
+  world.addEntityWithComponent<Raz::Transform>();
+
+  world.update(0.f);
+  CHECK(tracker.getChangedCount() == 11);
+}
+
+TEST_CASE("World system update rates") {
+  Raz::World world;
+  auto& timeRecorder = world.addSystem<TimeRecorderSystem>();
+  CHECK(timeRecorder.getUpdateInterval() == 1);
+  CHECK(timeRecorder.getUpdateFrequency() == 0.f);
+
+  // A system updated every 3 frames is given the time elapsed during all of them
+  timeRecorder.setUpdateInterval(3);
+
+  for (int i = 0; i < 7; ++i)
+    world.update(0.5f);
+
+  CHECK(timeRecorder.getDeltaTimes() == std::vector<float>({ 1.5f, 1.5f }));
+
+  // With a maximal frequency of 2 Hz, the system waits for at least 0.5 second to have elapsed, along with its interval
+  timeRecorder.setUpdateInterval(1);
+  timeRecorder.setUpdateFrequency(2.f);
+
+  world.update(0.25f); // The last frame having been skipped, 0.75s have elapsed since the last update
+  world.update(0.25f);
+  world.update(0.25f);
+  world.update(0.75f);
+
+  CHECK(timeRecorder.getDeltaTimes() == std::vector<float>({ 1.5f, 1.5f, 0.75f, 0.5f, 0.75f }));
+}
+
+TEST_CASE("World time-sliced systems") {
+  Raz::World world;
+  auto& timeSliced = world.addSystem<TimeSlicedSystem>();
+  timeSliced.setWorkCount(100);
+
+  // Without any budget, all the work is done at once
+  world.update(0.f);
+  CHECK(timeSliced.getProcessedCount() == 100);
+
+  // With a budget spent as soon as the update starts, a single item is processed per update
+  timeSliced.setWorkCount(103);
+  timeSliced.setTimeBudget(1e-9f);
+
+  for (std::size_t updateIndex = 1; updateIndex <= 3; ++updateIndex) {
+    world.update(0.f);
+    CHECK(timeSliced.getProcessedCount() == 100 + updateIndex);
+  }
+}
+
+TEST_CASE("World budget overruns") {
+  Raz::World world;
+  auto& slow = world.addSystem<SlowSystem>();
+  auto& physics = world.addSystem<Raz::PhysicsSystem>();
+  slow.setUpdateDuration(std::chrono::milliseconds(2));
+
+  world.update(0.f);
+  CHECK(world.getBudgetOverruns().empty());
+  CHECK(slow.getLastUpdateDuration() >= 0.002f);
+  CHECK_FALSE(slow.hasExceededTimeBudget());
+
+  slow.setTimeBudget(0.001f);
+  world.update(0.f);
+  REQUIRE(world.getBudgetOverruns().size() == 1);
+  CHECK(world.getBudgetOverruns().front().system == &slow);
+  CHECK(world.getBudgetOverruns().front().updateDuration >= 0.002f);
+  CHECK(world.getBudgetOverruns().front().timeBudget == 0.001f);
+  CHECK(slow.hasExceededTimeBudget());
+
+  // The overruns are reported for a whole frame, including all its fixed steps
+  slow.setUpdateDuration(std::chrono::milliseconds(0));
+  physics.setTimeBudget(1e-9f);
+
+  world.updateFixedStep(0.f);
+  world.updateFixedStep(0.f);
+  CHECK(world.getBudgetOverruns().size() == 2);
+
+  world.updateVariableStep(0.f, 0.f);
+  REQUIRE(world.getBudgetOverruns().size() == 2);
+  CHECK(world.getBudgetOverruns().front().system == &physics);
+
+  // A skipped system doesn't report any overrun
+  physics.setUpdateInterval(2);
+  world.updateFixedStep(0.f);
+  world.updateVariableStep(0.f, 0.f);
+  CHECK(world.getBudgetOverruns().empty());
+}
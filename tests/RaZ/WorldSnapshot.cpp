@@ -0,0 +1,181 @@
+#include "Catch.hpp"
+
+#include "RaZ/Entity.hpp"
+#include "RaZ/World.hpp"
+#include "RaZ/WorldSnapshot.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Physics/RigidBody.hpp"
+
+#include <cstring>
+#include <string_view>
+
+namespace {
+
+struct Health final : public Raz::Component {
+  explicit Health(int val, std::string ownerName = {}) : value{ val }, owner{ std::move(ownerName) } {}
+
+  int value {};
+  std::string owner {};
+};
+
+void registerHealth(Raz::WorldSnapshot& snapshot) {
+  snapshot.registerComponent<Health>("Health", 2, [] (const Health& health, Raz::SnapshotWriter& writer) {
+    writer.write(health.value);
+    writer.writeString(health.owner);
+  }, [] (Raz::Entity& entity, Raz::SnapshotReader& reader, std::uint32_t version) {
+    const auto value = reader.read<int>();
+    // The owner has only been saved from the version 2 onward
+    entity.addComponent<Health>(value, (version >= 2 ? reader.readString() : std::string()));
+  });
+}
+
+} // namespace
+
+TEST_CASE("WorldSnapshot save & load") {
+  Raz::World world;
+
+  Raz::Entity& transformEntity = world.addEntity();
+  transformEntity.addComponent<Raz::Transform>(Raz::Vec3f(1.f, 2.f, 3.f), Raz::Mat4f::identity(), Raz::Vec3f(2.f));
+
+  Raz::Entity& physicsEntity = world.addEntity(false);
+  physicsEntity.addComponent<Raz::Transform>(Raz::Vec3f(-1.f));
+  auto& rigidBody = physicsEntity.addComponent<Raz::RigidBody>(5.f, 0.5f);
+  rigidBody.setVelocity(Raz::Vec3f(0.f, -3.f, 0.f));
+  physicsEntity.addComponent<Health>(42, "Player");
+
+  world.addEntity(); // Entity without any component
+
+  Raz::Entity& destroyedEntity = world.addEntityWithComponent<Raz::Transform>();
+  world.destroyEntity(destroyedEntity);
+
+  Raz::WorldSnapshot snapshot;
+  CHECK(snapshot.isComponentRegistered<Raz::Transform>());
+  CHECK(snapshot.isComponentRegistered<Raz::RigidBody>());
+  CHECK_FALSE(snapshot.isComponentRegistered<Health>());
+
+  registerHealth(snapshot);
+  CHECK(snapshot.isComponentRegistered<Health>());
+
+  const std::vector<std::byte> data = snapshot.save(world);
+
+  Raz::World loadedWorld;
+  const std::vector<Raz::Entity*> entities = snapshot.load(loadedWorld, data);
+
+  // The entity pending destruction isn't saved
+  REQUIRE(entities.size() == 3);
+  CHECK(loadedWorld.getEntities().size() == 3);
+
+  CHECK(entities[0]->isEnabled());
+  REQUIRE(entities[0]->hasComponent<Raz::Transform>());
+  CHECK_FALSE(entities[0]->hasComponent<Raz::RigidBody>());
+  CHECK(entities[0]->getComponent<Raz::Transform>().getPosition() == Raz::Vec3f(1.f, 2.f, 3.f));
+  CHECK(entities[0]->getComponent<Raz::Transform>().getScale() == Raz::Vec3f(2.f));
+
+  CHECK_FALSE(entities[1]->isEnabled());
+  REQUIRE(entities[1]->hasComponent<Raz::RigidBody>());
+  CHECK(entities[1]->getComponent<Raz::Transform>().getPosition() == Raz::Vec3f(-1.f));
+  CHECK(entities[1]->getComponent<Raz::RigidBody>().getMass() == 5.f);
+  CHECK(entities[1]->getComponent<Raz::RigidBody>().getBounciness() == 0.5f);
+  CHECK(entities[1]->getComponent<Raz::RigidBody>().getVelocity() == Raz::Vec3f(0.f, -3.f, 0.f));
+  REQUIRE(entities[1]->hasComponent<Health>());
+  CHECK(entities[1]->getComponent<Health>().value == 42);
+  CHECK(entities[1]->getComponent<Health>().owner == "Player");
+
+  CHECK(entities[2]->isEnabled());
+  CHECK(entities[2]->getEnabledComponents().isEmpty());
+
+  // Loading appends the entities to the existing ones
+  snapshot.load(loadedWorld, data);
+  CHECK(loadedWorld.getEntities().size() == 6);
+
+  // Saving into an existing buffer gives the same data
+  std::vector<std::byte> reusedData(8, std::byte{ 0xFF });
+  snapshot.save(world, reusedData);
+  CHECK(reusedData == data);
+
+  // A serializer not knowing a component skips its block
+  Raz::World partialWorld;
+  const std::vector<Raz::Entity*> partialEntities = Raz::WorldSnapshot().load(partialWorld, data);
+  REQUIRE(partialEntities.size() == 3);
+  CHECK(partialEntities[1]->hasComponent<Raz::RigidBody>());
+  CHECK_FALSE(partialEntities[1]->hasComponent<Health>());
+}
+
+TEST_CASE("WorldSnapshot file") {
+  Raz::World world;
+  for (int entityIndex = 0; entityIndex < 100; ++entityIndex)
+    world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(static_cast<float>(entityIndex)));
+
+  const Raz::WorldSnapshot snapshot;
+  snapshot.save(world, "testWorld.rzworld");
+
+  Raz::World loadedWorld;
+  const std::vector<Raz::Entity*> entities = snapshot.load(loadedWorld, "testWorld.rzworld");
+
+  REQUIRE(entities.size() == 100);
+  for (std::size_t entityIndex = 0; entityIndex < entities.size(); ++entityIndex)
+    CHECK(entities[entityIndex]->getComponent<Raz::Transform>().getPosition() == Raz::Vec3f(static_cast<float>(entityIndex)));
+
+  CHECK_THROWS(snapshot.load(loadedWorld, "nonExistingFile.rzworld"));
+}
+
+TEST_CASE("WorldSnapshot invalid data") {
+  Raz::World world;
+  world.addEntityWithComponent<Raz::Transform>();
+
+  const Raz::WorldSnapshot snapshot;
+  std::vector<std::byte> data = snapshot.save(world);
+
+  Raz::World loadedWorld;
+
+  // Truncated data
+  CHECK_THROWS(snapshot.load(loadedWorld, data.data(), data.size() - 1));
+  CHECK_THROWS(snapshot.load(loadedWorld, data.data(), 4));
+
+  // Invalid magic
+  std::vector<std::byte> invalidData = data;
+  invalidData[0] = std::byte{ 0 };
+  CHECK_THROWS(snapshot.load(loadedWorld, invalidData));
+
+  // Unsupported format version
+  invalidData = data;
+  invalidData[8] = std::byte{ 0xFF };
+  CHECK_THROWS(snapshot.load(loadedWorld, invalidData));
+
+  // A corrupted snapshot doesn't add any entity to the world
+  loadedWorld.addEntity();
+
+  // The first block follows the header (magic, format version, block count & entity count) & the entities' enabled states
+  constexpr std::size_t blockStart = 8 + sizeof(std::uint32_t) * 2 + sizeof(std::uint64_t) + 1;
+  constexpr std::size_t dataSizePos = blockStart + sizeof(std::uint32_t) + std::string_view("Transform").size() + sizeof(std::uint32_t)
+                                                 + sizeof(std::uint64_t);
+  constexpr std::size_t entityIndicesPos = dataSizePos + sizeof(std::uint64_t);
+
+  // Block count larger than the amount of blocks
+  invalidData = data;
+  invalidData[12] = std::byte{ 2 };
+  CHECK_THROWS(snapshot.load(loadedWorld, invalidData));
+  CHECK(loadedWorld.getEntities().size() == 1);
+
+  // Component referencing an entity which doesn't exist
+  invalidData = data;
+  invalidData[entityIndicesPos] = std::byte{ 5 };
+  CHECK_THROWS(snapshot.load(loadedWorld, invalidData));
+  CHECK(loadedWorld.getEntities().size() == 1);
+
+  // Block's data too small for its components, which can only be noticed once its entities have been created
+  invalidData = data;
+  std::uint64_t dataSize {};
+  std::memcpy(&dataSize, invalidData.data() + dataSizePos, sizeof(dataSize));
+  --dataSize;
+  std::memcpy(invalidData.data() + dataSizePos, &dataSize, sizeof(dataSize));
+  CHECK_THROWS(snapshot.load(loadedWorld, invalidData));
+
+  loadedWorld.refresh();
+  CHECK(loadedWorld.getEntities().size() == 1);
+
+  // Registering a name already used by another component is forbidden
+  Raz::WorldSnapshot otherSnapshot;
+  CHECK_THROWS(otherSnapshot.registerComponent<Health>("Transform", 1, [] (const Health&, Raz::SnapshotWriter&) noexcept {},
+                                                       [] (Raz::Entity&, Raz::SnapshotReader&, std::uint32_t) noexcept {}));
+}